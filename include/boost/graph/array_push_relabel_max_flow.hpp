@@ -0,0 +1,466 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_ARRAY_PUSH_RELABEL_MAX_FLOW_HPP
+#define BOOST_GRAPH_ARRAY_PUSH_RELABEL_MAX_FLOW_HPP
+
+/*
+  The push-relabel maximum flow algorithm of push_relabel_max_flow, with
+  the vertices of each distance kept in lists that are linked through two
+  arrays indexed by vertex, instead of in std::list layers.  Making a
+  vertex active or inactive thus only rewrites a few entries of these
+  arrays, and the algorithm allocates no memory after it starts.
+
+  The active vertex to discharge is either one with the highest distance
+  or the one that became active first, and the global relabeling and gap
+  heuristics can be tuned or turned off (B. V. Cherkassky and
+  A. V. Goldberg, "On Implementing the Push-Relabel Method for the Maximum
+  Flow Problem", Algorithmica 19, 1997).
+
+  The first phase computes a maximum preflow, and the second returns the
+  excess left at the vertices that cannot reach the sink to the source, by
+  running the same push-relabel loop towards the source with the sink
+  blocked.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+/** Tuning of array_push_relabel_max_flow.
+ *
+ * strategy selects the active vertex to discharge next: highest_label
+ * takes one with the highest distance, fifo the one that became active
+ * first.  The distances are recomputed by a breadth-first search from the
+ * sink each time the work done by relabeling, times
+ * global_update_frequency, exceeds 6 V + E / 2; zero only does it at the
+ * start of each phase.  gap_relabeling removes the vertices above a
+ * distance that no vertex has any more.
+ */
+struct push_relabel_options
+{
+    enum strategy_type
+    {
+        highest_label,
+        fifo
+    };
+
+    explicit push_relabel_options(strategy_type strategy = highest_label,
+        double global_update_frequency = 0.5, bool gap_relabeling = true)
+    : strategy(strategy)
+    , global_update_frequency(global_update_frequency)
+    , gap_relabeling(gap_relabeling)
+    {
+    }
+
+    strategy_type strategy;
+    double global_update_frequency;
+    bool gap_relabeling;
+};
+
+namespace detail
+{
+    template < class Graph, class EdgeCapacityMap,
+        class ResidualCapacityEdgeMap, class ReverseEdgeMap,
+        class VertexIndexMap, class FlowValue >
+    class array_push_relabel
+    {
+    public:
+        typedef graph_traits< Graph > Traits;
+        typedef typename Traits::vertex_descriptor vertex_descriptor;
+        typedef typename Traits::edge_descriptor edge_descriptor;
+        typedef typename Traits::vertex_iterator vertex_iterator;
+        typedef typename Traits::out_edge_iterator out_edge_iterator;
+
+        array_push_relabel(Graph& g, EdgeCapacityMap capacity,
+            ResidualCapacityEdgeMap residual_capacity,
+            ReverseEdgeMap reverse_edge, VertexIndexMap index,
+            const push_relabel_options& options)
+        : g(g)
+        , n(num_vertices(g))
+        , capacity(capacity)
+        , residual_capacity(residual_capacity)
+        , reverse_edge(reverse_edge)
+        , index(index)
+        , options(options)
+        , vertex(n)
+        , current(n)
+        , excess(n, 0)
+        , distance(n, n)
+        , next(n)
+        , prev(n)
+        , bfs_order(n)
+        , layers(n + 1)
+        , queue(n)
+        , max_distance(0)
+        {
+            // The relabeling work that triggers a global relabeling
+            nm = 6 * n + num_edges(g) / 2;
+            vertex_iterator u, u_end;
+            for (boost::tie(u, u_end) = vertices(g); u != u_end; ++u)
+                vertex[get(index, *u)] = *u;
+        }
+
+        FlowValue maximum_flow(vertex_descriptor src, vertex_descriptor sink)
+        {
+            vertex_iterator u, u_end;
+            out_edge_iterator a, a_end;
+            for (boost::tie(u, u_end) = vertices(g); u != u_end; ++u)
+                for (boost::tie(a, a_end) = out_edges(*u, g); a != a_end; ++a)
+                    put(residual_capacity, *a, get(capacity, *a));
+
+            for (boost::tie(a, a_end) = out_edges(src, g); a != a_end; ++a)
+                if (target(*a, g) != src)
+                {
+                    FlowValue delta = get(residual_capacity, *a);
+                    put(residual_capacity, *a, 0);
+                    edge_descriptor rev = get(reverse_edge, *a);
+                    put(residual_capacity, rev,
+                        get(residual_capacity, rev) + delta);
+                    excess[get(index, target(*a, g))] += delta;
+                }
+
+            // Phase one computes a maximum preflow; phase two returns the
+            // excess that cannot reach the sink to the source
+            run(get(index, sink), get(index, src));
+            FlowValue flow = excess[get(index, sink)];
+            run(get(index, src), get(index, sink));
+            return flow;
+        }
+
+    private:
+        static const std::size_t npos = std::size_t(-1);
+
+        // The heads of the lists of the active and inactive vertices of a
+        // distance
+        struct layer
+        {
+            layer() : active(npos), inactive(npos) {}
+
+            std::size_t active, inactive;
+        };
+
+        void insert(std::size_t& head, std::size_t v)
+        {
+            next[v] = head;
+            prev[v] = npos;
+            if (head != npos)
+                prev[head] = v;
+            head = v;
+        }
+
+        void erase(std::size_t& head, std::size_t v)
+        {
+            if (prev[v] != npos)
+                next[prev[v]] = next[v];
+            else
+                head = next[v];
+            if (next[v] != npos)
+                prev[next[v]] = prev[v];
+        }
+
+        void add_to_active_list(std::size_t v)
+        {
+            insert(layers[distance[v]].active, v);
+            if (options.strategy == push_relabel_options::fifo)
+            {
+                queue[queue_last] = v;
+                queue_last = (queue_last + 1 == n ? 0 : queue_last + 1);
+                ++queue_size;
+            }
+            else
+                max_active = (std::max)(max_active, distance[v]);
+        }
+
+        // Pushes flow from every vertex with excess towards the target,
+        // whose distance is zero, while the blocked vertex keeps distance
+        // n and never becomes active
+        void run(std::size_t target_index, std::size_t blocked_index)
+        {
+            t = target_index;
+            blocked = blocked_index;
+            global_relabel();
+            while (true)
+            {
+                std::size_t u;
+                if (options.strategy == push_relabel_options::fifo)
+                {
+                    if (queue_size == 0)
+                        break;
+                    u = queue[queue_first];
+                    queue_first = (queue_first + 1 == n ? 0 : queue_first + 1);
+                    --queue_size;
+                    // Left behind by a gap
+                    if (distance[u] >= n)
+                        continue;
+                }
+                else
+                {
+                    while (max_active > 0 && layers[max_active].active == npos)
+                        --max_active;
+                    u = layers[max_active].active;
+                    if (u == npos)
+                        break;
+                }
+                erase(layers[distance[u]].active, u);
+                discharge(u);
+
+                if (options.global_update_frequency > 0
+                    && double(work) * options.global_update_frequency
+                        > double(nm))
+                    global_relabel();
+            }
+        }
+
+        // The distances to the target in the residual graph, by a
+        // breadth-first search along the reverse residual edges
+        void global_relabel()
+        {
+            for (std::size_t d = 0; d <= max_distance; ++d)
+                layers[d] = layer();
+            std::fill(distance.begin(), distance.end(), n);
+            max_distance = max_active = 0;
+            queue_first = queue_last = queue_size = 0;
+            work = 0;
+
+            std::vector< std::size_t >& order = bfs_order;
+            std::size_t first = 0, last = 0;
+            distance[t] = 0;
+            order[last++] = t;
+            while (first != last)
+            {
+                std::size_t v = order[first++];
+                std::size_t d = distance[v] + 1;
+                out_edge_iterator a, a_end;
+                for (boost::tie(a, a_end) = out_edges(vertex[v], g);
+                     a != a_end; ++a)
+                {
+                    std::size_t w = get(index, target(*a, g));
+                    if (distance[w] == n && w != blocked
+                        && get(residual_capacity, get(reverse_edge, *a)) > 0)
+                    {
+                        distance[w] = d;
+                        order[last++] = w;
+                    }
+                }
+            }
+
+            for (std::size_t k = 1; k < last; ++k)
+            {
+                std::size_t w = order[k];
+                current[w] = out_edges(vertex[w], g);
+                max_distance = distance[w];
+                if (excess[w] > 0)
+                    add_to_active_list(w);
+                else
+                    insert(layers[distance[w]].inactive, w);
+            }
+        }
+
+        void discharge(std::size_t u)
+        {
+            BOOST_ASSERT(excess[u] > 0);
+            while (true)
+            {
+                std::size_t du = distance[u];
+                out_edge_iterator a = current[u].first,
+                                  a_end = current[u].second;
+                for (; a != a_end; ++a)
+                {
+                    FlowValue r = get(residual_capacity, *a);
+                    if (r == 0)
+                        continue;
+                    std::size_t v = get(index, target(*a, g));
+                    if (distance[v] + 1 != du)
+                        continue;
+                    if (v != t && excess[v] == 0)
+                    {
+                        erase(layers[distance[v]].inactive, v);
+                        add_to_active_list(v);
+                    }
+                    FlowValue delta = (std::min)(excess[u], r);
+                    put(residual_capacity, *a, r - delta);
+                    edge_descriptor rev = get(reverse_edge, *a);
+                    put(residual_capacity, rev,
+                        get(residual_capacity, rev) + delta);
+                    excess[u] -= delta;
+                    excess[v] += delta;
+                    if (excess[u] == 0)
+                        break;
+                }
+
+                if (a != a_end)
+                {
+                    current[u].first = a;
+                    insert(layers[du].inactive, u);
+                    return;
+                }
+                if (options.gap_relabeling && layers[du].active == npos
+                    && layers[du].inactive == npos)
+                {
+                    gap(du);
+                    distance[u] = n;
+                    return;
+                }
+                if (!relabel(u))
+                    return;
+            }
+        }
+
+        // Sets the distance of u to one more than the smallest distance of
+        // the target of a residual edge, or n if that is n or more
+        bool relabel(std::size_t u)
+        {
+            work += 12;
+            std::size_t min_distance = n;
+            out_edge_iterator a, a_end, min_edge;
+            for (boost::tie(a, a_end) = out_edges(vertex[u], g); a != a_end;
+                 ++a)
+            {
+                ++work;
+                if (get(residual_capacity, *a) > 0)
+                {
+                    std::size_t d = distance[get(index, target(*a, g))];
+                    if (d < min_distance)
+                    {
+                        min_distance = d;
+                        min_edge = a;
+                    }
+                }
+            }
+            if (min_distance + 1 >= n)
+            {
+                distance[u] = n;
+                return false;
+            }
+            distance[u] = min_distance + 1;
+            current[u] = std::make_pair(min_edge, a_end);
+            max_distance = (std::max)(max_distance, distance[u]);
+            return true;
+        }
+
+        // No vertex has distance empty_distance, so those above cannot
+        // reach the target
+        void gap(std::size_t empty_distance)
+        {
+            for (std::size_t d = empty_distance + 1; d <= max_distance; ++d)
+            {
+                for (std::size_t v = layers[d].active; v != npos; v = next[v])
+                    distance[v] = n;
+                for (std::size_t v = layers[d].inactive; v != npos;
+                     v = next[v])
+                    distance[v] = n;
+                layers[d] = layer();
+            }
+            max_distance = empty_distance - 1;
+            max_active = (std::min)(max_active, max_distance);
+        }
+
+        Graph& g;
+        std::size_t n;
+        std::size_t nm;
+        EdgeCapacityMap capacity;
+        ResidualCapacityEdgeMap residual_capacity;
+        ReverseEdgeMap reverse_edge;
+        VertexIndexMap index;
+        push_relabel_options options;
+
+        // By vertex index
+        std::vector< vertex_descriptor > vertex;
+        std::vector< std::pair< out_edge_iterator, out_edge_iterator > >
+            current;
+        std::vector< FlowValue > excess;
+        std::vector< std::size_t > distance;
+        std::vector< std::size_t > next, prev;
+        std::vector< std::size_t > bfs_order;
+
+        // By distance
+        std::vector< layer > layers;
+
+        // The active vertices in the order they became active, for fifo
+        std::vector< std::size_t > queue;
+        std::size_t queue_first, queue_last, queue_size;
+
+        std::size_t t, blocked;
+        std::size_t max_distance, max_active;
+        std::size_t work;
+    };
+
+    template < class Graph, class EdgeCapacityMap,
+        class ResidualCapacityEdgeMap, class ReverseEdgeMap,
+        class VertexIndexMap, class FlowValue >
+    const std::size_t array_push_relabel< Graph, EdgeCapacityMap,
+        ResidualCapacityEdgeMap, ReverseEdgeMap, VertexIndexMap,
+        FlowValue >::npos;
+} // namespace detail
+
+/** Maximum flow by the push-relabel method with array-backed lists.
+ *
+ * The parameters and the result are those of push_relabel_max_flow; the
+ * options select the active vertex to discharge and tune the heuristics.
+ */
+template < class Graph, class CapacityEdgeMap, class ResidualCapacityEdgeMap,
+    class ReverseEdgeMap, class VertexIndexMap >
+typename property_traits< CapacityEdgeMap >::value_type
+array_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink, CapacityEdgeMap cap,
+    ResidualCapacityEdgeMap res, ReverseEdgeMap rev, VertexIndexMap index_map,
+    const push_relabel_options& options = push_relabel_options())
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    typedef typename property_traits< CapacityEdgeMap >::value_type FlowValue;
+
+    detail::array_push_relabel< Graph, CapacityEdgeMap,
+        ResidualCapacityEdgeMap, ReverseEdgeMap, VertexIndexMap, FlowValue >
+        algo(g, cap, res, rev, index_map, options);
+    return algo.maximum_flow(src, sink);
+}
+
+template < class Graph, class P, class T, class R >
+typename detail::edge_capacity_value< Graph, P, T, R >::type
+array_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink,
+    const bgl_named_params< P, T, R >& params,
+    const push_relabel_options& options = push_relabel_options())
+{
+    return array_push_relabel_max_flow(g, src, sink,
+        choose_const_pmap(get_param(params, edge_capacity), g, edge_capacity),
+        choose_pmap(get_param(params, edge_residual_capacity), g,
+            edge_residual_capacity),
+        choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        options);
+}
+
+template < class Graph >
+typename property_traits<
+    typename property_map< Graph, edge_capacity_t >::const_type >::value_type
+array_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink,
+    const push_relabel_options& options = push_relabel_options())
+{
+    bgl_named_params< int, buffer_param_t > params(0); // bogus empty param
+    return array_push_relabel_max_flow(g, src, sink, params, options);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_ARRAY_PUSH_RELABEL_MAX_FLOW_HPP
@@ -21,6 +21,7 @@
 #include <boost/graph/relax.hpp>
 #include <boost/graph/exception.hpp>
 #include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/search_workspace.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
 #include <boost/graph/property_maps/constant_property_map.hpp>
@@ -276,6 +277,40 @@ inline void astar_search_no_init(const VertexListGraph& g,
     breadth_first_visit(g, s, Q, bfs_vis, color);
 }
 
+// Start a new query on the workspace and search with its labels and queue,
+// in time proportional to the vertices reached
+template < typename VertexListGraph, typename AStarHeuristic,
+    typename AStarVisitor, typename Distance, typename VertexIndexMap,
+    typename WeightMap >
+inline void astar_search_no_init(const VertexListGraph& g,
+    typename graph_traits< VertexListGraph >::vertex_descriptor s,
+    AStarHeuristic h, AStarVisitor vis,
+    search_workspace< VertexListGraph, Distance, VertexIndexMap >& workspace,
+    WeightMap weight)
+{
+    typedef search_workspace< VertexListGraph, Distance, VertexIndexMap >
+        Workspace;
+    typedef typename Workspace::queue_type MutableQueue;
+    typedef closed_plus< Distance > Combine;
+    typedef std::less< Distance > Compare;
+
+    workspace.new_query();
+    put(workspace.distance_map(), s, Distance());
+    put(workspace.cost_map(), s, h(s));
+    MutableQueue& Q = workspace.cost_queue();
+    detail::astar_bfs_visitor< AStarHeuristic, AStarVisitor, MutableQueue,
+        typename Workspace::predecessor_map_type,
+        typename Workspace::cost_map_type,
+        typename Workspace::distance_map_type, WeightMap,
+        typename Workspace::color_map_type, Combine, Compare >
+        bfs_vis(h, vis, Q, workspace.predecessor_map(), workspace.cost_map(),
+            workspace.distance_map(), weight, workspace.color_map(),
+            Combine((std::numeric_limits< Distance >::max)()), Compare(),
+            Distance());
+
+    breadth_first_visit(g, s, Q, bfs_vis, workspace.color_map());
+}
+
 namespace graph_detail
 {
     template < typename A, typename B > struct select1st
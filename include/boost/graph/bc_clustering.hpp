@@ -13,7 +13,9 @@
 #include <boost/graph/betweenness_centrality.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/graph_utility.hpp>
+#include <boost/pending/disjoint_sets.hpp>
 #include <boost/pending/indirect_cmp.hpp>
+#include <stack>
 #include <vector>
 #include <boost/property_map/property_map.hpp>
 
@@ -72,12 +74,147 @@ protected:
     T dividend;
 };
 
+/** Edge centrality function object for the betweenness centrality
+ * clustering algorithm that computes the exact edge betweenness
+ * centrality with @ref brandes_betweenness_centrality.
+ */
+struct brandes_edge_betweenness
+{
+    template < typename Graph, typename EdgeCentralityMap,
+        typename VertexIndexMap >
+    void operator()(const Graph& g, EdgeCentralityMap edge_centrality,
+        VertexIndexMap vertex_index) const
+    {
+        brandes_betweenness_centrality(g,
+            edge_centrality_map(edge_centrality)
+                .vertex_index_map(vertex_index));
+    }
+};
+
+/** Edge centrality function object for the betweenness centrality
+ * clustering algorithm that estimates the edge betweenness centrality
+ * with @ref approximate_betweenness_centrality, which is much faster on
+ * large graphs but may remove a different edge when centralities are
+ * close.
+ */
+template < typename Generator > struct approximate_edge_betweenness
+{
+    /**
+     * @param epsilon the additive error of each estimate, relative to
+     * the number of pairs of vertices
+     *
+     * @param delta the probability that some estimate exceeds the error
+     *
+     * @param gen the random number generator used to sample paths
+     */
+    approximate_edge_betweenness(double epsilon, double delta, Generator& gen)
+    : epsilon(epsilon), delta(delta), gen(&gen)
+    {
+    }
+
+    template < typename Graph, typename EdgeCentralityMap,
+        typename VertexIndexMap >
+    void operator()(const Graph& g, EdgeCentralityMap edge_centrality,
+        VertexIndexMap vertex_index) const
+    {
+        approximate_betweenness_centrality(g, epsilon, delta, *gen,
+            edge_centrality_map(edge_centrality)
+                .vertex_index_map(vertex_index));
+    }
+
+protected:
+    double epsilon;
+    double delta;
+    Generator* gen;
+};
+
+template < typename Generator >
+inline approximate_edge_betweenness< Generator >
+make_approximate_edge_betweenness(double epsilon, double delta, Generator& gen)
+{
+    return approximate_edge_betweenness< Generator >(epsilon, delta, gen);
+}
+
+namespace detail
+{
+    namespace graph
+    {
+        /**
+         * Recomputes the edge betweenness centrality of the edges leaving
+         * the affected vertices, summing the dependencies of the affected
+         * sources in vertex order like brandes_betweenness_centrality.
+         * When the affected vertices are a union of (weakly) connected
+         * components, no other source reaches these edges, so the result
+         * is exactly the one of brandes_betweenness_centrality on the
+         * whole graph.
+         */
+        template < typename Graph, typename EdgeCentralityMap,
+            typename VertexIndexMap, typename IncomingMap,
+            typename DistanceMap, typename DependencyMap,
+            typename PathCountMap >
+        void bc_clustering_recompute(const Graph& g,
+            EdgeCentralityMap edge_centrality, VertexIndexMap vertex_index,
+            const std::vector< char >& affected, IncomingMap incoming,
+            DistanceMap distance, DependencyMap dependency,
+            PathCountMap path_count)
+        {
+            typedef typename property_traits< EdgeCentralityMap >::value_type
+                centrality_type;
+            typedef
+                typename graph_traits< Graph >::vertex_iterator vertex_iterator;
+            typedef typename graph_traits< Graph >::edge_iterator edge_iterator;
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            const bool is_undirected
+                = is_convertible< directed_category*, undirected_tag* >::value;
+
+            edge_iterator e, e_end;
+            for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+                if (affected[get(vertex_index, source(*e, g))])
+                    put(edge_centrality, *e, centrality_type(0));
+
+            brandes_unweighted_shortest_paths shortest_paths;
+            std::stack< vertex_descriptor > ordered_vertices;
+            vertex_iterator s, s_end, w, w_end;
+            for (boost::tie(s, s_end) = vertices(g); s != s_end; ++s)
+            {
+                if (!affected[get(vertex_index, *s)])
+                    continue;
+                for (boost::tie(w, w_end) = vertices(g); w != w_end; ++w)
+                {
+                    if (affected[get(vertex_index, *w)])
+                    {
+                        incoming[*w].clear();
+                        put(path_count, *w, 0);
+                        put(dependency, *w, 0);
+                    }
+                }
+                brandes_accumulate_source(g, *s, dummy_property_map(),
+                    edge_centrality, incoming, distance, dependency,
+                    path_count, vertex_index, shortest_paths,
+                    ordered_vertices);
+            }
+
+            if (is_undirected)
+            {
+                centrality_type two(2);
+                for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+                    if (affected[get(vertex_index, source(*e, g))])
+                        put(edge_centrality, *e,
+                            get(edge_centrality, *e) / two);
+            }
+        }
+    }
+} // end namespace detail::graph
+
 /** Graph clustering based on edge betweenness centrality.
  *
  * This algorithm implements graph clustering based on edge
  * betweenness centrality. It is an iterative algorithm, where in each
- * step it compute the edge betweenness centrality (via @ref
- * brandes_betweenness_centrality) and removes the edge with the
+ * step it compute the edge betweenness centrality (via @p
+ * compute_edge_centrality) and removes the edge with the
  * maximum betweenness centrality. The @p done function object
  * determines when the algorithm terminates (the edge found when the
  * algorithm terminates will not be removed).
@@ -106,11 +243,18 @@ protected:
  * property map must model the ReadablePropertyMap concept and its
  * value type must be an integral type. Defaults to
  * @c get(vertex_index, g).
+ *
+ * @param compute_edge_centrality The function object that computes the
+ * edge centralities of the whole graph at each step, called with @p g,
+ * @p edge_centrality and @p vertex_index, such as @ref
+ * brandes_edge_betweenness or @ref approximate_edge_betweenness. When it
+ * is omitted, the exact centralities are updated incrementally.
  */
 template < typename MutableGraph, typename Done, typename EdgeCentralityMap,
-    typename VertexIndexMap >
+    typename VertexIndexMap, typename EdgeBetweenness >
 void betweenness_centrality_clustering(MutableGraph& g, Done done,
-    EdgeCentralityMap edge_centrality, VertexIndexMap vertex_index)
+    EdgeCentralityMap edge_centrality, VertexIndexMap vertex_index,
+    EdgeBetweenness compute_edge_centrality)
 {
     typedef typename property_traits< EdgeCentralityMap >::value_type
         centrality_type;
@@ -128,9 +272,7 @@ void betweenness_centrality_clustering(MutableGraph& g, Done done,
     bool is_done;
     do
     {
-        brandes_betweenness_centrality(g,
-            edge_centrality_map(edge_centrality)
-                .vertex_index_map(vertex_index));
+        compute_edge_centrality(g, edge_centrality, vertex_index);
         std::pair< edge_iterator, edge_iterator > edges_iters = edges(g);
         edge_descriptor e
             = *boost::first_max_element(edges_iters.first, edges_iters.second, cmp);
@@ -140,6 +282,92 @@ void betweenness_centrality_clustering(MutableGraph& g, Done done,
     } while (!is_done && !has_no_edges(g));
 }
 
+/**
+ * \overload
+ *
+ * Computes the exact edge betweenness centrality incrementally. Removing
+ * an edge only changes the centralities within its (weakly) connected
+ * component, so after the first step only the sources and edges of that
+ * component, which may have split in two, are recomputed. The edges
+ * removed and the final centralities are exactly those of the clustering
+ * with @ref brandes_edge_betweenness.
+ */
+template < typename MutableGraph, typename Done, typename EdgeCentralityMap,
+    typename VertexIndexMap >
+void betweenness_centrality_clustering(MutableGraph& g, Done done,
+    EdgeCentralityMap edge_centrality, VertexIndexMap vertex_index)
+{
+    typedef typename property_traits< EdgeCentralityMap >::value_type
+        centrality_type;
+    typedef typename graph_traits< MutableGraph >::edge_iterator edge_iterator;
+    typedef
+        typename graph_traits< MutableGraph >::edge_descriptor edge_descriptor;
+    typedef typename graph_traits< MutableGraph >::vertex_iterator
+        vertex_iterator;
+    typedef typename graph_traits< MutableGraph >::vertices_size_type
+        vertices_size_type;
+    typedef typename graph_traits< MutableGraph >::degree_size_type
+        degree_size_type;
+
+    if (has_no_edges(g))
+        return;
+
+    // Function object that compares the centrality of edges
+    indirect_cmp< EdgeCentralityMap, std::less< centrality_type > > cmp(
+        edge_centrality);
+
+    vertices_size_type n = num_vertices(g);
+    std::vector< std::vector< edge_descriptor > > incoming(n);
+    std::vector< centrality_type > distance(n);
+    std::vector< centrality_type > dependency(n);
+    std::vector< degree_size_type > path_count(n);
+    std::vector< vertices_size_type > rank(n), parent(n);
+    // Initially, all centralities are computed
+    std::vector< char > affected(n, 1);
+
+    bool is_done;
+    do
+    {
+        detail::graph::bc_clustering_recompute(g, edge_centrality,
+            vertex_index, affected,
+            make_iterator_property_map(incoming.begin(), vertex_index),
+            make_iterator_property_map(distance.begin(), vertex_index),
+            make_iterator_property_map(dependency.begin(), vertex_index),
+            make_iterator_property_map(path_count.begin(), vertex_index));
+        std::pair< edge_iterator, edge_iterator > edges_iters = edges(g);
+        edge_descriptor e = *boost::first_max_element(
+            edges_iters.first, edges_iters.second, cmp);
+        is_done = done(get(edge_centrality, e), e, g);
+        if (!is_done)
+        {
+            vertices_size_type u = get(vertex_index, source(e, g));
+            vertices_size_type v = get(vertex_index, target(e, g));
+            remove_edge(e, g);
+
+            // The component of e, now the components of its endpoints
+            disjoint_sets< vertices_size_type*, vertices_size_type* > ds(
+                &rank[0], &parent[0]);
+            for (vertices_size_type i = 0; i < n; ++i)
+                ds.make_set(i);
+            edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+                ds.union_set(
+                    vertices_size_type(get(vertex_index, source(*ei, g))),
+                    vertices_size_type(get(vertex_index, target(*ei, g))));
+            vertices_size_type root_u = ds.find_set(u);
+            vertices_size_type root_v = ds.find_set(v);
+            vertex_iterator w, w_end;
+            for (boost::tie(w, w_end) = vertices(g); w != w_end; ++w)
+            {
+                vertices_size_type root
+                    = ds.find_set(vertices_size_type(get(vertex_index, *w)));
+                affected[get(vertex_index, *w)]
+                    = root == root_u || root == root_v;
+            }
+        }
+    } while (!is_done && !has_no_edges(g));
+}
+
 /**
  * \overload
  */
@@ -9,6 +9,7 @@
 #ifndef BOOST_GRAPH_BRANDES_BETWEENNESS_CENTRALITY_HPP
 #define BOOST_GRAPH_BRANDES_BETWEENNESS_CENTRALITY_HPP
 
+#include <cmath>
 #include <stack>
 #include <vector>
 #include <boost/graph/overloading.hpp>
@@ -16,6 +17,8 @@
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/graph/relax.hpp>
 #include <boost/graph/graph_traits.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/type_traits/is_same.hpp>
@@ -307,6 +310,65 @@ namespace detail
             }
         }
 
+        /**
+         * Runs the shortest paths search from s and adds the dependencies
+         * of s to the vertex and edge centralities. The incoming, path
+         * count and dependency maps must be reset for the vertices
+         * reachable from s.
+         */
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename IncomingMap,
+            typename DistanceMap, typename DependencyMap, typename PathCountMap,
+            typename VertexIndexMap, typename ShortestPaths >
+        void brandes_accumulate_source(const Graph& g,
+            typename graph_traits< Graph >::vertex_descriptor s,
+            CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+            IncomingMap incoming, DistanceMap distance,
+            DependencyMap dependency, PathCountMap path_count,
+            VertexIndexMap vertex_index, ShortestPaths& shortest_paths,
+            std::stack< typename graph_traits< Graph >::vertex_descriptor >&
+                ordered_vertices)
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename property_traits< IncomingMap >::value_type
+                incoming_type;
+            typedef typename incoming_type::iterator incoming_iterator;
+            typedef typename property_traits< DependencyMap >::value_type
+                dependency_type;
+
+            put(path_count, s, 1);
+
+            // Execute the shortest paths algorithm. This will be either
+            // Dijkstra's algorithm or a customized breadth-first search,
+            // depending on whether the graph is weighted or unweighted.
+            shortest_paths(g, s, ordered_vertices, incoming, distance,
+                path_count, vertex_index);
+
+            while (!ordered_vertices.empty())
+            {
+                vertex_descriptor w = ordered_vertices.top();
+                ordered_vertices.pop();
+
+                for (incoming_iterator vw = incoming[w].begin();
+                     vw != incoming[w].end(); ++vw)
+                {
+                    vertex_descriptor v = source(*vw, g);
+                    dependency_type factor
+                        = dependency_type(get(path_count, v))
+                        / dependency_type(get(path_count, w));
+                    factor *= (dependency_type(1) + get(dependency, w));
+                    put(dependency, v, get(dependency, v) + factor);
+                    update_centrality(edge_centrality_map, *vw, factor);
+                }
+
+                if (w != s)
+                {
+                    update_centrality(centrality, w, get(dependency, w));
+                }
+            }
+        }
+
         template < typename Graph, typename CentralityMap,
             typename EdgeCentralityMap, typename IncomingMap,
             typename DistanceMap, typename DependencyMap, typename PathCountMap,
@@ -341,43 +403,11 @@ namespace detail
                     put(path_count, *w, 0);
                     put(dependency, *w, 0);
                 }
-                put(path_count, *s, 1);
-
-                // Execute the shortest paths algorithm. This will be either
-                // Dijkstra's algorithm or a customized breadth-first search,
-                // depending on whether the graph is weighted or unweighted.
-                shortest_paths(g, *s, ordered_vertices, incoming, distance,
-                    path_count, vertex_index);
-
-                while (!ordered_vertices.empty())
-                {
-                    vertex_descriptor w = ordered_vertices.top();
-                    ordered_vertices.pop();
-
-                    typedef typename property_traits< IncomingMap >::value_type
-                        incoming_type;
-                    typedef typename incoming_type::iterator incoming_iterator;
-                    typedef
-                        typename property_traits< DependencyMap >::value_type
-                            dependency_type;
-
-                    for (incoming_iterator vw = incoming[w].begin();
-                         vw != incoming[w].end(); ++vw)
-                    {
-                        vertex_descriptor v = source(*vw, g);
-                        dependency_type factor
-                            = dependency_type(get(path_count, v))
-                            / dependency_type(get(path_count, w));
-                        factor *= (dependency_type(1) + get(dependency, w));
-                        put(dependency, v, get(dependency, v) + factor);
-                        update_centrality(edge_centrality_map, *vw, factor);
-                    }
 
-                    if (w != *s)
-                    {
-                        update_centrality(centrality, w, get(dependency, w));
-                    }
-                }
+                brandes_accumulate_source(g, *s, centrality,
+                    edge_centrality_map, incoming, distance, dependency,
+                    path_count, vertex_index, shortest_paths,
+                    ordered_vertices);
             }
 
             typedef typename graph_traits< Graph >::directed_category
@@ -585,6 +615,389 @@ void brandes_betweenness_centrality(const Graph& g, CentralityMap centrality,
         g, centrality, edge_centrality_map, get(vertex_index, g));
 }
 
+namespace detail
+{
+    namespace graph
+    {
+        /**
+         * Number of samples after which the estimates of the approximate
+         * betweenness centrality are within epsilon of the normalized
+         * betweenness with probability at least 1 - delta, for a graph
+         * whose shortest paths have at most vertex_diameter vertices
+         * (Riondato and Kornaropoulos).
+         */
+        inline std::size_t approximate_betweenness_sample_size(
+            std::size_t vertex_diameter, double epsilon, double delta)
+        {
+            double log_diameter = vertex_diameter > 3
+                ? std::floor(std::log(double(vertex_diameter - 2))
+                    / std::log(2.0))
+                : 0.0;
+            return std::size_t(std::ceil(0.5 / (epsilon * epsilon)
+                * (log_diameter + 1.0 + std::log(1.0 / delta))));
+        }
+
+        /**
+         * Upper bound on the number of vertices of a shortest path.  In an
+         * unweighted undirected graph, each component has at most twice
+         * the eccentricity of any of its vertices plus one, found with a
+         * breadth-first search; otherwise, the number of vertices.
+         */
+        template < typename Graph, typename VertexIndexMap >
+        std::size_t approximate_vertex_diameter(const Graph& g,
+            VertexIndexMap vertex_index, param_not_found)
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            if (!is_convertible< directed_category*, undirected_tag* >::value)
+                return num_vertices(g);
+
+            std::size_t n = num_vertices(g);
+            std::vector< std::size_t > hops(n, std::size_t(-1));
+            std::vector< vertex_descriptor > queue;
+            std::size_t diameter = 1;
+            typename graph_traits< Graph >::vertex_iterator s, s_end;
+            for (boost::tie(s, s_end) = vertices(g); s != s_end; ++s)
+            {
+                if (hops[get(vertex_index, *s)] != std::size_t(-1))
+                    continue;
+                hops[get(vertex_index, *s)] = 0;
+                queue.assign(1, *s);
+                for (std::size_t head = 0; head < queue.size(); ++head)
+                {
+                    std::size_t h = hops[get(vertex_index, queue[head])];
+                    typename graph_traits< Graph >::out_edge_iterator e, e_end;
+                    for (boost::tie(e, e_end) = out_edges(queue[head], g);
+                         e != e_end; ++e)
+                    {
+                        std::size_t& hw
+                            = hops[get(vertex_index, target(*e, g))];
+                        if (hw == std::size_t(-1))
+                        {
+                            hw = h + 1;
+                            queue.push_back(target(*e, g));
+                        }
+                    }
+                }
+                // The last vertex reached is the farthest from s
+                std::size_t eccentricity
+                    = hops[get(vertex_index, queue.back())];
+                diameter = (std::max)(diameter, 2 * eccentricity + 1);
+            }
+            return diameter;
+        }
+
+        template < typename Graph, typename VertexIndexMap,
+            typename WeightMap >
+        std::size_t approximate_vertex_diameter(
+            const Graph& g, VertexIndexMap, WeightMap)
+        {
+            return num_vertices(g);
+        }
+
+        // p (1 - p) for the fraction p of samples that hit an estimate
+        inline double bernoulli_variance(double count, std::size_t samples)
+        {
+            double p = count / double(samples);
+            return p * (1.0 - p);
+        }
+
+        template < typename Iter, typename T >
+        inline void scale_centrality(
+            std::pair< Iter, Iter >, dummy_property_map, const T&)
+        {
+        }
+
+        template < typename Iter, typename CentralityMap, typename T >
+        inline void scale_centrality(std::pair< Iter, Iter > keys,
+            CentralityMap centrality_map, const T& factor)
+        {
+            while (keys.first != keys.second)
+            {
+                put(centrality_map, *keys.first,
+                    factor * get(centrality_map, *keys.first));
+                ++keys.first;
+            }
+        }
+
+        /**
+         * Approximate betweenness centrality by sampling shortest paths.
+         * Each sample is a pair (s, t) of distinct vertices chosen
+         * uniformly at random and a shortest path from s to t chosen
+         * uniformly at random among all of them, found by walking back
+         * from t through the incoming edges recorded by shortest_paths
+         * (one of the functors of the exact algorithm), taking the edge
+         * (v, w) with probability sigma(v) / sigma(w).  The fraction of
+         * samples whose path goes through a vertex or edge estimates its
+         * normalized betweenness.
+         *
+         * The number of samples is at most the Riondato-Kornaropoulos
+         * bound for epsilon and delta / 2.  At sample counts doubling up
+         * to that bound, the empirical Bernstein bound of every estimate
+         * is checked with the rest of delta split over the checks and
+         * estimates, and sampling stops as soon as all of them are within
+         * epsilon.  Returns the number of samples taken.
+         */
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename IncomingMap,
+            typename DistanceMap, typename PathCountMap,
+            typename VertexIndexMap, typename ShortestPaths,
+            typename Generator >
+        std::size_t approximate_betweenness_centrality_impl(const Graph& g,
+            CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+            IncomingMap incoming, DistanceMap distance,
+            PathCountMap path_count, VertexIndexMap vertex_index,
+            ShortestPaths shortest_paths, std::size_t vertex_diameter,
+            double epsilon, double delta, Generator& gen)
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename graph_traits< Graph >::vertex_iterator
+                vertex_iterator;
+            typedef typename graph_traits< Graph >::edge_iterator
+                edge_iterator;
+            typedef typename mpl::if_c<
+                (is_same< CentralityMap, dummy_property_map >::value),
+                EdgeCentralityMap, CentralityMap >::type a_centrality_map;
+            typedef typename property_traits< a_centrality_map >::value_type
+                centrality_type;
+            typedef typename property_traits< IncomingMap >::value_type
+                incoming_type;
+            typedef typename incoming_type::iterator incoming_iterator;
+
+            init_centrality_map(vertices(g), centrality);
+            init_centrality_map(edges(g), edge_centrality_map);
+            std::size_t n = num_vertices(g);
+            if (n < 2)
+                return 0;
+
+            std::vector< vertex_descriptor > vertex_of(n);
+            vertex_iterator vi, vi_end;
+            for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+                vertex_of[get(vertex_index, *vi)] = *vi;
+
+            // Sample counts of the vertices; the edges are counted in
+            // edge_centrality_map itself
+            const bool has_edge_centrality
+                = !is_same< EdgeCentralityMap, dummy_property_map >::value;
+            std::vector< std::size_t > counts(n, 0);
+            std::size_t num_estimates = n;
+            if (has_edge_centrality)
+                num_estimates += num_edges(g);
+
+            const std::size_t max_samples = (std::max)(std::size_t(1),
+                approximate_betweenness_sample_size(
+                    vertex_diameter, epsilon, delta / 2));
+            std::size_t num_checks = 1;
+            std::size_t next_check = max_samples;
+            while (next_check > 64 && num_checks < 16)
+            {
+                next_check = (next_check + 1) / 2;
+                ++num_checks;
+            }
+            const double log_term = std::log(2.0 * double(num_checks)
+                * double(num_estimates) / (delta / 2));
+
+            boost::random::uniform_int_distribution< std::size_t > pick_source(
+                0, n - 1);
+            boost::random::uniform_int_distribution< std::size_t > pick_target(
+                0, n - 2);
+            std::stack< vertex_descriptor > ordered_vertices;
+            std::size_t samples = 0;
+            while (samples < max_samples)
+            {
+                vertex_descriptor s = vertex_of[pick_source(gen)];
+                std::size_t t_index = pick_target(gen);
+                if (t_index >= get(vertex_index, s))
+                    ++t_index;
+                vertex_descriptor t = vertex_of[t_index];
+                ++samples;
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    incoming[vertex_of[i]].clear();
+                    put(path_count, vertex_of[i], 0);
+                }
+                put(path_count, s, 1);
+                shortest_paths(g, s, ordered_vertices, incoming, distance,
+                    path_count, vertex_index);
+                while (!ordered_vertices.empty())
+                    ordered_vertices.pop();
+
+                if (get(path_count, t) != 0)
+                {
+                    // Walk back from t along a random shortest path
+                    vertex_descriptor w = t;
+                    while (w != s)
+                    {
+                        boost::random::uniform_real_distribution< double >
+                            pick(0.0, double(get(path_count, w)));
+                        double r = pick(gen);
+                        incoming_iterator vw = incoming[w].begin();
+                        for (;;)
+                        {
+                            double sigma_v
+                                = double(get(path_count, source(*vw, g)));
+                            incoming_iterator next = vw;
+                            if (r < sigma_v || ++next == incoming[w].end())
+                                break;
+                            r -= sigma_v;
+                            vw = next;
+                        }
+                        update_centrality(
+                            edge_centrality_map, *vw, centrality_type(1));
+                        w = source(*vw, g);
+                        if (w != s)
+                            ++counts[get(vertex_index, w)];
+                    }
+                }
+
+                if (samples == next_check && samples < max_samples)
+                {
+                    // Largest variance of the estimates
+                    double largest = 0.0;
+                    for (std::size_t i = 0; i < n; ++i)
+                        largest = (std::max)(largest,
+                            bernoulli_variance(double(counts[i]), samples));
+                    if (has_edge_centrality)
+                    {
+                        edge_iterator ei, ei_end;
+                        for (boost::tie(ei, ei_end) = edges(g); ei != ei_end;
+                             ++ei)
+                            largest = (std::max)(largest,
+                                bernoulli_variance(
+                                    double(get(edge_centrality_map, *ei)),
+                                    samples));
+                    }
+                    double variance
+                        = largest * double(samples) / double(samples - 1);
+                    double bound
+                        = std::sqrt(2.0 * variance * log_term / double(samples))
+                        + 7.0 * log_term / (3.0 * double(samples - 1));
+                    if (bound <= epsilon)
+                        break;
+                    next_check = (std::min)(2 * next_check, max_samples);
+                }
+            }
+
+            // Scale the fractions of samples to the absolute betweenness
+            // computed by brandes_betweenness_centrality
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            const bool is_undirected
+                = is_convertible< directed_category*, undirected_tag* >::value;
+            centrality_type scale = centrality_type(double(n) * double(n - 1)
+                / (is_undirected ? 2.0 : 1.0) / double(samples));
+            for (std::size_t i = 0; i < n; ++i)
+                update_centrality(centrality, vertex_of[i],
+                    scale * centrality_type(counts[i]));
+            if (has_edge_centrality)
+                scale_centrality(edges(g), edge_centrality_map, scale);
+            return samples;
+        }
+
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename VertexIndexMap,
+            typename WeightMap, typename Generator >
+        std::size_t approximate_betweenness_centrality_dispatch(
+            const Graph& g, CentralityMap centrality,
+            EdgeCentralityMap edge_centrality_map,
+            VertexIndexMap vertex_index, WeightMap weight_map, double epsilon,
+            double delta, Generator& gen)
+        {
+            typedef
+                typename graph_traits< Graph >::edge_descriptor edge_descriptor;
+            typedef typename mpl::if_c<
+                (is_same< CentralityMap, dummy_property_map >::value),
+                EdgeCentralityMap, CentralityMap >::type a_centrality_map;
+            typedef typename property_traits< a_centrality_map >::value_type
+                centrality_type;
+
+            typename graph_traits< Graph >::vertices_size_type V
+                = num_vertices(g);
+            std::vector< std::vector< edge_descriptor > > incoming(V);
+            std::vector< centrality_type > distance(V);
+            std::vector< double > path_count(V);
+            return approximate_betweenness_centrality_impl(g, centrality,
+                edge_centrality_map,
+                make_iterator_property_map(incoming.begin(), vertex_index),
+                make_iterator_property_map(distance.begin(), vertex_index),
+                make_iterator_property_map(path_count.begin(), vertex_index),
+                vertex_index,
+                brandes_dijkstra_shortest_paths< WeightMap >(weight_map),
+                approximate_vertex_diameter(g, vertex_index, weight_map),
+                epsilon, delta, gen);
+        }
+
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename VertexIndexMap,
+            typename Generator >
+        std::size_t approximate_betweenness_centrality_dispatch(
+            const Graph& g, CentralityMap centrality,
+            EdgeCentralityMap edge_centrality_map,
+            VertexIndexMap vertex_index, param_not_found, double epsilon,
+            double delta, Generator& gen)
+        {
+            typedef
+                typename graph_traits< Graph >::edge_descriptor edge_descriptor;
+
+            typename graph_traits< Graph >::vertices_size_type V
+                = num_vertices(g);
+            std::vector< std::vector< edge_descriptor > > incoming(V);
+            std::vector< std::size_t > distance(V);
+            std::vector< double > path_count(V);
+            return approximate_betweenness_centrality_impl(g, centrality,
+                edge_centrality_map,
+                make_iterator_property_map(incoming.begin(), vertex_index),
+                make_iterator_property_map(distance.begin(), vertex_index),
+                make_iterator_property_map(path_count.begin(), vertex_index),
+                vertex_index, brandes_unweighted_shortest_paths(),
+                approximate_vertex_diameter(
+                    g, vertex_index, param_not_found()),
+                epsilon, delta, gen);
+        }
+    }
+} // end namespace detail::graph
+
+/**
+ * Approximates betweenness centrality by sampling shortest paths.
+ *
+ * With probability at least 1 - delta, every vertex (and edge) centrality
+ * is within epsilon times the number of vertex pairs, n (n - 1) for
+ * directed and n (n - 1) / 2 for undirected graphs, of the one computed by
+ * brandes_betweenness_centrality. The named parameters are those of
+ * brandes_betweenness_centrality. Returns the number of paths sampled.
+ */
+template < typename Graph, typename Generator, typename Param, typename Tag,
+    typename Rest >
+std::size_t approximate_betweenness_centrality(const Graph& g,
+    double epsilon, double delta, Generator& gen,
+    const bgl_named_params< Param, Tag, Rest >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph, vertex_list_graph_tag))
+{
+    BOOST_ASSERT(epsilon > 0 && delta > 0 && delta < 1);
+    return detail::graph::approximate_betweenness_centrality_dispatch(g,
+        choose_param(
+            get_param(params, vertex_centrality), dummy_property_map()),
+        choose_param(get_param(params, edge_centrality), dummy_property_map()),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        get_param(params, edge_weight), epsilon, delta, gen);
+}
+
+template < typename Graph, typename CentralityMap, typename Generator >
+std::size_t approximate_betweenness_centrality(const Graph& g,
+    CentralityMap centrality, double epsilon, double delta,
+    Generator& gen BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    BOOST_ASSERT(epsilon > 0 && delta > 0 && delta < 1);
+    return detail::graph::approximate_betweenness_centrality_dispatch(g,
+        centrality, dummy_property_map(), get(vertex_index, g),
+        param_not_found(), epsilon, delta, gen);
+}
+
 /**
  * Converts "absolute" betweenness centrality (as computed by the
  * brandes_betweenness_centrality algorithm) in the centrality map
@@ -0,0 +1,363 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+#define BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+
+/*
+  Point-to-point shortest paths by bidirectional Dijkstra and bidirectional
+  A* search.
+
+  A forward search from s over out-edges and a backward search from t over
+  in-edges are run alternately, each time advancing the one with the
+  smaller queue.  Whenever an edge relaxation reaches a vertex labelled by
+  the other search, the length of the s-t path through it is a candidate
+  for the shortest distance mu.  The search stops as soon as the smallest
+  keys of the two queues add up to at least mu, since no path found later
+  can be shorter.
+
+  Bidirectional A* uses the average potential pi(v) = (h_t(v) - h_s(v)) / 2
+  of a heuristic h_t for the distance to t and a heuristic h_s for the
+  distance from s (T. Ikeda et al., "A fast algorithm for finding better
+  routes by AI search techniques", 1994).  The forward search is keyed by
+  d_f(v) + pi(v) and the backward search by d_b(v) - pi(v); both are then
+  Dijkstra searches on the same graph with non-negative reduced weights
+  w(u, v) - pi(u) + pi(v), and the stopping rule stays the same.  With
+  pi = 0 this is bidirectional Dijkstra.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    template < typename Distance > struct zero_potential
+    {
+        template < typename Vertex > Distance operator()(Vertex) const
+        {
+            return Distance(0);
+        }
+    };
+
+    template < typename TargetHeuristic, typename SourceHeuristic,
+        typename Distance >
+    struct average_potential
+    {
+        average_potential(TargetHeuristic h_target, SourceHeuristic h_source)
+        : m_h_target(h_target), m_h_source(h_source)
+        {
+        }
+
+        template < typename Vertex > Distance operator()(Vertex v) const
+        {
+            return (Distance(m_h_target(v)) - Distance(m_h_source(v))) / 2;
+        }
+
+        TargetHeuristic m_h_target;
+        SourceHeuristic m_h_source;
+    };
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Potential >
+    class bidirectional_search_impl
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        typedef iterator_property_map< Distance*, VertexIndexMap > DistanceMap;
+        typedef iterator_property_map< std::size_t*, VertexIndexMap >
+            IndexInHeapMap;
+        typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
+            std::less< Distance > >
+            Queue;
+
+        // Labels and queue of one of the two searches
+        struct search_state
+        {
+            search_state(std::size_t n, VertexIndexMap index)
+            : distance(n, inf())
+            , key(n)
+            , neighbor(n)
+            , index_in_heap(n, std::size_t(-1))
+            , queue(DistanceMap(&key[0], index),
+                  IndexInHeapMap(&index_in_heap[0], index))
+            {
+            }
+
+            std::vector< Distance > distance;
+            std::vector< Distance > key;
+            // Predecessor in the forward search, successor in the backward
+            // search
+            std::vector< Vertex > neighbor;
+            std::vector< std::size_t > index_in_heap;
+            Queue queue;
+        };
+
+    public:
+        bidirectional_search_impl(const Graph& g, WeightMap weight,
+            VertexIndexMap index, Potential potential)
+        : m_g(g)
+        , m_weight(weight)
+        , m_index(index)
+        , m_potential(potential)
+        , m_forward(num_vertices(g), index)
+        , m_backward(num_vertices(g), index)
+        {
+        }
+
+        template < typename OutputIterator >
+        Distance run(Vertex s, Vertex t, OutputIterator path)
+        {
+            if (s == t)
+            {
+                *path++ = s;
+                return Distance(0);
+            }
+
+            m_mu = inf();
+            m_meet = s;
+            bool met = false;
+            label(m_forward, s, Distance(0), s, m_potential(s));
+            label(m_backward, t, Distance(0), t, -m_potential(t));
+
+            while (!m_forward.queue.empty() && !m_backward.queue.empty())
+            {
+                Distance top_keys = get_key(m_forward, m_forward.queue.top())
+                    + get_key(m_backward, m_backward.queue.top());
+                if (met && !(top_keys < m_mu))
+                    break;
+                if (m_forward.queue.size() <= m_backward.queue.size())
+                    met |= scan_forward();
+                else
+                    met |= scan_backward();
+            }
+            if (!met)
+                return inf();
+
+            // Forward tree from s to the meeting vertex, then backward tree
+            // to t
+            std::vector< Vertex > first_half;
+            for (Vertex v = m_meet; v != s; v = get_neighbor(m_forward, v))
+                first_half.push_back(v);
+            first_half.push_back(s);
+            path = std::copy(first_half.rbegin(), first_half.rend(), path);
+            for (Vertex v = m_meet; v != t;)
+            {
+                v = get_neighbor(m_backward, v);
+                *path++ = v;
+            }
+            return m_mu;
+        }
+
+    private:
+        static Distance inf()
+        {
+            return (std::numeric_limits< Distance >::max)();
+        }
+
+        Distance get_distance(const search_state& state, Vertex v) const
+        {
+            return state.distance[get(m_index, v)];
+        }
+
+        Distance get_key(const search_state& state, Vertex v) const
+        {
+            return state.key[get(m_index, v)];
+        }
+
+        Vertex get_neighbor(const search_state& state, Vertex v) const
+        {
+            return state.neighbor[get(m_index, v)];
+        }
+
+        void label(search_state& state, Vertex v, Distance d, Vertex neighbor,
+            Distance key)
+        {
+            std::size_t i = get(m_index, v);
+            state.distance[i] = d;
+            state.neighbor[i] = neighbor;
+            state.key[i] = key;
+            // A vertex already scanned may only be improved by rounding
+            // errors in the potentials; it is then scanned again
+            state.queue.push_or_update(v);
+        }
+
+        // Relax an edge of the search state, from u to v, and return whether
+        // it found a path from s to t
+        bool relax(search_state& state, const search_state& other, Vertex u,
+            Vertex v, Distance w, Distance sign)
+        {
+            if (w < Distance(0))
+                boost::throw_exception(negative_edge());
+            Distance d = get_distance(state, u) + w;
+            if (!(d < get_distance(state, v)))
+                return false;
+            label(state, v, d, u, d + sign * m_potential(v));
+            Distance other_d = get_distance(other, v);
+            if (other_d == inf())
+                return false;
+            if (d + other_d < m_mu)
+            {
+                m_mu = d + other_d;
+                m_meet = v;
+            }
+            return true;
+        }
+
+        bool scan_forward()
+        {
+            Vertex u = m_forward.queue.top();
+            m_forward.queue.pop();
+            bool met = false;
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(u, m_g); ei != ei_end;
+                 ++ei)
+            {
+                met |= relax(m_forward, m_backward, u, target(*ei, m_g),
+                    get(m_weight, *ei), Distance(1));
+            }
+            return met;
+        }
+
+        bool scan_backward()
+        {
+            Vertex u = m_backward.queue.top();
+            m_backward.queue.pop();
+            bool met = false;
+            typename graph_traits< Graph >::in_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = in_edges(u, m_g); ei != ei_end; ++ei)
+            {
+                met |= relax(m_backward, m_forward, u, source(*ei, m_g),
+                    get(m_weight, *ei), Distance(-1));
+            }
+            return met;
+        }
+
+        const Graph& m_g;
+        WeightMap m_weight;
+        VertexIndexMap m_index;
+        Potential m_potential;
+        search_state m_forward;
+        search_state m_backward;
+        Distance m_mu;
+        Vertex m_meet;
+    };
+} // namespace detail
+
+/* Shortest path from s to t on a graph with non-negative edge weights.
+   The vertices of the path, from s to t, are written to path and its length
+   is returned; if t is not reachable from s, nothing is written and
+   numeric_limits<Distance>::max() is returned.  Throws negative_edge if a
+   negative weight is found.  The distance type is the value type of the
+   weight map and must be an arithmetic type.
+*/
+template < typename Graph, typename WeightMap, typename VertexIndexMap,
+    typename OutputIterator >
+typename property_traits< WeightMap >::value_type
+bidirectional_dijkstra_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, WeightMap weight,
+    VertexIndexMap index, OutputIterator path)
+{
+    BOOST_CONCEPT_ASSERT((BidirectionalGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename property_traits< WeightMap >::value_type Distance;
+    detail::bidirectional_search_impl< Graph, WeightMap, VertexIndexMap,
+        detail::zero_potential< Distance > >
+        impl(g, weight, index, detail::zero_potential< Distance >());
+    return impl.run(s, t, path);
+}
+
+template < typename Graph, typename OutputIterator >
+typename property_traits< typename property_map< Graph,
+    edge_weight_t >::const_type >::value_type
+bidirectional_dijkstra_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, OutputIterator path)
+{
+    return bidirectional_dijkstra_shortest_path(g, s, t, get(edge_weight, g),
+        get(vertex_index, g), path);
+}
+
+// Named parameter variant; accepts weight_map and vertex_index_map
+template < typename Graph, typename OutputIterator, typename P, typename T,
+    typename R >
+typename detail::edge_weight_value< Graph, P, T, R >::type
+bidirectional_dijkstra_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, OutputIterator path,
+    const bgl_named_params< P, T, R >& params)
+{
+    return bidirectional_dijkstra_shortest_path(g, s, t,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        path);
+}
+
+/* Shortest path from s to t by bidirectional A* search.  h_target(v)
+   estimates the distance from v to t and h_source(v) the distance from s to
+   v; both must be consistent (h(u) <= w(u, v) + h(v) for every edge, with
+   h_target(t) = h_source(s) = 0).  The search then settles the same path
+   length as bidirectional_dijkstra_shortest_path, usually exploring fewer
+   vertices.  Since the potentials are halved, the distance type should be
+   a floating-point type.
+*/
+template < typename Graph, typename TargetHeuristic,
+    typename SourceHeuristic, typename WeightMap, typename VertexIndexMap,
+    typename OutputIterator >
+typename property_traits< WeightMap >::value_type
+bidirectional_astar_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t,
+    TargetHeuristic h_target, SourceHeuristic h_source, WeightMap weight,
+    VertexIndexMap index, OutputIterator path)
+{
+    BOOST_CONCEPT_ASSERT((BidirectionalGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename property_traits< WeightMap >::value_type Distance;
+    typedef detail::average_potential< TargetHeuristic, SourceHeuristic,
+        Distance >
+        Potential;
+    detail::bidirectional_search_impl< Graph, WeightMap, VertexIndexMap,
+        Potential >
+        impl(g, weight, index, Potential(h_target, h_source));
+    return impl.run(s, t, path);
+}
+
+// Named parameter variant; accepts weight_map and vertex_index_map
+template < typename Graph, typename TargetHeuristic,
+    typename SourceHeuristic, typename OutputIterator, typename P, typename T,
+    typename R >
+typename detail::edge_weight_value< Graph, P, T, R >::type
+bidirectional_astar_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t,
+    TargetHeuristic h_target, SourceHeuristic h_source, OutputIterator path,
+    const bgl_named_params< P, T, R >& params)
+{
+    return bidirectional_astar_shortest_path(g, s, t, h_target, h_source,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        path);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
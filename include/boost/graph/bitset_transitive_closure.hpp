@@ -0,0 +1,331 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_BITSET_TRANSITIVE_CLOSURE_HPP
+#define BOOST_GRAPH_BITSET_TRANSITIVE_CLOSURE_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/condensation.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // The position of the lowest set bit of a nonzero word
+    inline std::size_t lowest_bit(boost::uint64_t word)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(word);
+#else
+        std::size_t i = 0;
+        for (; !(word & 1); word >>= 1)
+            ++i;
+        return i;
+#endif
+    }
+} // namespace detail
+
+/**
+ * The transitive closure of a directed graph, as one bitset over the
+ * strong components for each strong component, without the closure
+ * edges.
+ *
+ * The components are numbered in a topological order from a depth-first
+ * search, so that those reachable from a component have larger numbers,
+ * and the set of a component only spans the words from the first to the
+ * last one with a bit set, which are usually few since the components
+ * reachable from one tend to follow it.  The sets are computed from the
+ * last component to the first one, each as the union of the sets of its
+ * successors, word by word, skipping the successors already in the
+ * union.
+ *
+ * With a memory budget, in bytes, the sets are only kept for the last
+ * components, as long as their words fit.  Queries from the others search
+ * the condensation, up to the components with a set.  Those queries use
+ * scratch space, so a closure must not be queried by several threads at
+ * once unless all sets fit.
+ */
+template < typename Graph,
+    typename VertexIndexMap =
+        typename property_map< Graph, vertex_index_t >::const_type >
+class bitset_transitive_closure
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+
+public:
+    typedef typename graph_traits< Graph >::vertex_descriptor vertex_type;
+
+    explicit bitset_transitive_closure(
+        const Graph& g, std::size_t memory_budget = 0)
+    : m_vertex_index(get(vertex_index, g))
+    {
+        init(g, memory_budget);
+    }
+
+    bitset_transitive_closure(const Graph& g, std::size_t memory_budget,
+        VertexIndexMap vertex_index)
+    : m_vertex_index(vertex_index)
+    {
+        init(g, memory_budget);
+    }
+
+    // Whether there is a path of at least one edge from u to v
+    bool reachable(vertex_type u, vertex_type v) const
+    {
+        std::size_t cu = m_dag.component[get(m_vertex_index, u)];
+        std::size_t cv = m_dag.component[get(m_vertex_index, v)];
+        if (cu == cv)
+            return m_dag.cyclic[cu] != 0;
+        if (cv < cu)
+            return false;
+        if (cu >= m_first_stored)
+            return test(cu, cv);
+
+        // Components after cv cannot reach it
+        start_search();
+        m_stack.push_back(cu);
+        while (!m_stack.empty())
+        {
+            std::size_t c = m_stack.back();
+            m_stack.pop_back();
+            for (std::size_t j = m_dag.successor_start[c];
+                 j < m_dag.successor_start[c + 1]; ++j)
+            {
+                std::size_t s = m_dag.successors[j];
+                if (s == cv)
+                {
+                    m_stack.clear();
+                    return true;
+                }
+                if (s > cv || !visit(s))
+                    continue;
+                if (s < m_first_stored)
+                    m_stack.push_back(s);
+                else if (test(s, cv))
+                {
+                    m_stack.clear();
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Outputs the vertices v for which reachable(u, v), component by
+    // component
+    template < typename OutputIterator >
+    OutputIterator reachable_from(vertex_type u, OutputIterator out) const
+    {
+        std::size_t cu = m_dag.component[get(m_vertex_index, u)];
+        if (cu >= m_first_stored)
+            return output(m_words.data() + m_row_begin[cu],
+                m_row_first[cu], m_row_size[cu], out);
+
+        // The union of the sets of the components with a set reached,
+        // and of the components without one
+        std::size_t first = m_dag.size(), last = 0;
+        if (m_dag.cyclic[cu])
+            set(m_scratch.data(), cu, first, last);
+        m_stack.push_back(cu);
+        while (!m_stack.empty())
+        {
+            std::size_t c = m_stack.back();
+            m_stack.pop_back();
+            for (std::size_t j = m_dag.successor_start[c];
+                 j < m_dag.successor_start[c + 1]; ++j)
+            {
+                // A component already in the union was visited, or is in
+                // the set of one that was
+                std::size_t s = m_dag.successors[j];
+                if (m_scratch[s / 64] & (boost::uint64_t(1) << (s % 64)))
+                    continue;
+                set(m_scratch.data(), s, first, last);
+                if (s < m_first_stored)
+                    m_stack.push_back(s);
+                else
+                    merge(m_scratch.data(), s, first, last);
+            }
+        }
+        if (first < last)
+        {
+            out = output(m_scratch.data() + first, first, last - first, out);
+            std::fill(m_scratch.data() + first, m_scratch.data() + last,
+                boost::uint64_t(0));
+        }
+        return out;
+    }
+
+    std::size_t num_components() const { return m_dag.size(); }
+
+    // The number of components whose set is kept, the last ones
+    std::size_t num_stored_components() const
+    {
+        return m_dag.size() - m_first_stored;
+    }
+
+    // The size of the sets kept, in bytes
+    std::size_t memory_usage() const
+    {
+        return m_words.size() * sizeof(boost::uint64_t);
+    }
+
+private:
+    void init(const Graph& g, std::size_t memory_budget)
+    {
+        detail::build_topological_condensation(g, m_vertex_index, m_dag);
+        const std::size_t c = m_dag.size();
+        m_vertex_of.resize(num_vertices(g));
+        typename graph_traits< Graph >::vertex_iterator v, v_end;
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+            m_vertex_of[get(m_vertex_index, *v)] = *v;
+
+        m_row_first.assign(c, 0);
+        m_row_begin.assign(c, 0);
+        m_row_size.assign(c, 0);
+        m_scratch.assign((c + 63) / 64, 0);
+        m_stamp.assign(c, 0);
+        m_search = 0;
+        m_first_stored = c;
+        while (m_first_stored > 0)
+        {
+            std::size_t k = m_first_stored - 1;
+            std::size_t first = c, last = 0;
+            if (m_dag.cyclic[k])
+                set(m_scratch.data(), k, first, last);
+            for (std::size_t j = m_dag.successor_start[k];
+                 j < m_dag.successor_start[k + 1]; ++j)
+            {
+                std::size_t s = m_dag.successors[j];
+                // The set of a successor reached by an earlier one is
+                // already in the union
+                if (m_scratch[s / 64] & (boost::uint64_t(1) << (s % 64)))
+                    continue;
+                set(m_scratch.data(), s, first, last);
+                merge(m_scratch.data(), s, first, last);
+            }
+            if (first >= last)
+            {
+                m_first_stored = k;
+                continue;
+            }
+            if (memory_budget != 0
+                && (m_words.size() + last - first) * sizeof(boost::uint64_t)
+                    > memory_budget)
+            {
+                std::fill(m_scratch.data() + first, m_scratch.data() + last,
+                    boost::uint64_t(0));
+                break;
+            }
+            m_row_first[k] = first;
+            m_row_begin[k] = m_words.size();
+            m_row_size[k] = last - first;
+            m_words.insert(m_words.end(), m_scratch.data() + first,
+                m_scratch.data() + last);
+            std::fill(m_scratch.data() + first, m_scratch.data() + last,
+                boost::uint64_t(0));
+            m_first_stored = k;
+        }
+        std::vector< boost::uint64_t >(m_words).swap(m_words);
+    }
+
+    // Whether component t is in the set of component c
+    bool test(std::size_t c, std::size_t t) const
+    {
+        std::size_t w = t / 64;
+        return w >= m_row_first[c] && w - m_row_first[c] < m_row_size[c]
+            && (m_words[m_row_begin[c] + w - m_row_first[c]]
+                   & (boost::uint64_t(1) << (t % 64)));
+    }
+
+    static void set(boost::uint64_t* words, std::size_t t,
+        std::size_t& first, std::size_t& last)
+    {
+        words[t / 64] |= boost::uint64_t(1) << (t % 64);
+        first = (std::min)(first, t / 64);
+        last = (std::max)(last, t / 64 + 1);
+    }
+
+    // Adds the set of component s to words, a loop the compiler can
+    // vectorize
+    void merge(boost::uint64_t* words, std::size_t s, std::size_t& first,
+        std::size_t& last) const
+    {
+        std::size_t size = m_row_size[s];
+        if (size == 0)
+            return;
+        boost::uint64_t* to = words + m_row_first[s];
+        const boost::uint64_t* from = m_words.data() + m_row_begin[s];
+        for (std::size_t i = 0; i < size; ++i)
+            to[i] |= from[i];
+        first = (std::min)(first, m_row_first[s]);
+        last = (std::max)(last, m_row_first[s] + size);
+    }
+
+    template < typename OutputIterator >
+    OutputIterator output(const boost::uint64_t* words, std::size_t first,
+        std::size_t size, OutputIterator out) const
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            for (boost::uint64_t word = words[i]; word != 0;
+                 word &= word - 1)
+            {
+                std::size_t c = (first + i) * 64 + detail::lowest_bit(word);
+                for (std::size_t j = m_dag.member_start[c];
+                     j < m_dag.member_start[c + 1]; ++j)
+                    *out++ = m_vertex_of[m_dag.members[j]];
+            }
+        return out;
+    }
+
+    void start_search() const
+    {
+        if (++m_search == 0)
+        {
+            std::fill(m_stamp.begin(), m_stamp.end(), 0);
+            m_search = 1;
+        }
+    }
+
+    // Marks c as visited by the current search, unless it already is
+    bool visit(std::size_t c) const
+    {
+        if (m_stamp[c] == m_search)
+            return false;
+        m_stamp[c] = m_search;
+        return true;
+    }
+
+    VertexIndexMap m_vertex_index;
+    std::vector< vertex_type > m_vertex_of;
+    detail::topological_condensation m_dag;
+
+    // The set of component c >= m_first_stored is m_row_size[c] words
+    // from m_words[m_row_begin[c]], for components 64 * m_row_first[c] on
+    std::size_t m_first_stored;
+    std::vector< std::size_t > m_row_first;
+    std::vector< std::size_t > m_row_begin;
+    std::vector< std::size_t > m_row_size;
+    std::vector< boost::uint64_t > m_words;
+
+    // The state of the searches from the components without a set
+    mutable std::vector< boost::uint64_t > m_scratch;
+    mutable std::vector< std::size_t > m_stamp;
+    mutable std::size_t m_search;
+    mutable std::vector< std::size_t > m_stack;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_BITSET_TRANSITIVE_CLOSURE_HPP
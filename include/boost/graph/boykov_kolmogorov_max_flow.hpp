@@ -44,6 +44,7 @@
 #include <boost/limits.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/none_t.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/named_function_params.hpp>
 #include <boost/graph/lookup_edge.hpp>
@@ -60,6 +61,12 @@
 //
 // Kolmogorov, V. "Graph Based Algorithms for Scene Reconstruction from Two or
 // More Views". PhD thesis, Cornell University, Sep 2003.
+//
+// The incremental version for dynamic graph cuts follows:
+//
+// Kohli, P., Torr, P. H. S. "Dynamic Graph Cuts for Efficient Inference in
+// Markov Random Fields", In IEEE Transactions on Pattern Analysis and Machine
+// Intelligence, vol. 29, no. 12, pp. 2079-2088, Dec 2007.
 
 namespace boost
 {
@@ -144,7 +151,19 @@ namespace detail
         {
             // augment direct paths from SOURCE->SINK and SOURCE->VERTEX->SINK
             augment_direct_paths();
-            // start the main-loop
+            augment_paths();
+            return m_flow;
+        }
+
+        // the complete class is protected, as we want access to members in
+        // derived test-class (see test/boykov_kolmogorov_max_flow_test.cpp)
+    protected:
+        /**
+         * the main-loop: grows the search trees from the active vertices and
+         * augments the paths found, until no more paths are left
+         */
+        void augment_paths()
+        {
             while (true)
             {
                 bool path_found;
@@ -160,12 +179,8 @@ namespace detail
                 augment(connecting_edge); // augment that path
                 adopt(); // rebuild search tree structure
             }
-            return m_flow;
         }
 
-        // the complete class is protected, as we want access to members in
-        // derived test-class (see test/boykov_kolmogorov_max_flow_test.cpp)
-    protected:
         void augment_direct_paths()
         {
             // in a first step, we augment all direct paths from
@@ -1062,6 +1077,412 @@ boykov_kolmogorov_max_flow(Graph& g,
     return boykov_kolmogorov_max_flow(g, src, sink, params);
 }
 
+/**
+ * incremental version for dynamic graph cuts (see Kohli and Torr above).
+ * The residual graph and the search trees are kept between calls of
+ * max_flow(). Capacity changes given to add_capacity() are applied to the
+ * residual graph right away; the next max_flow() only repairs the search
+ * trees around the changed vertices and augments the paths that the changes
+ * opened up. The object keeps property maps into its own buffers, so it can't
+ * be copied.
+ */
+template < class Graph, class EdgeCapacityMap, class ResidualCapacityEdgeMap,
+    class ReverseEdgeMap, class PredecessorMap, class ColorMap,
+    class DistanceMap, class IndexMap >
+class incremental_boykov_kolmogorov_max_flow
+: private detail::bk_max_flow< Graph, EdgeCapacityMap, ResidualCapacityEdgeMap,
+      ReverseEdgeMap, PredecessorMap, ColorMap, DistanceMap, IndexMap >,
+  private noncopyable
+{
+    typedef detail::bk_max_flow< Graph, EdgeCapacityMap,
+        ResidualCapacityEdgeMap, ReverseEdgeMap, PredecessorMap, ColorMap,
+        DistanceMap, IndexMap >
+        base;
+    typedef graph_traits< Graph > tGraphTraits;
+    typedef typename tGraphTraits::vertex_iterator vertex_iterator;
+    typedef typename tGraphTraits::edge_iterator edge_iterator;
+    typedef typename tGraphTraits::out_edge_iterator out_edge_iterator;
+    typedef typename property_traits< ColorMap >::value_type tColorValue;
+    typedef color_traits< tColorValue > tColorTraits;
+
+public:
+    typedef typename property_traits< EdgeCapacityMap >::value_type value_type;
+    typedef typename tGraphTraits::vertex_descriptor vertex_descriptor;
+    typedef typename tGraphTraits::edge_descriptor edge_descriptor;
+
+    incremental_boykov_kolmogorov_max_flow(Graph& g, EdgeCapacityMap cap,
+        ResidualCapacityEdgeMap res, ReverseEdgeMap rev, PredecessorMap pre,
+        ColorMap color, DistanceMap dist, IndexMap idx, vertex_descriptor src,
+        vertex_descriptor sink)
+    : base(g, cap, res, rev, pre, color, dist, idx, src, sink)
+    , m_changed_vec(num_vertices(g), false)
+    , m_changed_map(make_iterator_property_map(m_changed_vec.begin(), idx))
+    , m_offset(0)
+    , m_solved(false)
+    , m_needs_restart(false)
+    {
+        BOOST_CONCEPT_ASSERT((ReadWritePropertyMapConcept< EdgeCapacityMap,
+            edge_descriptor >)); // capacities are updated in place
+        BOOST_ASSERT(num_vertices(g) >= 2 && src != sink);
+    }
+
+    /**
+     * returns the maximum flow of the network with the current capacities.
+     * The first call solves the problem from scratch, later calls start from
+     * the flow and search trees of the previous one.
+     */
+    value_type max_flow()
+    {
+        if (m_needs_restart)
+        {
+            restart();
+        }
+        if (!m_solved)
+        {
+            m_solved = true;
+            return base::max_flow() - m_offset;
+        }
+        ++this->m_time;
+        for (typename std::vector< vertex_descriptor >::const_iterator vi
+             = m_changed.begin();
+             vi != m_changed.end(); ++vi)
+        {
+            put(m_changed_map, *vi, false);
+            update_vertex(*vi);
+        }
+        m_changed.clear();
+        this->adopt();
+        this->augment_paths();
+        return this->m_flow - m_offset;
+    }
+
+    /**
+     * adds delta (which may be negative) to the capacity of e. If the flow
+     * on e exceeds the new capacity, the surplus is rerouted through the
+     * terminal edges of its end points, which raises the capacities of both
+     * terminal edges of a vertex by the same amount and so shifts every cut
+     * by that amount (reparametrization, see Kohli and Torr). That needs
+     * edges from the source and to the sink at the end points; without them
+     * the next max_flow() starts over.
+     */
+    void add_capacity(edge_descriptor e, value_type delta)
+    {
+        put(this->m_cap_map, e, get(this->m_cap_map, e) + delta);
+        BOOST_ASSERT(get(this->m_cap_map, e) >= 0);
+        if (m_needs_restart)
+        {
+            return;
+        }
+        if (!m_solved)
+        {
+            // there is no flow yet
+            put(this->m_res_cap_map, e, get(this->m_cap_map, e));
+            return;
+        }
+        const vertex_descriptor u = source(e, this->m_g);
+        const vertex_descriptor v = target(e, this->m_g);
+        value_type residual = get(this->m_res_cap_map, e) + delta;
+        if (residual < 0)
+        {
+            // reduce the flow on e to the new capacity, leaving an excess at
+            // u and a deficit at v
+            const value_type surplus = -residual;
+            const edge_descriptor rev = get(this->m_rev_edge_map, e);
+            put(this->m_res_cap_map, rev,
+                get(this->m_res_cap_map, rev) - surplus);
+            residual = 0;
+            if (!(drain_excess(u, surplus) && fill_deficit(v, surplus)))
+            {
+                m_needs_restart = true;
+                return;
+            }
+        }
+        put(this->m_res_cap_map, e, residual);
+        mark_changed(u);
+        mark_changed(v);
+    }
+
+    /**
+     * adds source_delta to the capacity of the edge from the source to v and
+     * sink_delta to that of the edge from v to the sink. The edges must exist
+     * if their delta is not zero.
+     */
+    void add_terminal_capacities(
+        vertex_descriptor v, value_type source_delta, value_type sink_delta)
+    {
+        if (source_delta != 0)
+        {
+            add_capacity(from_source(v), source_delta);
+        }
+        if (sink_delta != 0)
+        {
+            add_capacity(to_sink(v), sink_delta);
+        }
+    }
+
+private:
+    /**
+     * lets the excess at u flow to the sink; returns false if the edges
+     * needed for that are missing
+     */
+    bool drain_excess(vertex_descriptor u, value_type excess)
+    {
+        if (u == this->m_source)
+        {
+            this->m_flow -= excess;
+            return true;
+        }
+        if (u == this->m_sink)
+        {
+            return true;
+        }
+        edge_descriptor from_s, to_t;
+        bool has_from_s, has_to_t;
+        boost::tie(from_s, has_from_s)
+            = lookup_edge(u, this->m_source, this->m_g);
+        boost::tie(to_t, has_to_t) = lookup_edge(u, this->m_sink, this->m_g);
+        if (!has_from_s || !has_to_t)
+        {
+            return false;
+        }
+        // raise both terminal capacities by excess and push it to the sink
+        from_s = get(this->m_rev_edge_map, from_s);
+        put(this->m_res_cap_map, from_s,
+            get(this->m_res_cap_map, from_s) + excess);
+        const edge_descriptor from_t = get(this->m_rev_edge_map, to_t);
+        put(this->m_res_cap_map, from_t,
+            get(this->m_res_cap_map, from_t) + excess);
+        m_offset += excess;
+        return true;
+    }
+
+    /**
+     * feeds the deficit at v from the source; returns false if the edges
+     * needed for that are missing
+     */
+    bool fill_deficit(vertex_descriptor v, value_type deficit)
+    {
+        if (v == this->m_source)
+        {
+            this->m_flow += deficit;
+            return true;
+        }
+        if (v == this->m_sink)
+        {
+            return true;
+        }
+        edge_descriptor to_s, to_t;
+        bool has_to_s, has_to_t;
+        boost::tie(to_s, has_to_s) = lookup_edge(v, this->m_source, this->m_g);
+        boost::tie(to_t, has_to_t) = lookup_edge(v, this->m_sink, this->m_g);
+        if (!has_to_s || !has_to_t)
+        {
+            return false;
+        }
+        // raise both terminal capacities by deficit and push it from the
+        // source
+        put(this->m_res_cap_map, to_s,
+            get(this->m_res_cap_map, to_s) + deficit);
+        put(this->m_res_cap_map, to_t,
+            get(this->m_res_cap_map, to_t) + deficit);
+        this->m_flow += deficit;
+        m_offset += deficit;
+        return true;
+    }
+
+    edge_descriptor from_source(vertex_descriptor v) const
+    {
+        edge_descriptor e;
+        bool is_there;
+        boost::tie(e, is_there) = lookup_edge(v, this->m_source, this->m_g);
+        BOOST_ASSERT(is_there);
+        return get(this->m_rev_edge_map, e);
+    }
+
+    edge_descriptor to_sink(vertex_descriptor v) const
+    {
+        edge_descriptor e;
+        bool is_there;
+        boost::tie(e, is_there) = lookup_edge(v, this->m_sink, this->m_g);
+        BOOST_ASSERT(is_there);
+        return e;
+    }
+
+    void mark_changed(vertex_descriptor v)
+    {
+        if (!get(m_changed_map, v))
+        {
+            put(m_changed_map, v, true);
+            m_changed.push_back(v);
+        }
+    }
+
+    /**
+     * repairs the search trees at a vertex whose edges have changed. Like
+     * augment_direct_paths() it first sends flow over the terminal edges of
+     * the vertex, then keeps the invariant the search relies on: a vertex with
+     * an unsaturated edge from the source is in the source tree, one with an
+     * unsaturated edge to the sink in the sink tree, as the terminals never
+     * become active themselves. Other tree vertices whose edge to their parent
+     * got saturated become orphans, and all tree vertices become active again
+     * to look for the paths that the change may have opened up.
+     */
+    void update_vertex(vertex_descriptor v)
+    {
+        if (v == this->m_source || v == this->m_sink)
+        {
+            return;
+        }
+        edge_descriptor to_s, to_t;
+        bool has_to_s, has_to_t;
+        boost::tie(to_s, has_to_s) = lookup_edge(v, this->m_source, this->m_g);
+        boost::tie(to_t, has_to_t) = lookup_edge(v, this->m_sink, this->m_g);
+        const edge_descriptor from_s
+            = has_to_s ? get(this->m_rev_edge_map, to_s) : edge_descriptor();
+        const value_type cap_from_source
+            = has_to_s ? get(this->m_res_cap_map, from_s) : 0;
+        const value_type cap_to_sink
+            = has_to_t ? get(this->m_res_cap_map, to_t) : 0;
+        if (cap_from_source > 0 && cap_to_sink > 0)
+        {
+            BOOST_USING_STD_MIN();
+            const value_type direct = min BOOST_PREVENT_MACRO_SUBSTITUTION(
+                cap_from_source, cap_to_sink);
+            push(from_s, direct);
+            push(to_t, direct);
+            this->m_flow += direct;
+        }
+        if (has_to_s && get(this->m_res_cap_map, from_s) > 0)
+        {
+            join_tree(v, from_s, tColorTraits::black());
+        }
+        else if (has_to_t && get(this->m_res_cap_map, to_t) > 0)
+        {
+            join_tree(v, to_t, tColorTraits::white());
+        }
+        else if (this->get_tree(v) == tColorTraits::gray())
+        {
+            return;
+        }
+        else if (this->has_parent(v)
+            && get(this->m_res_cap_map, this->get_edge_to_parent(v)) == 0)
+        {
+            this->set_no_parent(v);
+            this->m_orphans.push_back(v);
+        }
+        this->add_active_node(v);
+    }
+
+    void push(edge_descriptor e, value_type amount)
+    {
+        const edge_descriptor rev = get(this->m_rev_edge_map, e);
+        put(this->m_res_cap_map, e, get(this->m_res_cap_map, e) - amount);
+        put(this->m_res_cap_map, rev, get(this->m_res_cap_map, rev) + amount);
+    }
+
+    /**
+     * makes the terminal edge e the edge to the parent of v in tree; if v
+     * was in the other tree, it leaves that tree as adopt() lets go of a
+     * vertex: its children there become orphans and its neighbors with an
+     * unsaturated edge towards it become active
+     */
+    void join_tree(vertex_descriptor v, edge_descriptor e, tColorValue tree)
+    {
+        const tColorValue old_tree = this->get_tree(v);
+        if (old_tree != tree && old_tree != tColorTraits::gray())
+        {
+            out_edge_iterator ei, e_end;
+            for (boost::tie(ei, e_end) = out_edges(v, this->m_g); ei != e_end;
+                 ++ei)
+            {
+                const vertex_descriptor other_node = target(*ei, this->m_g);
+                if (this->get_tree(other_node) != old_tree
+                    || other_node == this->m_source
+                    || other_node == this->m_sink)
+                {
+                    continue;
+                }
+                if (get(this->m_res_cap_map,
+                        old_tree == tColorTraits::black()
+                            ? get(this->m_rev_edge_map, *ei)
+                            : *ei)
+                    > 0)
+                {
+                    this->add_active_node(other_node);
+                }
+                if (this->has_parent(other_node))
+                {
+                    const edge_descriptor parent_edge
+                        = this->get_edge_to_parent(other_node);
+                    if ((old_tree == tColorTraits::black()
+                            ? source(parent_edge, this->m_g)
+                            : target(parent_edge, this->m_g))
+                        == v)
+                    {
+                        this->set_no_parent(other_node);
+                        this->m_orphans.push_back(other_node);
+                    }
+                }
+            }
+        }
+        this->set_tree(v, tree);
+        this->set_edge_to_parent(v, e);
+        put(this->m_dist_map, v, 1);
+        put(this->m_time_map, v, this->m_time);
+    }
+
+    /**
+     * drops the flow and the search trees and goes back to the capacities,
+     * as the constructor of bk_max_flow does
+     */
+    void restart()
+    {
+        vertex_iterator vi, v_end;
+        for (boost::tie(vi, v_end) = vertices(this->m_g); vi != v_end; ++vi)
+        {
+            this->set_tree(*vi, tColorTraits::gray());
+            this->set_no_parent(*vi);
+            put(this->m_in_active_list_map, *vi, false);
+            put(this->m_time_map, *vi, 0);
+            put(m_changed_map, *vi, false);
+        }
+        edge_iterator ei, e_end;
+        for (boost::tie(ei, e_end) = edges(this->m_g); ei != e_end; ++ei)
+        {
+            put(this->m_res_cap_map, *ei, get(this->m_cap_map, *ei));
+        }
+        while (!this->m_active_nodes.empty())
+        {
+            this->m_active_nodes.pop();
+        }
+        while (!this->m_child_orphans.empty())
+        {
+            this->m_child_orphans.pop();
+        }
+        this->m_orphans.clear();
+        m_changed.clear();
+        this->set_tree(this->m_source, tColorTraits::black());
+        this->set_tree(this->m_sink, tColorTraits::white());
+        put(this->m_time_map, this->m_source, 1);
+        put(this->m_time_map, this->m_sink, 1);
+        this->m_flow = 0;
+        this->m_time = 1;
+        this->m_last_grow_vertex = graph_traits< Graph >::null_vertex();
+        m_offset = 0;
+        m_solved = false;
+        m_needs_restart = false;
+    }
+
+    std::vector< vertex_descriptor > m_changed;
+    std::vector< bool > m_changed_vec;
+    iterator_property_map< std::vector< bool >::iterator, IndexMap >
+        m_changed_map;
+    value_type m_offset; // sum of the reparametrizations, every cut is that
+                         // much larger than in the given network
+    bool m_solved;
+    bool m_needs_restart;
+};
+
 } // namespace boost
 
 #endif // BOOST_BOYKOV_KOLMOGOROV_MAX_FLOW_HPP
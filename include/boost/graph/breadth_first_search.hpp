@@ -24,6 +24,7 @@
 #include <boost/graph/overloading.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/two_bit_color_map.hpp>
+#include <boost/graph/search_workspace.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
 #include <boost/concept/assert.hpp>
 
@@ -118,6 +119,19 @@ void breadth_first_visit(const IncidenceGraph& g,
     breadth_first_visit(g, sources, sources + 1, Q, vis, color);
 }
 
+// Start a new query on the workspace and use its color map and buffer, in
+// time proportional to the vertices reached
+template < class IncidenceGraph, class Distance, class IndexMap,
+    class BFSVisitor >
+void breadth_first_visit(const IncidenceGraph& g,
+    typename graph_traits< IncidenceGraph >::vertex_descriptor s,
+    search_workspace< IncidenceGraph, Distance, IndexMap >& workspace,
+    BFSVisitor vis)
+{
+    workspace.new_query();
+    breadth_first_visit(g, s, workspace.buffer(), vis, workspace.color_map());
+}
+
 template < class VertexListGraph, class SourceIterator, class Buffer,
     class BFSVisitor, class ColorMap >
 void breadth_first_search(const VertexListGraph& g,
@@ -27,6 +27,7 @@
 #include <boost/graph/filtered_graph.hpp> // For keep_all
 #include <boost/graph/detail/indexed_properties.hpp>
 #include <boost/graph/detail/compressed_sparse_row_struct.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
@@ -135,6 +136,34 @@ enum edges_are_unsorted_global_t
     edges_are_unsorted_global
 };
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+// A type (edges_are_unsorted_multi_pass_parallel_t) and a value
+// (edges_are_unsorted_multi_pass_parallel) used to indicate that the edge list
+// passed into the CSR graph is not sorted by source vertex, and that the graph
+// should be built using several threads.  The degree counts, their partial sum
+// and the placement of the edges are each split among the threads.  Edges with
+// the same source keep their relative order from the input, so the resulting
+// graph is identical to the one built with edges_are_unsorted_multi_pass.  The
+// work is only split if the iterators are random access.
+enum edges_are_unsorted_multi_pass_parallel_t
+{
+    edges_are_unsorted_multi_pass_parallel
+};
+
+// A type (construct_from_sources_and_targets_parallel_t) and a value
+// (construct_from_sources_and_targets_parallel) used to indicate that vectors
+// of sources and targets (and possibly edge properties) are being used to
+// construct the CSR graph using several threads.  Unlike with
+// construct_inplace_from_sources_and_targets, the vectors are not modified:
+// the targets and properties are copied into newly allocated arrays, so both
+// are held in memory at once, and edges with the same source keep their
+// relative order from the vectors, as with edges_are_unsorted_multi_pass.
+enum construct_from_sources_and_targets_parallel_t
+{
+    construct_from_sources_and_targets_parallel
+};
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
 /****************************************************************************
  * Local helper macros to reduce typing and clutter later on.               *
  ****************************************************************************/
@@ -363,6 +392,40 @@ public:
             ep_iter, numlocalverts, global_to_local, source_pred);
     }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+    //  From number of vertices and unsorted list of edges, using num_threads
+    //  threads (0 to use one per hardware thread)
+    template < typename MultiPassInputIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_multi_pass_parallel_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        vertices_size_type numverts, std::size_t num_threads,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_unsorted_multi_pass_edges_parallel(edge_begin,
+            edge_end, numverts,
+            typed_identity_property_map< vertices_size_type >(), keep_all(),
+            pool);
+    }
+
+    //  From number of vertices and unsorted list of edges, plus edge
+    //  properties, using num_threads threads (0 to use one per hardware thread)
+    template < typename MultiPassInputIterator, typename EdgePropertyIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_multi_pass_parallel_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts,
+        std::size_t num_threads, const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_forward(), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_unsorted_multi_pass_edges_parallel(edge_begin,
+            edge_end, ep_iter, numverts,
+            typed_identity_property_map< vertices_size_type >(), keep_all(),
+            pool);
+    }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
     //  From number of vertices and sorted list of edges (new interface)
     template < typename InputIterator >
     compressed_sparse_row_graph(edges_are_sorted_t, InputIterator edge_begin,
@@ -492,6 +555,40 @@ public:
             sources, targets, edge_props, numlocalverts, global_to_local);
     }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+    //  From number of vertices and vectors of sources and targets, using
+    //  num_threads threads (0 to use one per hardware thread).
+    compressed_sparse_row_graph(construct_from_sources_and_targets_parallel_t,
+        const std::vector< vertex_descriptor >& sources,
+        const std::vector< vertex_descriptor >& targets,
+        vertices_size_type numverts,
+        std::size_t num_threads, const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_sources_and_targets_parallel(
+            sources, targets, numverts, pool);
+    }
+
+    //  From number of vertices and vectors of sources, targets, and edge
+    //  properties, using num_threads threads (0 to use one per hardware
+    //  thread).
+    compressed_sparse_row_graph(construct_from_sources_and_targets_parallel_t,
+        const std::vector< vertex_descriptor >& sources,
+        const std::vector< vertex_descriptor >& targets,
+        const std::vector<
+            typename forward_type::inherited_edge_properties::edge_bundled >&
+            edge_props,
+        vertices_size_type numverts, std::size_t num_threads,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_sources_and_targets_parallel(
+            sources, targets, edge_props, numverts, pool);
+    }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
     //  From number of vertices and single-pass range of unsorted edges.  Data
     //  is cached in coordinate form before creating the actual graph.
     template < typename InputIterator >
@@ -922,6 +1019,14 @@ private:
             typed_identity_property_map< Vertex >(), keep_all());
     }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+    void set_up_backward_property_links(
+        boost::graph::detail::thread_pool& pool)
+    {
+        m_backward.assign_transpose_parallel(m_forward, pool);
+    }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
 public:
     //  From number of vertices and unsorted list of edges
     template < typename MultiPassInputIterator >
@@ -982,6 +1087,40 @@ public:
         set_up_backward_property_links();
     }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+    //  From number of vertices and unsorted list of edges, using num_threads
+    //  threads (0 to use one per hardware thread)
+    template < typename MultiPassInputIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_multi_pass_parallel_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        vertices_size_type numverts, std::size_t num_threads,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_unsorted_multi_pass_edges_parallel(edge_begin,
+            edge_end, numverts, typed_identity_property_map< Vertex >(),
+            keep_all(), pool);
+        set_up_backward_property_links(pool);
+    }
+
+    //  From number of vertices and unsorted list of edges, plus edge
+    //  properties, using num_threads threads (0 to use one per hardware thread)
+    template < typename MultiPassInputIterator, typename EdgePropertyIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_multi_pass_parallel_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts,
+        std::size_t num_threads, const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_forward(), m_property(prop)
+    {
+        boost::graph::detail::thread_pool pool(num_threads);
+        m_forward.assign_unsorted_multi_pass_edges_parallel(edge_begin,
+            edge_end, ep_iter, numverts,
+            typed_identity_property_map< Vertex >(), keep_all(), pool);
+        set_up_backward_property_links(pool);
+    }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
     //   Requires IncidenceGraph and a vertex index map
     template < typename Graph, typename VertexIndexMap >
     compressed_sparse_row_graph(const Graph& g, const VertexIndexMap& vi,
@@ -1290,6 +1429,12 @@ inline EdgeIndex in_degree(Vertex v, const BOOST_BIDIR_CSR_GRAPH_TYPE& g)
     return next_row_start - v_row_start;
 }
 
+template < BOOST_BIDIR_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex degree(Vertex v, const BOOST_BIDIR_CSR_GRAPH_TYPE& g)
+{
+    return in_degree(v, g) + out_degree(v, g);
+}
+
 // From AdjacencyGraph
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline std::pair< typename BOOST_CSR_GRAPH_TYPE::adjacency_iterator,
@@ -0,0 +1,911 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+#define BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+
+/*
+  Contraction hierarchies (R. Geisberger, P. Sanders, D. Schultes and
+  D. Delling, "Contraction hierarchies: faster and simpler hierarchical
+  routing in road networks", 2008).
+
+  Preprocessing removes ("contracts") the vertices one at a time in order
+  of importance.  When v is contracted, a shortcut (u, x) of weight
+  w(u, v) + w(v, x) is added for each pair of remaining neighbors whose
+  shortest path may go through v, that is unless a local Dijkstra search
+  from u that avoids v finds a witness path to x that is not longer.  The
+  rank of a vertex is its position in the contraction order.  Every
+  shortest path of the input graph then has a shortest path of the same
+  length in the graph augmented with the shortcuts that first only goes up
+  in rank and then only goes down, so that a query only needs an upward
+  search from s and an upward search from t over the reversed edges.
+
+  The contraction order is kept in a d_ary_heap_indirect keyed by twice
+  the edge difference (the number of shortcuts the contraction of a vertex
+  would add minus the number of its edges) plus the number of edges to
+  contracted neighbors, which spreads the contractions over the graph.
+  Keys of neighbors are recomputed after a contraction and are updated
+  lazily when they grow.
+  With several threads, each round takes up to a few vertices per thread
+  from the front of the queue that are pairwise non-adjacent, so their
+  witness searches can run concurrently, then applies the shortcuts and
+  recomputes the keys of their neighbors concurrently.  The witness
+  searches of a round avoid all vertices contracted in that round, so the
+  witness paths they find remain in the graph.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/vector.hpp>
+
+namespace boost
+{
+
+// Edge of the search graphs of a contraction hierarchy.  middle is the
+// vertex bypassed by a shortcut, or null_vertex() for an edge of the input
+// graph.
+template < typename Weight, typename Vertex = std::size_t >
+struct contraction_hierarchy_edge
+{
+    contraction_hierarchy_edge() : weight(), middle(null_vertex()) {}
+
+    contraction_hierarchy_edge(Weight weight, Vertex middle)
+    : weight(weight), middle(middle)
+    {
+    }
+
+    static Vertex null_vertex()
+    {
+        return (std::numeric_limits< Vertex >::max)();
+    }
+
+    Weight weight;
+    Vertex middle;
+};
+
+namespace detail
+{
+    // Called from contraction_hierarchy, whose num_vertices() hides the
+    // free function
+    template < typename Graph >
+    std::size_t ch_num_vertices(const Graph& g)
+    {
+        return num_vertices(g);
+    }
+
+    // Contraction of a graph into the edges of a contraction hierarchy.
+    // The remaining graph is kept as lists of out-arcs and in-arcs with at
+    // most one arc, the shortest, between two vertices.
+    template < typename Weight, typename Vertex > class ch_contraction
+    {
+    public:
+        typedef contraction_hierarchy_edge< Weight, Vertex > edge_property;
+
+        // Edge of a search graph of the hierarchy
+        struct hierarchy_edge
+        {
+            hierarchy_edge(Vertex source, Vertex target, edge_property property)
+            : source(source), target(target), property(property)
+            {
+            }
+
+            Vertex source;
+            Vertex target;
+            edge_property property;
+        };
+
+        explicit ch_contraction(std::size_t n)
+        : m_out(n), m_in(n), m_contracted_arcs(n, 0), m_contracting(n, 0)
+        {
+        }
+
+        void add_edge(Vertex u, Vertex v, Weight w)
+        {
+            if (u != v)
+                m_out[u].push_back(arc(v, w, edge_property::null_vertex()));
+        }
+
+        // Contract all vertices.  rank receives the position of each vertex
+        // in the contraction order, upward the edges (u, v) with
+        // rank[u] < rank[v] and downward the edges (v, u) for the edges
+        // (u, v) with rank[u] > rank[v].
+        void run(std::size_t num_threads, std::vector< Vertex >& rank,
+            std::vector< hierarchy_edge >& upward,
+            std::vector< hierarchy_edge >& downward);
+
+    private:
+        // Arc of the remaining graph to or from other
+        struct arc
+        {
+            arc(Vertex other, Weight weight, Vertex middle)
+            : other(other), weight(weight), middle(middle)
+            {
+            }
+
+            bool operator<(const arc& a) const
+            {
+                return other < a.other
+                    || (other == a.other && weight < a.weight);
+            }
+
+            Vertex other;
+            Weight weight;
+            Vertex middle;
+        };
+
+        struct shortcut
+        {
+            shortcut(Vertex source, Vertex target, Weight weight)
+            : source(source), target(target), weight(weight)
+            {
+            }
+
+            Vertex source;
+            Vertex target;
+            Weight weight;
+        };
+
+        typedef std::vector< arc > arc_list;
+
+        // Witness searches of one thread, each costing O(touched) to reset
+        class witness_search : boost::noncopyable
+        {
+            typedef iterator_property_map< Weight*, identity_property_map >
+                DistanceMap;
+            typedef iterator_property_map< std::size_t*,
+                identity_property_map >
+                IndexInHeapMap;
+            typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap,
+                DistanceMap, std::less< Weight > >
+                Queue;
+
+        public:
+            // Witness searches give up after settling this many vertices,
+            // which may only add superfluous shortcuts
+            static const std::size_t settle_limit = 500;
+
+            explicit witness_search(std::size_t n)
+            : m_distance(n, inf())
+            , m_index_in_heap(n, std::size_t(-1))
+            , m_target(n, 0)
+            , m_queue(DistanceMap(&m_distance[0]),
+                  IndexInHeapMap(&m_index_in_heap[0]))
+            {
+            }
+
+            // Shortcuts needed if v is contracted
+            void find_shortcuts(const ch_contraction& c, Vertex v,
+                std::vector< shortcut >& shortcuts)
+            {
+                shortcuts.clear();
+                const arc_list& in = c.m_in[v];
+                const arc_list& out = c.m_out[v];
+                for (std::size_t i = 0; i < in.size(); ++i)
+                {
+                    Vertex u = in[i].other;
+                    std::size_t targets = 0;
+                    Weight limit = Weight(0);
+                    for (std::size_t j = 0; j < out.size(); ++j)
+                    {
+                        if (out[j].other != u)
+                        {
+                            limit = (std::max)(
+                                limit, Weight(in[i].weight + out[j].weight));
+                            m_target[out[j].other] = 1;
+                            ++targets;
+                        }
+                    }
+                    if (targets == 0)
+                        continue;
+                    search(c, u, v, limit, targets);
+                    for (std::size_t j = 0; j < out.size(); ++j)
+                    {
+                        Weight via = in[i].weight + out[j].weight;
+                        m_target[out[j].other] = 0;
+                        if (out[j].other != u && via < m_distance[out[j].other])
+                            shortcuts.push_back(
+                                shortcut(u, out[j].other, via));
+                    }
+                    reset();
+                }
+            }
+
+        private:
+            static Weight inf()
+            {
+                return (std::numeric_limits< Weight >::max)();
+            }
+
+            // Distances from u avoiding v, exact up to limit or until all
+            // targets are settled
+            void search(const ch_contraction& c, Vertex u, Vertex v,
+                Weight limit, std::size_t targets)
+            {
+                m_distance[u] = Weight(0);
+                m_touched.push_back(u);
+                m_queue.push(u);
+                std::size_t settled = 0;
+                while (!m_queue.empty())
+                {
+                    Vertex x = m_queue.top();
+                    if (limit < m_distance[x] || ++settled > settle_limit)
+                        break;
+                    m_queue.pop();
+                    if (m_target[x] && --targets == 0)
+                        break;
+                    const arc_list& arcs = c.m_out[x];
+                    for (std::size_t i = 0; i < arcs.size(); ++i)
+                    {
+                        Vertex y = arcs[i].other;
+                        Weight d = m_distance[x] + arcs[i].weight;
+                        if (y == v || c.m_contracting[y]
+                            || !(d < m_distance[y]))
+                            continue;
+                        if (m_distance[y] == inf())
+                            m_touched.push_back(y);
+                        m_distance[y] = d;
+                        m_queue.push_or_update(y);
+                    }
+                }
+            }
+
+            void reset()
+            {
+                while (!m_queue.empty())
+                    m_queue.pop();
+                for (std::size_t i = 0; i < m_touched.size(); ++i)
+                    m_distance[m_touched[i]] = inf();
+                m_touched.clear();
+            }
+
+            std::vector< Weight > m_distance;
+            std::vector< std::size_t > m_index_in_heap;
+            std::vector< char > m_target;
+            std::vector< Vertex > m_touched;
+            Queue m_queue;
+        };
+
+        // Keep a single arc, the shortest, between two vertices
+        void remove_parallel_arcs()
+        {
+            std::size_t n = m_out.size();
+            for (std::size_t u = 0; u < n; ++u)
+            {
+                arc_list& out = m_out[u];
+                std::sort(out.begin(), out.end());
+                std::size_t kept = 0;
+                for (std::size_t i = 0; i < out.size(); ++i)
+                {
+                    if (kept == 0 || out[kept - 1].other != out[i].other)
+                        out[kept++] = out[i];
+                }
+                out.erase(out.begin() + kept, out.end());
+                for (std::size_t i = 0; i < out.size(); ++i)
+                    m_in[out[i].other].push_back(
+                        arc(Vertex(u), out[i].weight, out[i].middle));
+            }
+        }
+
+        // Add the arc (u, v) or shorten the existing one
+        void relax_arc(Vertex u, Vertex v, Weight w, Vertex middle)
+        {
+            arc_list& out = m_out[u];
+            for (std::size_t i = 0; i < out.size(); ++i)
+            {
+                if (out[i].other != v)
+                    continue;
+                if (w < out[i].weight)
+                {
+                    out[i].weight = w;
+                    out[i].middle = middle;
+                    arc_list& in = m_in[v];
+                    for (std::size_t j = 0; j < in.size(); ++j)
+                    {
+                        if (in[j].other == u)
+                        {
+                            in[j].weight = w;
+                            in[j].middle = middle;
+                            break;
+                        }
+                    }
+                }
+                return;
+            }
+            out.push_back(arc(v, w, middle));
+            m_in[v].push_back(arc(u, w, middle));
+        }
+
+        static void remove_arc(arc_list& arcs, Vertex other)
+        {
+            for (std::size_t i = 0; i < arcs.size(); ++i)
+            {
+                if (arcs[i].other == other)
+                {
+                    arcs[i] = arcs.back();
+                    arcs.pop_back();
+                    return;
+                }
+            }
+        }
+
+        long priority(witness_search& search, Vertex v,
+            std::vector< shortcut >& shortcuts) const
+        {
+            search.find_shortcuts(*this, v, shortcuts);
+            return 2 * long(shortcuts.size())
+                - 2 * long(m_in[v].size() + m_out[v].size())
+                + long(m_contracted_arcs[v]);
+        }
+
+        // Move the arcs of v to the hierarchy and add its shortcuts
+        void contract(Vertex v, const std::vector< shortcut >& shortcuts,
+            std::vector< hierarchy_edge >& upward,
+            std::vector< hierarchy_edge >& downward)
+        {
+            arc_list& out = m_out[v];
+            for (std::size_t i = 0; i < out.size(); ++i)
+            {
+                upward.push_back(hierarchy_edge(v, out[i].other,
+                    edge_property(out[i].weight, out[i].middle)));
+                remove_arc(m_in[out[i].other], v);
+                ++m_contracted_arcs[out[i].other];
+            }
+            arc_list& in = m_in[v];
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                downward.push_back(hierarchy_edge(v, in[i].other,
+                    edge_property(in[i].weight, in[i].middle)));
+                remove_arc(m_out[in[i].other], v);
+                ++m_contracted_arcs[in[i].other];
+            }
+            arc_list().swap(out);
+            arc_list().swap(in);
+            for (std::size_t i = 0; i < shortcuts.size(); ++i)
+                relax_arc(shortcuts[i].source, shortcuts[i].target,
+                    shortcuts[i].weight, v);
+        }
+
+        std::vector< arc_list > m_out;
+        std::vector< arc_list > m_in;
+        // Number of arcs to contracted neighbors, counted in the priority
+        std::vector< std::size_t > m_contracted_arcs;
+        // Whether a vertex is contracted in the current round
+        std::vector< char > m_contracting;
+    };
+
+    template < typename Weight, typename Vertex >
+    void ch_contraction< Weight, Vertex >::run(std::size_t num_threads,
+        std::vector< Vertex >& rank, std::vector< hierarchy_edge >& upward,
+        std::vector< hierarchy_edge >& downward)
+    {
+        typedef iterator_property_map< long*, identity_property_map > KeyMap;
+        typedef iterator_property_map< std::size_t*, identity_property_map >
+            IndexInHeapMap;
+        typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, KeyMap,
+            std::less< long > >
+            Queue;
+
+        const std::size_t n = m_out.size();
+        rank.assign(n, Vertex(0));
+        if (n == 0)
+            return;
+        remove_parallel_arcs();
+
+        boost::graph::detail::thread_pool pool(num_threads);
+        std::vector< std::unique_ptr< witness_search > > searches;
+        std::vector< std::vector< shortcut > > scratch(pool.size());
+        for (std::size_t i = 0; i < pool.size(); ++i)
+            searches.push_back(
+                std::unique_ptr< witness_search >(new witness_search(n)));
+
+        // priorities holds the current priority of each vertex and keys its
+        // key in the queue, which is not greater
+        std::vector< long > priorities(n), keys(n);
+        std::vector< std::size_t > index_in_heap(n, std::size_t(-1));
+        KeyMap key_map(&keys[0]);
+        Queue order(key_map, IndexInHeapMap(&index_in_heap[0]));
+        pool.for_each_block(
+            n, [&](std::size_t i, std::size_t first, std::size_t last) {
+                for (std::size_t v = first; v < last; ++v)
+                    priorities[v] = this->priority(
+                        *searches[i], Vertex(v), scratch[i]);
+            });
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            keys[v] = priorities[v];
+            order.push(Vertex(v));
+        }
+
+        const std::size_t batch_limit
+            = pool.size() == 1 ? 1 : 16 * pool.size();
+        std::vector< std::size_t > round_of(n, 0);
+        std::vector< Vertex > batch, deferred, neighbors;
+        std::vector< std::vector< shortcut > > shortcuts;
+        Vertex next_rank = 0;
+        for (std::size_t round = 1; !order.empty(); ++round)
+        {
+            // Take non-adjacent vertices from the front of the queue
+            batch.clear();
+            deferred.clear();
+            neighbors.clear();
+            for (std::size_t taken = 0;
+                 !order.empty() && taken < batch_limit;)
+            {
+                Vertex v = order.top();
+                order.pop();
+                if (keys[v] < priorities[v])
+                {
+                    keys[v] = priorities[v];
+                    order.push(v);
+                    continue;
+                }
+                ++taken;
+                if (round_of[v] == round)
+                {
+                    deferred.push_back(v);
+                    continue;
+                }
+                batch.push_back(v);
+                for (int side = 0; side < 2; ++side)
+                {
+                    const arc_list& arcs = side == 0 ? m_out[v] : m_in[v];
+                    for (std::size_t i = 0; i < arcs.size(); ++i)
+                    {
+                        Vertex w = arcs[i].other;
+                        if (round_of[w] != round)
+                        {
+                            round_of[w] = round;
+                            neighbors.push_back(w);
+                        }
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < deferred.size(); ++i)
+                order.push(deferred[i]);
+
+            shortcuts.resize(batch.size());
+            for (std::size_t j = 0; j < batch.size(); ++j)
+                m_contracting[batch[j]] = 1;
+            pool.for_each_block(batch.size(),
+                [&](std::size_t i, std::size_t first, std::size_t last) {
+                    for (std::size_t j = first; j < last; ++j)
+                        searches[i]->find_shortcuts(
+                            *this, batch[j], shortcuts[j]);
+                });
+            for (std::size_t j = 0; j < batch.size(); ++j)
+            {
+                m_contracting[batch[j]] = 0;
+                rank[batch[j]] = next_rank++;
+                contract(batch[j], shortcuts[j], upward, downward);
+            }
+
+            pool.for_each_block(neighbors.size(),
+                [&](std::size_t i, std::size_t first, std::size_t last) {
+                    for (std::size_t j = first; j < last; ++j)
+                        priorities[neighbors[j]] = this->priority(
+                            *searches[i], neighbors[j], scratch[i]);
+                });
+            for (std::size_t j = 0; j < neighbors.size(); ++j)
+            {
+                Vertex w = neighbors[j];
+                if (priorities[w] < keys[w])
+                {
+                    keys[w] = priorities[w];
+                    order.update(w);
+                }
+            }
+        }
+    }
+}
+
+/** A contraction hierarchy of a graph with non-negative edge weights.
+ *
+ * Vertices are identified by their index in [0, num_vertices()).  The
+ * upward graph holds the edges (u, v) of the input graph and the shortcuts
+ * with rank(u) < rank(v), and the downward graph the reversed edges (v, u)
+ * of those with rank(u) > rank(v), so both only lead up in rank.  The
+ * hierarchy can be saved and loaded with Boost.Serialization.
+ */
+template < typename Weight, typename Vertex = std::size_t >
+class contraction_hierarchy
+{
+public:
+    typedef Weight weight_type;
+    typedef Vertex vertex_type;
+    typedef contraction_hierarchy_edge< Weight, Vertex > edge_property_type;
+    typedef compressed_sparse_row_graph< directedS, no_property,
+        edge_property_type, no_property, Vertex >
+        search_graph_type;
+
+    contraction_hierarchy() {}
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap >
+    contraction_hierarchy(const Graph& g, WeightMap weight,
+        VertexIndexMap index, std::size_t num_threads = 0)
+    {
+        build(g, weight, index, num_threads);
+    }
+
+    template < typename Graph >
+    explicit contraction_hierarchy(const Graph& g, std::size_t num_threads = 0)
+    {
+        build(g, get(edge_weight, g), get(vertex_index, g), num_threads);
+    }
+
+    std::size_t num_vertices() const { return m_rank.size(); }
+
+    // Position of v in the contraction order
+    Vertex rank(Vertex v) const { return m_rank[v]; }
+
+    const search_graph_type& upward_graph() const { return m_upward; }
+
+    const search_graph_type& downward_graph() const { return m_downward; }
+
+    std::size_t num_shortcuts() const
+    {
+        return count_shortcuts(m_upward) + count_shortcuts(m_downward);
+    }
+
+    template < typename Archive >
+    void save(Archive& ar, const unsigned int /*version*/) const
+    {
+        ar << serialization::make_nvp("rank", m_rank);
+        save_graph(ar, m_upward);
+        save_graph(ar, m_downward);
+    }
+
+    template < typename Archive >
+    void load(Archive& ar, const unsigned int /*version*/)
+    {
+        ar >> serialization::make_nvp("rank", m_rank);
+        load_graph(ar, m_upward);
+        load_graph(ar, m_downward);
+    }
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+private:
+    typedef detail::ch_contraction< Weight, Vertex > contraction;
+    typedef typename contraction::hierarchy_edge hierarchy_edge;
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap >
+    void build(const Graph& g, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads)
+    {
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        typedef typename graph_traits< Graph >::vertex_iterator VertexIter;
+        typedef typename graph_traits< Graph >::out_edge_iterator OutEdgeIter;
+
+        std::size_t n = detail::ch_num_vertices(g);
+        contraction c(n);
+        VertexIter vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            OutEdgeIter ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end;
+                 ++ei)
+            {
+                Weight w = get(weight, *ei);
+                if (w < Weight(0))
+                    boost::throw_exception(negative_edge());
+                c.add_edge(Vertex(get(index, *vi)),
+                    Vertex(get(index, target(*ei, g))), w);
+            }
+        }
+
+        std::vector< hierarchy_edge > upward, downward;
+        c.run(num_threads, m_rank, upward, downward);
+        make_graph(upward, n, m_upward);
+        make_graph(downward, n, m_downward);
+    }
+
+    static void make_graph(const std::vector< hierarchy_edge >& edges,
+        std::size_t n, search_graph_type& g)
+    {
+        std::vector< std::pair< Vertex, Vertex > > endpoints;
+        std::vector< edge_property_type > properties;
+        endpoints.reserve(edges.size());
+        properties.reserve(edges.size());
+        for (std::size_t i = 0; i < edges.size(); ++i)
+        {
+            endpoints.push_back(
+                std::make_pair(edges[i].source, edges[i].target));
+            properties.push_back(edges[i].property);
+        }
+        g = search_graph_type(edges_are_unsorted_multi_pass, endpoints.begin(),
+            endpoints.end(), properties.begin(), Vertex(n));
+    }
+
+    static std::size_t count_shortcuts(const search_graph_type& g)
+    {
+        std::size_t count = 0;
+        BGL_FORALL_EDGES_T(e, g, search_graph_type)
+        {
+            if (g[e].middle != edge_property_type::null_vertex())
+                ++count;
+        }
+        return count;
+    }
+
+    // The edges of g in CSR order, so sources are sorted on load
+    template < typename Archive >
+    static void save_graph(Archive& ar, const search_graph_type& g)
+    {
+        std::vector< Vertex > sources, targets, middles;
+        std::vector< Weight > weights;
+        BGL_FORALL_EDGES_T(e, g, search_graph_type)
+        {
+            sources.push_back(source(e, g));
+            targets.push_back(target(e, g));
+            weights.push_back(g[e].weight);
+            middles.push_back(g[e].middle);
+        }
+        ar << serialization::make_nvp("sources", sources);
+        ar << serialization::make_nvp("targets", targets);
+        ar << serialization::make_nvp("weights", weights);
+        ar << serialization::make_nvp("middles", middles);
+    }
+
+    template < typename Archive >
+    void load_graph(Archive& ar, search_graph_type& g) const
+    {
+        std::vector< Vertex > sources, targets, middles;
+        std::vector< Weight > weights;
+        ar >> serialization::make_nvp("sources", sources);
+        ar >> serialization::make_nvp("targets", targets);
+        ar >> serialization::make_nvp("weights", weights);
+        ar >> serialization::make_nvp("middles", middles);
+        std::vector< std::pair< Vertex, Vertex > > endpoints;
+        std::vector< edge_property_type > properties;
+        for (std::size_t i = 0; i < sources.size(); ++i)
+        {
+            endpoints.push_back(std::make_pair(sources[i], targets[i]));
+            properties.push_back(edge_property_type(weights[i], middles[i]));
+        }
+        g = search_graph_type(edges_are_sorted, endpoints.begin(),
+            endpoints.end(), properties.begin(), Vertex(m_rank.size()));
+    }
+
+    std::vector< Vertex > m_rank;
+    search_graph_type m_upward;
+    search_graph_type m_downward;
+};
+
+/** Point-to-point shortest path queries on a contraction hierarchy.
+ *
+ * An upward search from s in the upward graph and an upward search from t
+ * in the downward graph are run alternately until the smallest keys of
+ * both queues are at least the length of the shortest path found through a
+ * vertex settled by both.  The labels are reset in time proportional to
+ * the number of vertices touched, so a query object should be reused.
+ */
+template < typename Weight, typename Vertex = std::size_t >
+class contraction_hierarchy_query : boost::noncopyable
+{
+public:
+    typedef contraction_hierarchy< Weight, Vertex > hierarchy_type;
+
+    explicit contraction_hierarchy_query(const hierarchy_type& ch)
+    : m_ch(ch)
+    , m_forward(ch.num_vertices())
+    , m_backward(ch.num_vertices())
+    {
+    }
+
+    // Length of a shortest path from s to t, or
+    // std::numeric_limits<Weight>::max() if t is not reachable
+    Weight distance(Vertex s, Vertex t)
+    {
+        Vertex meet;
+        return search(s, t, meet);
+    }
+
+    // Also write the vertices of the path from s to t to path
+    template < typename OutputIterator >
+    Weight shortest_path(Vertex s, Vertex t, OutputIterator path)
+    {
+        Vertex meet;
+        Weight dist = search(s, t, meet);
+        if (dist == inf())
+            return dist;
+
+        std::vector< Vertex > upward;
+        for (Vertex v = meet; v != s; v = m_forward.parent[v])
+            upward.push_back(v);
+        *path++ = s;
+        Vertex u = s;
+        for (std::size_t i = upward.size(); i-- > 0;)
+        {
+            unpack(u, upward[i], m_forward.middle[upward[i]], path);
+            u = upward[i];
+        }
+        for (; u != t; u = m_backward.parent[u])
+            unpack(u, m_backward.parent[u], m_backward.middle[u], path);
+        return dist;
+    }
+
+private:
+    typedef typename hierarchy_type::search_graph_type Graph;
+    typedef typename hierarchy_type::edge_property_type edge_property;
+    typedef iterator_property_map< Weight*, identity_property_map >
+        DistanceMap;
+    typedef iterator_property_map< std::size_t*, identity_property_map >
+        IndexInHeapMap;
+    typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
+        std::less< Weight > >
+        Queue;
+
+    // Labels and queue of one of the two searches.  parent and middle
+    // describe the edge through which a vertex was reached.
+    struct search_state : boost::noncopyable
+    {
+        explicit search_state(std::size_t n)
+        : distance((std::max)(n, std::size_t(1)), inf())
+        , parent(distance.size())
+        , middle(distance.size())
+        , index_in_heap(distance.size(), std::size_t(-1))
+        , queue(DistanceMap(&distance[0]), IndexInHeapMap(&index_in_heap[0]))
+        {
+        }
+
+        void reset()
+        {
+            while (!queue.empty())
+                queue.pop();
+            for (std::size_t i = 0; i < touched.size(); ++i)
+                distance[touched[i]] = inf();
+            touched.clear();
+        }
+
+        void label(Vertex v, Weight d, Vertex p, Vertex m)
+        {
+            if (distance[v] == inf())
+                touched.push_back(v);
+            distance[v] = d;
+            parent[v] = p;
+            middle[v] = m;
+            queue.push_or_update(v);
+        }
+
+        std::vector< Weight > distance;
+        std::vector< Vertex > parent;
+        std::vector< Vertex > middle;
+        std::vector< std::size_t > index_in_heap;
+        std::vector< Vertex > touched;
+        Queue queue;
+    };
+
+    static Weight inf() { return (std::numeric_limits< Weight >::max)(); }
+
+    static Vertex null_vertex() { return edge_property::null_vertex(); }
+
+    Weight search(Vertex s, Vertex t, Vertex& meet)
+    {
+        BOOST_ASSERT(s < m_ch.num_vertices() && t < m_ch.num_vertices());
+        m_forward.reset();
+        m_backward.reset();
+        Weight mu = inf();
+        meet = null_vertex();
+        m_forward.label(s, Weight(0), s, null_vertex());
+        m_backward.label(t, Weight(0), t, null_vertex());
+        bool forward = true;
+        for (;;)
+        {
+            bool forward_active = !m_forward.queue.empty()
+                && m_forward.distance[m_forward.queue.top()] < mu;
+            bool backward_active = !m_backward.queue.empty()
+                && m_backward.distance[m_backward.queue.top()] < mu;
+            if (!forward_active && !backward_active)
+                break;
+            if (!forward_active || !backward_active)
+                forward = forward_active;
+
+            search_state& state = forward ? m_forward : m_backward;
+            const search_state& other = forward ? m_backward : m_forward;
+            const Graph& g
+                = forward ? m_ch.upward_graph() : m_ch.downward_graph();
+            Vertex u = state.queue.top();
+            state.queue.pop();
+            Weight du = state.distance[u];
+            if (other.distance[u] != inf() && du + other.distance[u] < mu)
+            {
+                mu = du + other.distance[u];
+                meet = u;
+            }
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+            {
+                Vertex v = target(*ei, g);
+                Weight d = du + g[*ei].weight;
+                if (d < state.distance[v])
+                    state.label(v, d, u, g[*ei].middle);
+            }
+            forward = !forward;
+        }
+        return mu;
+    }
+
+    // Middle vertex of the edge from u to v in g
+    static Vertex find_middle(const Graph& g, Vertex u, Vertex v)
+    {
+        typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+        {
+            if (target(*ei, g) == v)
+                return g[*ei].middle;
+        }
+        BOOST_ASSERT(false);
+        return null_vertex();
+    }
+
+    // Write the vertices after u of the path represented by the edge from u
+    // to v bypassing middle
+    template < typename OutputIterator >
+    void unpack(Vertex u, Vertex v, Vertex middle, OutputIterator& path)
+    {
+        m_stack.clear();
+        m_stack.push_back(segment(u, v, middle));
+        while (!m_stack.empty())
+        {
+            segment s = m_stack.back();
+            m_stack.pop_back();
+            if (s.middle == null_vertex())
+            {
+                *path++ = s.target;
+                continue;
+            }
+            // The middle vertex has the lowest rank: the edge to it is
+            // stored reversed in the downward graph, the edge from it in
+            // the upward graph
+            m_stack.push_back(segment(s.middle, s.target,
+                find_middle(m_ch.upward_graph(), s.middle, s.target)));
+            m_stack.push_back(segment(s.source, s.middle,
+                find_middle(m_ch.downward_graph(), s.middle, s.source)));
+        }
+    }
+
+    struct segment
+    {
+        segment(Vertex source, Vertex target, Vertex middle)
+        : source(source), target(target), middle(middle)
+        {
+        }
+
+        Vertex source;
+        Vertex target;
+        Vertex middle;
+    };
+
+    const hierarchy_type& m_ch;
+    search_state m_forward;
+    search_state m_backward;
+    std::vector< segment > m_stack;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
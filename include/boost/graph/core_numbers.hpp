@@ -15,6 +15,12 @@
 #include <boost/graph/breadth_first_search.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
 #include <boost/concept/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 /*
  * core_numbers
@@ -370,6 +376,176 @@ typename property_traits< CoreMap >::value_type weighted_core_numbers(
     return core_numbers(g, c, get(edge_weight, g), get(vertex_index, g), vis);
 }
 
+namespace detail
+{
+    // The degree and the position in the bucket order of a vertex, side by
+    // side since the bucket algorithm always reads both
+    template < typename Index > struct bucket_core_slot
+    {
+        Index degree;
+        Index pos;
+    };
+
+    // The number of edges into each vertex, by vertex index: the
+    // out-degree for undirected graphs, the in-degree for bidirectional
+    // ones, and otherwise counted over all the out-edges
+    template < typename Graph, typename VertexIndexMap >
+    void in_degrees_by_index(const Graph& g, VertexIndexMap vertex_index,
+        std::vector< std::size_t >& degree, undirected_tag)
+    {
+        typename graph_traits< Graph >::vertex_iterator v, v_end;
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+            degree[get(vertex_index, *v)] = out_degree(*v, g);
+    }
+
+    template < typename Graph, typename VertexIndexMap >
+    void in_degrees_by_index(const Graph& g, VertexIndexMap vertex_index,
+        std::vector< std::size_t >& degree, bidirectional_tag)
+    {
+        typename graph_traits< Graph >::vertex_iterator v, v_end;
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+            degree[get(vertex_index, *v)] = in_degree(*v, g);
+    }
+
+    template < typename Graph, typename VertexIndexMap >
+    void in_degrees_by_index(const Graph& g, VertexIndexMap vertex_index,
+        std::vector< std::size_t >& degree, directed_tag)
+    {
+        typename graph_traits< Graph >::vertex_iterator v, v_end;
+        typename graph_traits< Graph >::out_edge_iterator e, e_end;
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+            for (boost::tie(e, e_end) = out_edges(*v, g); e != e_end; ++e)
+                ++degree[get(vertex_index, target(*e, g))];
+    }
+
+    // The bucket algorithm on flat arrays of Index, which must hold the
+    // number of vertices and the largest degree. Replaces the degrees,
+    // by vertex index, with the core numbers, leaves the vertices in the
+    // order of their removal in vert, and returns the largest core number.
+    template < typename Index, typename Graph, typename VertexIndexMap >
+    std::size_t bucket_core_numbers_impl(const Graph& g,
+        VertexIndexMap vertex_index,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        std::vector< std::size_t >& degree, std::size_t max_degree,
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >& vert)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+        const std::size_t n = vertex_of.size();
+        std::vector< bucket_core_slot< Index > > slot(n);
+
+        // bin[d] is the position in vert of the first vertex of degree d
+        std::vector< Index > bin(max_degree + 2, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            ++bin[degree[i] + 1];
+        for (std::size_t d = 0; d <= max_degree; ++d)
+            bin[d + 1] += bin[d];
+        vert.resize(n);
+        {
+            std::vector< Index > next(bin.begin(), bin.end() - 1);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                slot[i].degree = Index(degree[i]);
+                slot[i].pos = next[degree[i]]++;
+                vert[slot[i].pos] = vertex_of[i];
+            }
+        }
+
+        Index level = 0;
+        typename graph_traits< Graph >::out_edge_iterator e, e_end;
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            level = slot[get(vertex_index, vert[p])].degree;
+            for (boost::tie(e, e_end) = out_edges(vert[p], g); e != e_end;
+                 ++e)
+            {
+                vertex j = target(*e, g);
+                bucket_core_slot< Index >& sj = slot[get(vertex_index, j)];
+                if (sj.degree > level)
+                {
+                    // Swap j with the first vertex w of its bucket, then
+                    // shrink the bucket
+                    Index pos_j = sj.pos, pos_w = bin[sj.degree]++;
+                    vertex w = vert[pos_w];
+                    vert[pos_w] = j;
+                    vert[pos_j] = w;
+                    slot[get(vertex_index, w)].pos = pos_j;
+                    sj.pos = pos_w;
+                    --sj.degree;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+            degree[i] = slot[i].degree;
+        return level;
+    }
+
+    // The core numbers of the vertices of vertex_of, by vertex index, and
+    // the order in which the bucket algorithm removes them; returns the
+    // largest core number
+    template < typename Graph, typename VertexIndexMap >
+    std::size_t bucket_core_order(const Graph& g, VertexIndexMap vertex_index,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        std::vector< std::size_t >& core,
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            order)
+    {
+        const std::size_t n = vertex_of.size();
+        core.assign(n, 0);
+        in_degrees_by_index(g, vertex_index, core,
+            typename graph_traits< Graph >::directed_category());
+        std::size_t max_degree = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            max_degree = (std::max)(max_degree, core[i]);
+
+        if ((std::max)(n, max_degree + 1)
+            <= std::size_t((std::numeric_limits< boost::uint32_t >::max)()))
+            return bucket_core_numbers_impl< boost::uint32_t >(
+                g, vertex_index, vertex_of, core, max_degree, order);
+        else
+            return bucket_core_numbers_impl< std::size_t >(
+                g, vertex_index, vertex_of, core, max_degree, order);
+    }
+} // namespace detail
+
+/**
+ * The core numbers of the unweighted case by the bucket algorithm of
+ * Batagelj and Zaversnik, like core_numbers(g, c), but with the degrees,
+ * positions and buckets held in flat arrays by vertex index, of 32 bits
+ * when the graph is small enough. Returns the largest core number.
+ */
+template < typename Graph, typename CoreMap, typename VertexIndexMap >
+typename property_traits< CoreMap >::value_type bucket_core_numbers(
+    const Graph& g, CoreMap c, VertexIndexMap vertex_index)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+    typedef typename property_traits< CoreMap >::value_type core_type;
+
+    const std::size_t n = num_vertices(g);
+    std::vector< vertex > vertex_of(n);
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        vertex_of[get(vertex_index, *vi)] = *vi;
+    std::vector< std::size_t > core;
+    std::vector< vertex > order;
+    std::size_t max_core
+        = detail::bucket_core_order(g, vertex_index, vertex_of, core, order);
+    for (std::size_t i = 0; i < n; ++i)
+        put(c, vertex_of[i], core_type(core[i]));
+    return core_type(max_core);
+}
+
+template < typename Graph, typename CoreMap >
+typename property_traits< CoreMap >::value_type bucket_core_numbers(
+    const Graph& g, CoreMap c)
+{
+    return bucket_core_numbers(g, c, get(vertex_index, g));
+}
+
 } // namespace boost
 
 #endif // BOOST_GRAPH_CORE_NUMBERS_HPP
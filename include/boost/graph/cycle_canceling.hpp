@@ -15,13 +15,18 @@
 #ifndef BOOST_GRAPH_CYCLE_CANCELING_HPP
 #define BOOST_GRAPH_CYCLE_CANCELING_HPP
 
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <numeric>
+#include <vector>
 
 #include <boost/property_map/property_map.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/pending/indirect_cmp.hpp>
 #include <boost/graph/bellman_ford_shortest_paths.hpp>
+#include <boost/graph/queue_bellman_ford_shortest_paths.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/detail/augment.hpp>
 #include <boost/graph/find_flow_cost.hpp>
@@ -110,6 +115,45 @@ void cycle_canceling(const Graph& g, Weight weight, Reversed rev,
     }
 }
 
+// Finds the negative cycles with queue_bellman_ford_shortest_paths_no_init,
+// which returns each one as soon as it appears among the predecessors
+// instead of after V passes over the edges.
+template < class Graph, class Pred, class Distance, class Reversed,
+    class ResidualCapacity, class Weight, class VertexIndex >
+void cycle_canceling(const Graph& g, Weight weight, Reversed rev,
+    ResidualCapacity residual_capacity, Pred pred, Distance distance,
+    VertexIndex index)
+{
+    typedef filtered_graph< const Graph, is_residual_edge< ResidualCapacity > >
+        ResGraph;
+    ResGraph gres = detail::residual_graph(g, residual_capacity);
+
+    typedef typename graph_traits< ResGraph >::edge_descriptor
+        edge_descriptor;
+    typedef typename property_traits< Distance >::value_type D;
+
+    std::vector< edge_descriptor > cycle;
+    for (;;)
+    {
+        BGL_FORALL_VERTICES_T(v, g, Graph)
+        {
+            put(pred, v, edge_descriptor());
+            put(distance, v, 0);
+        }
+        cycle.clear();
+        if (queue_bellman_ford_shortest_paths_no_init(gres,
+                dummy_property_map(), distance, weight, index,
+                std::less< D >(), closed_plus< D >(),
+                (std::numeric_limits< D >::max)(), std::back_inserter(cycle)))
+            break;
+
+        for (std::size_t i = 0; i < cycle.size(); ++i)
+            put(pred, target(cycle[i], gres), cycle[i]);
+        detail::augment(g, source(cycle[0], gres), source(cycle[0], gres),
+            pred, residual_capacity, rev);
+    }
+}
+
 // in this namespace argument dispatching takes place
 namespace detail
 {
@@ -120,7 +164,9 @@ namespace detail
         ResidualCapacity residual_capacity, Pred pred, Distance dist,
         const bgl_named_params< P, T, R >& params)
     {
-        cycle_canceling(g, weight, rev, residual_capacity, pred, dist);
+        cycle_canceling(g, weight, rev, residual_capacity, pred, dist,
+            choose_const_pmap(
+                get_param(params, vertex_index), g, vertex_index));
     }
 
     // setting default distance map
@@ -137,7 +183,9 @@ namespace detail
         cycle_canceling(g, weight, rev, residual_capacity, pred,
             make_iterator_property_map(d_map.begin(),
                 choose_const_pmap(
-                    get_param(params, vertex_index), g, vertex_index)));
+                    get_param(params, vertex_index), g, vertex_index)),
+            choose_const_pmap(
+                get_param(params, vertex_index), g, vertex_index));
     }
 
     template < class Graph, class P, class T, class R, class ResidualCapacity,
@@ -0,0 +1,439 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+
+/*
+  Multithreaded single-source shortest paths by delta-stepping (U. Meyer and
+  P. Sanders, "Delta-stepping: a parallelizable shortest path algorithm",
+  Journal of Algorithms 49, 2003).
+
+  Vertices are kept in buckets of tentative distances of width delta.  The
+  lowest non-empty bucket is emptied by repeatedly relaxing, in parallel,
+  the light edges (weight at most delta) of the vertices in it, since these
+  may put vertices back into the same bucket; the heavy edges of all the
+  vertices removed from the bucket are then relaxed once.
+
+  Each thread owns a contiguous range of vertex indices and the buckets of
+  those vertices (see detail/owner_requests.hpp).  Relaxations are split
+  into two steps separated by a barrier: every thread scans edges and
+  sends relaxation requests to the owners of the targets, then every owner
+  applies the requests for its vertices.  The distance and predecessor
+  maps are thus only written by one thread at a time for any vertex and
+  need not be atomic.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/detail/owner_requests.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    template < typename Vertex, typename Distance >
+    struct delta_stepping_request
+    {
+        Vertex target;
+        Distance distance;
+        Vertex source;
+    };
+
+    template < typename Graph, typename PredecessorMap, typename DistanceMap,
+        typename WeightMap, typename VertexIndexMap, typename Compare,
+        typename Combine, typename Weight >
+    class delta_stepping_impl
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        typedef delta_stepping_request< Vertex, Distance > Request;
+
+        // State of the vertices owned by one thread
+        struct owner_state
+        {
+            // Cyclic array of buckets, indexed by bucket modulo its size
+            std::vector< std::vector< Vertex > > buckets;
+            // Vertices taken from the current bucket, whose edges are being
+            // relaxed
+            std::vector< Vertex > frontier;
+            // All vertices taken from the current bucket so far
+            std::vector< Vertex > settled;
+            std::size_t next_bucket;
+        };
+
+    public:
+        delta_stepping_impl(const Graph& g, PredecessorMap predecessor,
+            DistanceMap distance, WeightMap weight, VertexIndexMap index,
+            Compare compare, Combine combine, Weight delta,
+            std::size_t num_buckets, std::size_t num_threads)
+        : m_g(g)
+        , m_predecessor(predecessor)
+        , m_distance(distance)
+        , m_weight(weight)
+        , m_index(index)
+        , m_compare(compare)
+        , m_combine(combine)
+        , m_delta(delta)
+        , m_pool(num_threads)
+        , m_num_owners(m_pool.size())
+        , m_requests(num_vertices(g), m_num_owners)
+        , m_queued_bucket(num_vertices(g), none())
+        , m_settled_bucket(num_vertices(g), none())
+        , m_owners(m_num_owners)
+        , m_offsets(m_num_owners + 1)
+        {
+            for (std::size_t t = 0; t < m_num_owners; ++t)
+                m_owners[t].buckets.resize(num_buckets);
+        }
+
+        void run(Vertex s)
+        {
+            std::size_t current = bucket_of(get(m_distance, s));
+            insert(m_owners[owner_of(s)], s, current);
+            for (;;)
+            {
+                m_pool.run([&](std::size_t t) { collect(t, current); });
+                // Light edges, until the bucket stays empty
+                while (gather_offsets(&owner_state::frontier))
+                {
+                    m_pool.run([&](std::size_t t) {
+                        relax_edges(t, &owner_state::frontier, true);
+                    });
+                    m_pool.run([&](std::size_t t) {
+                        apply_requests(t);
+                        collect(t, current);
+                    });
+                }
+                // Heavy edges, once for every vertex removed from the bucket
+                gather_offsets(&owner_state::settled);
+                m_pool.run([&](std::size_t t) {
+                    relax_edges(t, &owner_state::settled, false);
+                });
+                m_pool.run([&](std::size_t t) {
+                    apply_requests(t);
+                    m_owners[t].settled.clear();
+                    find_next_bucket(t, current);
+                });
+                std::size_t next = none();
+                for (std::size_t t = 0; t < m_num_owners; ++t)
+                    next = (std::min)(next, m_owners[t].next_bucket);
+                if (next == none())
+                    break;
+                current = next;
+            }
+        }
+
+    private:
+        static std::size_t none()
+        {
+            return (std::numeric_limits< std::size_t >::max)();
+        }
+
+        std::size_t bucket_of(const Distance& d) const
+        {
+            return std::size_t(d / m_delta);
+        }
+
+        std::size_t owner_of(Vertex v) const
+        {
+            return m_requests.owner_of(get(m_index, v));
+        }
+
+        void insert(owner_state& owner, Vertex v, std::size_t bucket)
+        {
+            std::size_t& queued = m_queued_bucket[get(m_index, v)];
+            if (queued != bucket)
+            {
+                queued = bucket;
+                owner.buckets[bucket % owner.buckets.size()].push_back(v);
+            }
+        }
+
+        // Move the vertices of bucket b owned by thread t to its frontier.
+        // Entries of vertices that have since moved to another bucket are
+        // dropped.
+        void collect(std::size_t t, std::size_t b)
+        {
+            owner_state& owner = m_owners[t];
+            std::vector< Vertex >& bucket
+                = owner.buckets[b % owner.buckets.size()];
+            owner.frontier.clear();
+            for (std::size_t i = 0; i < bucket.size(); ++i)
+            {
+                Vertex v = bucket[i];
+                std::size_t v_index = get(m_index, v);
+                if (m_queued_bucket[v_index] != b)
+                    continue;
+                m_queued_bucket[v_index] = none();
+                owner.frontier.push_back(v);
+                if (m_settled_bucket[v_index] != b)
+                {
+                    m_settled_bucket[v_index] = b;
+                    owner.settled.push_back(v);
+                }
+            }
+            bucket.clear();
+        }
+
+        // Compute the offsets of the lists of all owners in their
+        // concatenation; returns whether the concatenation is non-empty.
+        bool gather_offsets(std::vector< Vertex > owner_state::*list)
+        {
+            for (std::size_t t = 0; t < m_num_owners; ++t)
+                m_offsets[t + 1] = m_offsets[t] + (m_owners[t].*list).size();
+            m_chunks.reset(m_offsets[m_num_owners]);
+            return m_offsets[m_num_owners] != 0;
+        }
+
+        // Scan the light or heavy out-edges of the vertices in the
+        // concatenation of the lists, taking chunks of it as they are
+        // needed, and send requests for the edges that improve a distance.
+        void relax_edges(std::size_t t,
+            std::vector< Vertex > owner_state::*list, bool light)
+        {
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            std::size_t first, last;
+            while (m_chunks.next(first, last))
+            {
+                std::size_t o = std::upper_bound(m_offsets.begin(),
+                                    m_offsets.end(), first)
+                    - m_offsets.begin() - 1;
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    while (i >= m_offsets[o + 1])
+                        ++o;
+                    Vertex u = (m_owners[o].*list)[i - m_offsets[o]];
+                    Distance d_u = get(m_distance, u);
+                    for (boost::tie(ei, ei_end) = out_edges(u, m_g);
+                         ei != ei_end; ++ei)
+                    {
+                        Weight w = get(m_weight, *ei);
+                        if (m_compare(m_delta, w) == light)
+                            continue;
+                        Vertex v = target(*ei, m_g);
+                        Distance d_v = m_combine(d_u, w);
+                        if (m_compare(d_v, get(m_distance, v)))
+                        {
+                            Request r = { v, d_v, u };
+                            m_requests.send(t, get(m_index, v), r);
+                        }
+                    }
+                }
+            }
+        }
+
+        void apply_requests(std::size_t t)
+        {
+            owner_state& owner = m_owners[t];
+            m_requests.receive(t, [&](const Request& r) {
+                if (m_compare(r.distance, get(m_distance, r.target)))
+                {
+                    put(m_distance, r.target, r.distance);
+                    put(m_predecessor, r.target, r.source);
+                    insert(owner, r.target, bucket_of(r.distance));
+                }
+            });
+        }
+
+        // Lowest non-empty bucket after b owned by thread t.  All pending
+        // buckets are within the size of the cyclic array from b.
+        void find_next_bucket(std::size_t t, std::size_t b)
+        {
+            owner_state& owner = m_owners[t];
+            const std::size_t num_buckets = owner.buckets.size();
+            owner.next_bucket = none();
+            for (std::size_t i = 1; i < num_buckets; ++i)
+            {
+                if (!owner.buckets[(b + i) % num_buckets].empty())
+                {
+                    owner.next_bucket = b + i;
+                    break;
+                }
+            }
+        }
+
+        const Graph& m_g;
+        PredecessorMap m_predecessor;
+        DistanceMap m_distance;
+        WeightMap m_weight;
+        VertexIndexMap m_index;
+        Compare m_compare;
+        Combine m_combine;
+        Weight m_delta;
+        graph::detail::thread_pool m_pool;
+        const std::size_t m_num_owners;
+        graph::detail::owner_requests< Request > m_requests;
+        // Bucket each vertex is queued in, and last bucket it was removed
+        // from; only accessed by the owner of the vertex
+        std::vector< std::size_t > m_queued_bucket;
+        std::vector< std::size_t > m_settled_bucket;
+        std::vector< owner_state > m_owners;
+        std::vector< std::size_t > m_offsets;
+        graph::detail::chunk_dispenser m_chunks;
+    };
+} // namespace detail
+
+/* Compute the shortest paths from s, as dijkstra_shortest_paths does, using
+   num_threads threads (0 means one per hardware thread).  Edge weights must
+   be non-negative; negative_edge is thrown otherwise.  delta is the width
+   of the buckets; if it is zero, the maximum edge weight divided by the
+   average out-degree is used, and it is raised to 2^-16 times the maximum
+   edge weight if it is smaller.  The distance value type must support
+   division by the weight type, and compare and combine must order and add
+   distances consistently with it, since the bucket of a distance d is
+   d / delta.  Different vertices' entries in distance and predecessor are
+   written concurrently.
+*/
+template < typename Graph, typename PredecessorMap, typename DistanceMap,
+    typename WeightMap, typename VertexIndexMap, typename Compare,
+    typename Combine, typename DistInf, typename DistZero >
+void delta_stepping_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    VertexIndexMap index, Compare compare, Combine combine, DistInf inf,
+    DistZero zero, typename property_traits< WeightMap >::value_type delta,
+    std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename graph_traits< Graph >::edge_descriptor Edge;
+    typedef typename property_traits< WeightMap >::value_type Weight;
+    BOOST_CONCEPT_ASSERT((ReadWritePropertyMapConcept< DistanceMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (WritablePropertyMapConcept< PredecessorMap, Vertex >));
+    BOOST_CONCEPT_ASSERT((ReadablePropertyMapConcept< WeightMap, Edge >));
+    BOOST_CONCEPT_ASSERT(
+        (ReadablePropertyMapConcept< VertexIndexMap, Vertex >));
+
+    // Initialize, check the weights and find the largest one
+    Weight max_weight = Weight();
+    std::size_t num_out_edges = 0;
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    {
+        put(distance, *vi, inf);
+        put(predecessor, *vi, *vi);
+        for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end; ++ei)
+        {
+            Weight w = get(weight, *ei);
+            if (compare(combine(zero, w), zero))
+                boost::throw_exception(negative_edge());
+            if (compare(max_weight, w))
+                max_weight = w;
+            ++num_out_edges;
+        }
+    }
+    put(distance, s, zero);
+
+    if (!compare(Weight(), delta))
+    {
+        double average_degree = num_vertices(g) == 0
+            ? 1.0
+            : double(num_out_edges) / double(num_vertices(g));
+        delta = Weight(double(max_weight) / (std::max)(average_degree, 1.0));
+        if (!compare(Weight(), delta))
+            delta = compare(Weight(), max_weight) ? max_weight : Weight(1);
+    }
+    // Buckets that can hold vertices at the same time span at most
+    // max_weight / delta + 2 consecutive indices.  A delta that is tiny
+    // compared to max_weight is widened to keep this number bounded.
+    const std::size_t max_buckets = 1 << 16;
+    if (double(max_weight) / double(delta) > double(max_buckets - 2))
+        delta = Weight(double(max_weight) / double(max_buckets - 2));
+    std::size_t num_buckets = std::size_t(max_weight / delta) + 2;
+
+    detail::delta_stepping_impl< Graph, PredecessorMap, DistanceMap,
+        WeightMap, VertexIndexMap, Compare, Combine, Weight >
+        impl(g, predecessor, distance, weight, index, compare, combine, delta,
+            num_buckets, num_threads);
+    impl.run(s);
+}
+
+namespace detail
+{
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline void delta_stepping_dispatch2(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for predecessor map
+        dummy_property_map p_map;
+
+        typedef typename property_traits< DistanceMap >::value_type D;
+        typedef typename property_traits< WeightMap >::value_type W;
+        D inf = choose_param(get_param(params, distance_inf_t()),
+            (std::numeric_limits< D >::max)());
+
+        delta_stepping_shortest_paths(g, s,
+            choose_param(get_param(params, vertex_predecessor), p_map),
+            distance, weight, index_map,
+            choose_param(
+                get_param(params, distance_compare_t()), std::less< D >()),
+            choose_param(
+                get_param(params, distance_combine_t()), std::plus< D >()),
+            inf, choose_param(get_param(params, distance_zero_t()), D()),
+            W(choose_param(get_param(params, bucket_width_t()), W())),
+            std::size_t(
+                choose_param(get_param(params, num_threads_t()), 0)));
+    }
+
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline void delta_stepping_dispatch1(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for distance map
+        typedef typename property_traits< WeightMap >::value_type D;
+        typename std::vector< D >::size_type n
+            = is_default_param(distance) ? num_vertices(g) : 1;
+        std::vector< D > distance_map(n);
+
+        detail::delta_stepping_dispatch2(g, s,
+            choose_param(distance,
+                make_iterator_property_map(
+                    distance_map.begin(), index_map, distance_map[0])),
+            weight, index_map, params);
+    }
+} // namespace detail
+
+// Named Parameter Variant.  In addition to the parameters of
+// dijkstra_shortest_paths other than the visitor and color map, accepts
+// bucket_width (delta) and num_threads.
+template < class Graph, class Param, class Tag, class Rest >
+inline void delta_stepping_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    detail::delta_stepping_dispatch1(g, s, get_param(params, vertex_distance),
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
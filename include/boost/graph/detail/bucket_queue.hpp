@@ -0,0 +1,213 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
+#define BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+// Bucket queue using an indirect key map, for non-negative integer keys
+// [Dial 1969].  It is a monotone priority queue whose keys all lie within
+// max_key_span of the key of the last value removed by pop(); in Dijkstra's
+// algorithm, this holds when max_key_span is the largest edge weight.  The
+// queue keeps max_key_span + 1 buckets indexed by key modulo that number,
+// each holding values with equal keys in a doubly-linked list.  push and
+// update are O(1), and pop scans the buckets up to the next non-empty one,
+// so a whole Dijkstra run costs O(E + V + D) for a largest distance D.
+//
+// - bucket_queue_indirect is a model of UpdatableQueue as is needed for
+//   dijkstra_shortest_paths.
+//
+// - Value must model Assignable.
+// - IndexInHeapMap must be a ReadWritePropertyMap from Value to
+//   std::size_t; it stores the list node of each value.
+// - DistanceMap must be a ReadablePropertyMap from Value to an integral type,
+//   and keys are ordered as by std::less.
+//
+template < typename Value, typename IndexInHeapPropertyMap,
+    typename DistanceMap >
+class bucket_queue_indirect
+{
+public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits< DistanceMap >::value_type key_type;
+    typedef DistanceMap key_map;
+
+    BOOST_STATIC_ASSERT_MSG(is_integral< key_type >::value,
+        "bucket_queue_indirect requires integral keys");
+
+    bucket_queue_indirect(DistanceMap distance,
+        IndexInHeapPropertyMap index_in_heap, size_type max_key_span)
+    : m_heads(max_key_span + 1, (size_type)(-1))
+    , m_free(none)
+    , m_current(0)
+    , m_current_bucket(0)
+    , m_size(0)
+    , m_distance(distance)
+    , m_index_in_heap(index_in_heap)
+    {
+    }
+
+    size_type size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    void push(const Value& v)
+    {
+        key_type key = get(m_distance, v);
+        if (m_size == 0 && size_type(key - m_current) >= m_heads.size())
+        {
+            // Only possible before the first pop(), as with the initial
+            // current key 0 and sources at a larger distance
+            m_current = key;
+            m_current_bucket = bucket_of(key);
+        }
+        size_type node = allocate(v);
+        put(m_index_in_heap, v, node);
+        link(node, key);
+        ++m_size;
+    }
+
+    Value& top()
+    {
+        BOOST_ASSERT(!this->empty());
+        return m_nodes[m_heads[find_min()]].value;
+    }
+
+    const Value& top() const
+    {
+        BOOST_ASSERT(!this->empty());
+        return m_nodes[m_heads[find_min()]].value;
+    }
+
+    void pop()
+    {
+        BOOST_ASSERT(!this->empty());
+        size_type node = m_heads[find_min()];
+        put(m_index_in_heap, m_nodes[node].value, (size_type)(-1));
+        unlink(node);
+        m_nodes[node].next = m_free;
+        m_free = node;
+        --m_size;
+    }
+
+    // The key of v must already have been decreased (but not below the
+    // last minimum)
+    void update(const Value& v)
+    {
+        size_type node = get(m_index_in_heap, v);
+        unlink(node);
+        link(node, get(m_distance, v));
+    }
+
+    bool contains(const Value& v) const
+    {
+        return get(m_index_in_heap, v) != (size_type)(-1);
+    }
+
+    void push_or_update(const Value& v)
+    {
+        if (contains(v))
+            update(v);
+        else
+            push(v);
+    }
+
+    DistanceMap keys() const { return m_distance; }
+
+private:
+    static const size_type none = (size_type)(-1);
+
+    struct list_node
+    {
+        Value value;
+        size_type bucket;
+        size_type prev;
+        size_type next;
+    };
+
+    size_type bucket_of(key_type key) const
+    {
+        return size_type(key) % m_heads.size();
+    }
+
+    // Advance the current key to the smallest one in the queue.  This is
+    // only done when the minimum is needed, since the keys pushed until then
+    // may be as low as the last minimum removed.
+    size_type find_min() const
+    {
+        // Some bucket within max_key_span of the current key is not empty
+        while (m_heads[m_current_bucket] == none)
+        {
+            ++m_current;
+            if (++m_current_bucket == m_heads.size())
+                m_current_bucket = 0;
+        }
+        return m_current_bucket;
+    }
+
+    size_type allocate(const Value& v)
+    {
+        size_type node = m_free;
+        if (node != none)
+            m_free = m_nodes[node].next;
+        else
+        {
+            node = m_nodes.size();
+            m_nodes.push_back(list_node());
+        }
+        m_nodes[node].value = v;
+        return node;
+    }
+
+    // Insert node at the front of the bucket of key
+    void link(size_type node, key_type key)
+    {
+        BOOST_ASSERT(!(key < m_current)
+            && size_type(key - m_current) < m_heads.size());
+        size_type bucket = bucket_of(key);
+        list_node& n = m_nodes[node];
+        n.bucket = bucket;
+        n.prev = none;
+        n.next = m_heads[bucket];
+        if (n.next != none)
+            m_nodes[n.next].prev = node;
+        m_heads[bucket] = node;
+    }
+
+    void unlink(size_type node)
+    {
+        const list_node& n = m_nodes[node];
+        if (n.prev != none)
+            m_nodes[n.prev].next = n.next;
+        else
+            m_heads[n.bucket] = n.next;
+        if (n.next != none)
+            m_nodes[n.next].prev = n.prev;
+    }
+
+    std::vector< size_type > m_heads;
+    std::vector< list_node > m_nodes;
+    size_type m_free;
+    mutable key_type m_current;
+    mutable size_type m_current_bucket;
+    size_type m_size;
+    DistanceMap m_distance;
+    IndexInHeapPropertyMap m_index_in_heap;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
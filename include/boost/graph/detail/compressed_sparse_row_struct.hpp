@@ -43,6 +43,8 @@
 #include <boost/mpl/if.hpp>
 #include <boost/graph/graph_selectors.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_convertible.hpp>
 #include <boost/functional/hash.hpp>
 
 namespace boost
@@ -193,6 +195,212 @@ namespace detail
                 boost::make_property_map_function(global_to_local));
         }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+        //  Rebuild graph from number of vertices and multi-pass unsorted list
+        //  of edges using the threads in pool.  The result is the same as that
+        //  of assign_unsorted_multi_pass_edges; the work is only split among
+        //  threads if the edge iterators are random access.
+        template < typename MultiPassInputIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool& pool)
+        {
+            typedef typename std::iterator_traits<
+                MultiPassInputIterator >::iterator_category category;
+            assign_unsorted_multi_pass_edges_parallel_dispatch(edge_begin,
+                edge_end, numlocalverts, global_to_local, source_pred, pool,
+                is_convertible< category,
+                    std::random_access_iterator_tag >());
+        }
+
+        template < typename MultiPassInputIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel_dispatch(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool&, false_type)
+        {
+            assign_unsorted_multi_pass_edges(edge_begin, edge_end,
+                numlocalverts, global_to_local, source_pred);
+        }
+
+        template < typename MultiPassInputIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel_dispatch(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool& pool, true_type)
+        {
+            m_rowstart.clear();
+            m_rowstart.resize(numlocalverts + 1, 0);
+            typedef std::pair< vertices_size_type, vertices_size_type >
+                edge_type;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project1st< edge_type >,
+                MultiPassInputIterator >
+                source_iterator;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project2nd< edge_type >,
+                MultiPassInputIterator >
+                target_iterator;
+            source_iterator sources_begin(
+                edge_begin, boost::graph::detail::project1st< edge_type >());
+            source_iterator sources_end(
+                edge_end, boost::graph::detail::project1st< edge_type >());
+            target_iterator targets_begin(
+                edge_begin, boost::graph::detail::project2nd< edge_type >());
+
+            std::vector< std::vector< EdgeIndex > > thread_starts;
+            boost::graph::detail::count_starts_parallel(sources_begin,
+                sources_end, m_rowstart.begin(), numlocalverts, source_pred,
+                boost::make_property_map_function(global_to_local),
+                thread_starts, pool);
+
+            m_column.resize(m_rowstart.back());
+            inherited_edge_properties::resize(m_rowstart.back());
+
+            boost::graph::detail::histogram_sort_parallel(sources_begin,
+                sources_end, numlocalverts, targets_begin, m_column.begin(),
+                source_pred,
+                boost::make_property_map_function(global_to_local),
+                thread_starts, pool);
+        }
+
+        //  Rebuild graph from number of vertices and multi-pass unsorted list
+        //  of edges and their properties using the threads in pool.  The work
+        //  is only split among threads if both the edge and the edge property
+        //  iterators are random access.
+        template < typename MultiPassInputIterator,
+            typename EdgePropertyIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            EdgePropertyIterator ep_iter, vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool& pool)
+        {
+            typedef typename std::iterator_traits<
+                MultiPassInputIterator >::iterator_category category;
+            typedef typename std::iterator_traits<
+                EdgePropertyIterator >::iterator_category ep_category;
+            assign_unsorted_multi_pass_edges_parallel_dispatch(edge_begin,
+                edge_end, ep_iter, numlocalverts, global_to_local, source_pred,
+                pool,
+                integral_constant< bool,
+                    is_convertible< category,
+                        std::random_access_iterator_tag >::value
+                        && is_convertible< ep_category,
+                            std::random_access_iterator_tag >::value >());
+        }
+
+        template < typename MultiPassInputIterator,
+            typename EdgePropertyIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel_dispatch(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            EdgePropertyIterator ep_iter, vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool&, false_type)
+        {
+            assign_unsorted_multi_pass_edges(edge_begin, edge_end, ep_iter,
+                numlocalverts, global_to_local, source_pred);
+        }
+
+        template < typename MultiPassInputIterator,
+            typename EdgePropertyIterator, typename GlobalToLocal,
+            typename SourcePred >
+        void assign_unsorted_multi_pass_edges_parallel_dispatch(
+            MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+            EdgePropertyIterator ep_iter, vertices_size_type numlocalverts,
+            const GlobalToLocal& global_to_local, const SourcePred& source_pred,
+            boost::graph::detail::thread_pool& pool, true_type)
+        {
+            m_rowstart.clear();
+            m_rowstart.resize(numlocalverts + 1, 0);
+            typedef std::pair< vertices_size_type, vertices_size_type >
+                edge_type;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project1st< edge_type >,
+                MultiPassInputIterator >
+                source_iterator;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project2nd< edge_type >,
+                MultiPassInputIterator >
+                target_iterator;
+            source_iterator sources_begin(
+                edge_begin, boost::graph::detail::project1st< edge_type >());
+            source_iterator sources_end(
+                edge_end, boost::graph::detail::project1st< edge_type >());
+            target_iterator targets_begin(
+                edge_begin, boost::graph::detail::project2nd< edge_type >());
+
+            std::vector< std::vector< EdgeIndex > > thread_starts;
+            boost::graph::detail::count_starts_parallel(sources_begin,
+                sources_end, m_rowstart.begin(), numlocalverts, source_pred,
+                boost::make_property_map_function(global_to_local),
+                thread_starts, pool);
+
+            m_column.resize(m_rowstart.back());
+            inherited_edge_properties::resize(m_rowstart.back());
+
+            boost::graph::detail::histogram_sort_parallel(sources_begin,
+                sources_end, numlocalverts, targets_begin, m_column.begin(),
+                ep_iter, inherited_edge_properties::begin(), source_pred,
+                boost::make_property_map_function(global_to_local),
+                thread_starts, pool);
+        }
+
+        //  Rebuild graph as the transpose of a forward structure using the
+        //  threads in pool, storing the index of each forward edge as the
+        //  property of the corresponding backward edge.  This gives the same
+        //  result as calling assign_unsorted_multi_pass_edges on the
+        //  transposed edges of forward and a counting iterator.
+        template < typename ForwardStructure >
+        void assign_transpose_parallel(const ForwardStructure& forward,
+            boost::graph::detail::thread_pool& pool)
+        {
+            const vertices_size_type numverts = forward.m_rowstart.size() - 1;
+            const EdgeIndex numedges = forward.m_column.size();
+
+            // The sources of the forward edges, in edge index order
+            std::vector< Vertex > sources(numedges);
+            pool.for_each_block(numverts,
+                [&](std::size_t, vertices_size_type first,
+                    vertices_size_type last) {
+                    for (vertices_size_type v = first; v != last; ++v)
+                        std::fill(sources.begin() + forward.m_rowstart[v],
+                            sources.begin() + forward.m_rowstart[v + 1], v);
+                });
+
+            m_rowstart.clear();
+            m_rowstart.resize(numverts + 1, 0);
+            std::vector< std::vector< EdgeIndex > > thread_starts;
+            boost::graph::detail::count_starts_parallel(
+                forward.m_column.begin(), forward.m_column.end(),
+                m_rowstart.begin(), numverts, keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+
+            m_column.resize(numedges);
+            inherited_edge_properties::resize(numedges);
+
+            boost::graph::detail::histogram_sort_parallel(
+                forward.m_column.begin(), forward.m_column.end(), numverts,
+                sources.begin(), m_column.begin(),
+                boost::counting_iterator< EdgeIndex >(0),
+                inherited_edge_properties::begin(), keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+        }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
         //  Assign from number of vertices and sorted list of edges
         template < typename InputIterator, typename GlobalToLocal,
             typename SourcePred >
@@ -330,6 +538,68 @@ namespace detail
             this->m_edge_properties.swap(edge_props);
         }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+        // Replace graph with sources and targets given, using the threads in
+        // pool.  Unlike assign_sources_and_targets_global, the targets are
+        // copied into m_column rather than sorted in place, which keeps edges
+        // with the same source in their original relative order.
+        void assign_sources_and_targets_parallel(
+            const std::vector< vertex_descriptor >& sources,
+            const std::vector< vertex_descriptor >& targets,
+            vertices_size_type numverts,
+            boost::graph::detail::thread_pool& pool)
+        {
+            BOOST_ASSERT(sources.size() == targets.size());
+            m_rowstart.clear();
+            m_rowstart.resize(numverts + 1);
+            std::vector< std::vector< EdgeIndex > > thread_starts;
+            boost::graph::detail::count_starts_parallel(sources.begin(),
+                sources.end(), m_rowstart.begin(), numverts, keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+            m_column.resize(m_rowstart.back());
+            boost::graph::detail::histogram_sort_parallel(sources.begin(),
+                sources.end(), numverts, targets.begin(), m_column.begin(),
+                keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+            inherited_edge_properties::resize(m_rowstart.back());
+        }
+
+        // Replace graph with sources, targets and edge properties given, using
+        // the threads in pool (see above).
+        void assign_sources_and_targets_parallel(
+            const std::vector< vertex_descriptor >& sources,
+            const std::vector< vertex_descriptor >& targets,
+            const std::vector<
+                typename inherited_edge_properties::edge_bundled >& edge_props,
+            vertices_size_type numverts,
+            boost::graph::detail::thread_pool& pool)
+        {
+            BOOST_ASSERT(sources.size() == targets.size());
+            BOOST_ASSERT(sources.size() == edge_props.size());
+            m_rowstart.clear();
+            m_rowstart.resize(numverts + 1);
+            std::vector< std::vector< EdgeIndex > > thread_starts;
+            boost::graph::detail::count_starts_parallel(sources.begin(),
+                sources.end(), m_rowstart.begin(), numverts, keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+            m_column.resize(m_rowstart.back());
+            inherited_edge_properties::resize(m_rowstart.back());
+            boost::graph::detail::histogram_sort_parallel(sources.begin(),
+                sources.end(), numverts, targets.begin(), m_column.begin(),
+                edge_props.begin(), inherited_edge_properties::begin(),
+                keep_all(),
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                thread_starts, pool);
+        }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
         // From any graph (slow and uses a lot of memory)
         //   Requires IncidenceGraph and a vertex index map
         //   Internal helper function
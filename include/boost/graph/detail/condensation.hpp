@@ -0,0 +1,177 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The condensation of a directed graph, as used by the reachability
+// structures of the BGL.  This is an internal detail of the BGL.
+
+#ifndef BOOST_GRAPH_DETAIL_CONDENSATION_HPP
+#define BOOST_GRAPH_DETAIL_CONDENSATION_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/strong_components.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+namespace detail
+{
+
+    /* The strong components of a graph and the edges between them, in
+     * compressed sparse row form, with the components numbered in reverse
+     * postorder of a depth-first search of the condensation.  Every edge
+     * thus goes from a component to one with a larger number, and the
+     * descendants of a component in the search tree follow it, so the
+     * components reachable from one tend to have nearby numbers.
+     */
+    struct topological_condensation
+    {
+        std::size_t size() const { return cyclic.size(); }
+
+        // The component of each vertex, by vertex index
+        std::vector< std::size_t > component;
+        // The vertex indices of the members of component c are
+        // members[member_start[c]] to members[member_start[c + 1] - 1]
+        std::vector< std::size_t > member_start;
+        std::vector< std::size_t > members;
+        // The components with an edge from c, in increasing order
+        std::vector< std::size_t > successor_start;
+        std::vector< std::size_t > successors;
+        // Whether the vertices of c reach themselves: c has more than one
+        // vertex or a self-loop
+        std::vector< char > cyclic;
+    };
+
+    template < typename Graph, typename VertexIndexMap >
+    void build_topological_condensation(const Graph& g,
+        VertexIndexMap vertex_index, topological_condensation& dag)
+    {
+        typedef typename graph_traits< Graph >::vertex_iterator
+            vertex_iterator;
+        typedef typename graph_traits< Graph >::out_edge_iterator
+            out_edge_iterator;
+        const std::size_t npos = std::size_t(-1);
+
+        const std::size_t n = num_vertices(g);
+        std::vector< std::size_t > scc(n);
+        const std::size_t c = n == 0 ? 0
+                                     : strong_components(g,
+                                         make_iterator_property_map(
+                                             scc.begin(), vertex_index),
+                                         vertex_index_map(vertex_index));
+
+        // The edges between the components, without duplicates
+        std::vector< std::size_t > size(c, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            ++size[scc[i]];
+        std::vector< char > cyclic(c, 0);
+        for (std::size_t k = 0; k < c; ++k)
+            cyclic[k] = size[k] > 1;
+        std::vector< std::size_t > start(c + 1, 0);
+        vertex_iterator v, v_end;
+        out_edge_iterator e, e_end;
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+            start[scc[get(vertex_index, *v)] + 1] += out_degree(*v, g);
+        for (std::size_t k = 0; k < c; ++k)
+            start[k + 1] += start[k];
+        std::vector< std::size_t > next(start.begin(), start.end() - 1);
+        std::vector< std::size_t > head(c == 0 ? 0 : start[c]);
+        std::vector< std::size_t > last_source(c, npos);
+        for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+        {
+            std::size_t s = scc[get(vertex_index, *v)];
+            for (boost::tie(e, e_end) = out_edges(*v, g); e != e_end; ++e)
+            {
+                std::size_t t = scc[get(vertex_index, target(*e, g))];
+                if (t == s)
+                    cyclic[s] = 1;
+                else
+                    head[next[s]++] = t;
+            }
+        }
+        for (std::size_t k = 0; k < c; ++k)
+        {
+            std::size_t* first = head.data() + start[k];
+            std::size_t* last = head.data() + next[k];
+            for (std::size_t* t = first; t != last; ++t)
+                if (last_source[*t] != k)
+                {
+                    last_source[*t] = k;
+                    *first++ = *t;
+                }
+            next[k] = first - head.data();
+        }
+
+        // Reverse postorder of a depth-first search
+        std::vector< std::size_t > order(c, npos);
+        std::size_t count = c;
+        std::vector< std::pair< std::size_t, std::size_t > > stack;
+        for (std::size_t r = 0; r < c; ++r)
+        {
+            if (order[r] != npos)
+                continue;
+            order[r] = 0;
+            stack.push_back(std::make_pair(r, start[r]));
+            while (!stack.empty())
+            {
+                std::pair< std::size_t, std::size_t >& top = stack.back();
+                if (top.second == next[top.first])
+                {
+                    order[top.first] = --count;
+                    stack.pop_back();
+                    continue;
+                }
+                std::size_t t = head[top.second++];
+                if (order[t] == npos)
+                {
+                    order[t] = 0;
+                    stack.push_back(std::make_pair(t, start[t]));
+                }
+            }
+        }
+
+        dag.component.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            dag.component[i] = order[scc[i]];
+        dag.cyclic.assign(c, 0);
+        dag.member_start.assign(c + 1, 0);
+        dag.successor_start.assign(c + 1, 0);
+        for (std::size_t k = 0; k < c; ++k)
+        {
+            dag.cyclic[order[k]] = cyclic[k];
+            dag.member_start[order[k] + 1] = size[k];
+            dag.successor_start[order[k] + 1] = next[k] - start[k];
+        }
+        for (std::size_t k = 0; k < c; ++k)
+        {
+            dag.member_start[k + 1] += dag.member_start[k];
+            dag.successor_start[k + 1] += dag.successor_start[k];
+        }
+        dag.members.resize(n);
+        std::vector< std::size_t > position(
+            dag.member_start.begin(), dag.member_start.end() - 1);
+        for (std::size_t i = 0; i < n; ++i)
+            dag.members[position[dag.component[i]]++] = i;
+        dag.successors.resize(dag.successor_start[c]);
+        for (std::size_t k = 0; k < c; ++k)
+        {
+            std::size_t* out
+                = dag.successors.data() + dag.successor_start[order[k]];
+            for (std::size_t j = start[k]; j < next[k]; ++j)
+                *out++ = order[head[j]];
+            std::sort(dag.successors.data() + dag.successor_start[order[k]],
+                out);
+        }
+    }
+
+} // namespace detail
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_CONDENSATION_HPP
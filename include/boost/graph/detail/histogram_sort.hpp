@@ -10,7 +10,11 @@
 #ifndef BOOST_GRAPH_DETAIL_HISTOGRAM_SORT_HPP
 #define BOOST_GRAPH_DETAIL_HISTOGRAM_SORT_HPP
 
+#include <algorithm>
+#include <vector>
+#include <iterator>
 #include <boost/assert.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
 
 namespace boost
 {
@@ -233,6 +237,179 @@ namespace graph
             }
         }
 
+#ifndef BOOST_GRAPH_NO_THREAD_POOL
+        // Multithreaded versions of count_starts and histogram_sort.  The key
+        // range is split into thread_starts.size() contiguous blocks, each
+        // counted by its own thread; after count_starts_parallel,
+        // thread_starts[b][k] is the position at which the first key k of
+        // block b is to be written.  Since the blocks are scattered in order,
+        // histogram_sort_parallel places the values in exactly the same
+        // positions as the sequential histogram_sort.  Every block needs
+        // numkeys counts, so there are at most numitems / numkeys blocks (but
+        // at least one), which bounds the counts by the number of items; with
+        // fewer items per key than threads, some threads do not count.  All
+        // iterators must be random access.
+
+        // Calls f(b, first, last) for each of the num_blocks blocks of
+        // [0, n), with at most one block per thread of pool
+        template < typename Size, typename Function >
+        void for_each_count_block(
+            thread_pool& pool, std::size_t num_blocks, Size n, Function f)
+        {
+            BOOST_ASSERT(num_blocks <= pool.size());
+            pool.run([&](std::size_t b) {
+                if (b < num_blocks)
+                    f(b, block_begin(n, num_blocks, b),
+                        block_begin(n, num_blocks, b + 1));
+            });
+        }
+
+        template < typename KeyIterator, typename RowstartIterator,
+            typename VerticesSize, typename KeyFilter, typename KeyTransform,
+            typename EdgeIndex >
+        void count_starts_parallel(KeyIterator begin, KeyIterator end,
+            RowstartIterator starts, // Must support numverts + 1 elements
+            VerticesSize numkeys, KeyFilter key_filter,
+            KeyTransform key_transform,
+            std::vector< std::vector< EdgeIndex > >& thread_starts,
+            thread_pool& pool)
+        {
+            typedef
+                typename std::iterator_traits< KeyIterator >::difference_type
+                    item_count;
+            const std::size_t num_threads = pool.size();
+            const item_count numitems = end - begin;
+            const std::size_t num_blocks = (std::max)(std::size_t(1),
+                (std::min)(num_threads,
+                    std::size_t(numitems)
+                        / (std::max)(std::size_t(numkeys), std::size_t(1))));
+            thread_starts.clear();
+            thread_starts.resize(num_blocks);
+
+            // Count the keys of each block separately
+            for_each_count_block(pool, num_blocks, numitems,
+                [&](std::size_t b, item_count first, item_count last) {
+                    std::vector< EdgeIndex >& counts = thread_starts[b];
+                    counts.assign(numkeys, EdgeIndex(0));
+                    for (item_count i = first; i != last; ++i)
+                    {
+                        if (key_filter(begin[i]))
+                        {
+                            BOOST_ASSERT(key_transform(begin[i]) < numkeys);
+                            ++counts[key_transform(begin[i])];
+                        }
+                    }
+                });
+
+            // Turn the counts of each key into offsets relative to the start
+            // of its row, leaving the degree of each key k in starts[k + 1]
+            std::vector< EdgeIndex > block_totals(num_threads);
+            pool.for_each_block(numkeys,
+                [&](std::size_t b, VerticesSize first, VerticesSize last) {
+                    EdgeIndex block_total = 0;
+                    for (VerticesSize k = first; k != last; ++k)
+                    {
+                        EdgeIndex degree = 0;
+                        for (std::size_t c = 0; c < num_blocks; ++c)
+                        {
+                            EdgeIndex count = thread_starts[c][k];
+                            thread_starts[c][k] = degree;
+                            degree += count;
+                        }
+                        starts[k + 1] = degree;
+                        block_total += degree;
+                    }
+                    block_totals[b] = block_total;
+                });
+
+            // Partial sum of the degrees, one block of keys per thread
+            EdgeIndex start_of_this_block = 0;
+            for (std::size_t b = 0; b < num_threads; ++b)
+            {
+                EdgeIndex block_total = block_totals[b];
+                block_totals[b] = start_of_this_block;
+                start_of_this_block += block_total;
+            }
+            starts[0] = 0;
+            pool.for_each_block(numkeys,
+                [&](std::size_t b, VerticesSize first, VerticesSize last) {
+                    EdgeIndex start_of_this_row = block_totals[b];
+                    for (VerticesSize k = first; k != last; ++k)
+                    {
+                        for (std::size_t c = 0; c < num_blocks; ++c)
+                            thread_starts[c][k] += start_of_this_row;
+                        start_of_this_row += starts[k + 1];
+                        starts[k + 1] = start_of_this_row;
+                    }
+                });
+        }
+
+        template < typename KeyIterator, typename NumKeys,
+            typename Value1InputIter, typename Value1OutputIter,
+            typename KeyFilter, typename KeyTransform, typename EdgeIndex >
+        void histogram_sort_parallel(KeyIterator key_begin,
+            KeyIterator key_end, NumKeys numkeys,
+            Value1InputIter values1_begin, Value1OutputIter values1_out,
+            KeyFilter key_filter, KeyTransform key_transform,
+            std::vector< std::vector< EdgeIndex > >& thread_starts,
+            thread_pool& pool)
+        {
+            typedef
+                typename std::iterator_traits< KeyIterator >::difference_type
+                    item_count;
+            for_each_count_block(pool, thread_starts.size(),
+                key_end - key_begin,
+                [&](std::size_t b, item_count first, item_count last) {
+                    std::vector< EdgeIndex >& insert_positions
+                        = thread_starts[b];
+                    for (item_count i = first; i != last; ++i)
+                    {
+                        if (key_filter(key_begin[i]))
+                        {
+                            NumKeys source = key_transform(key_begin[i]);
+                            BOOST_ASSERT(source < numkeys);
+                            EdgeIndex insert_pos = insert_positions[source]++;
+                            values1_out[insert_pos] = values1_begin[i];
+                        }
+                    }
+                });
+        }
+
+        template < typename KeyIterator, typename NumKeys,
+            typename Value1InputIter, typename Value1OutputIter,
+            typename Value2InputIter, typename Value2OutputIter,
+            typename KeyFilter, typename KeyTransform, typename EdgeIndex >
+        void histogram_sort_parallel(KeyIterator key_begin,
+            KeyIterator key_end, NumKeys numkeys,
+            Value1InputIter values1_begin, Value1OutputIter values1_out,
+            Value2InputIter values2_begin, Value2OutputIter values2_out,
+            KeyFilter key_filter, KeyTransform key_transform,
+            std::vector< std::vector< EdgeIndex > >& thread_starts,
+            thread_pool& pool)
+        {
+            typedef
+                typename std::iterator_traits< KeyIterator >::difference_type
+                    item_count;
+            for_each_count_block(pool, thread_starts.size(),
+                key_end - key_begin,
+                [&](std::size_t b, item_count first, item_count last) {
+                    std::vector< EdgeIndex >& insert_positions
+                        = thread_starts[b];
+                    for (item_count i = first; i != last; ++i)
+                    {
+                        if (key_filter(key_begin[i]))
+                        {
+                            NumKeys source = key_transform(key_begin[i]);
+                            BOOST_ASSERT(source < numkeys);
+                            EdgeIndex insert_pos = insert_positions[source]++;
+                            values1_out[insert_pos] = values1_begin[i];
+                            values2_out[insert_pos] = values2_begin[i];
+                        }
+                    }
+                });
+        }
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
         template < typename InputIterator, typename VerticesSize >
         void split_into_separate_coords(InputIterator begin, InputIterator end,
             std::vector< VerticesSize >& firsts,
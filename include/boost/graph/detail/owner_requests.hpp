@@ -0,0 +1,131 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The owner-computes scheme shared by the multithreaded algorithms that
+// update per-vertex state in rounds, such as delta-stepping, the parallel
+// Bellman-Ford algorithm and the synchronous push-relabel method.  This is
+// an internal detail of the BGL.
+//
+// Each thread of a pool owns a contiguous range of vertex indices and is
+// the only one to write the state of those vertices.  A round has two
+// steps separated by a barrier: the threads claim chunks of the work of
+// the round and send requests to the owners of the vertices to update,
+// then every owner applies the requests for its vertices.  Needs C++11
+// atomics, and is only included by headers that use thread_pool.hpp.
+
+#ifndef BOOST_GRAPH_DETAIL_OWNER_REQUESTS_HPP
+#define BOOST_GRAPH_DETAIL_OWNER_REQUESTS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+namespace boost
+{
+namespace graph
+{
+    namespace detail
+    {
+
+        /** Request buffers between the owners of a range of vertex indices.
+         *
+         * The indices [0, n) are split into num_owners contiguous ranges.
+         * send(sender, i, r) is called by thread sender to queue r for the
+         * owner of index i; receive(o, f) is called by owner o after a
+         * barrier, and calls f(r) for every request queued for it, those
+         * of each sender in the order they were sent, then empties the
+         * buffers.  Different threads may send and receive concurrently.
+         */
+        template < typename Request > class owner_requests
+        {
+        public:
+            owner_requests(std::size_t n, std::size_t num_owners)
+            : m_num_owners(num_owners)
+            , m_owner_size((std::max)(
+                  std::size_t(1), (n + num_owners - 1) / num_owners))
+            , m_buffers(num_owners,
+                  std::vector< std::vector< Request > >(num_owners))
+            {
+            }
+
+            std::size_t num_owners() const { return m_num_owners; }
+
+            std::size_t owner_of(std::size_t i) const
+            {
+                return i / m_owner_size;
+            }
+
+            void send(std::size_t sender, std::size_t i, const Request& r)
+            {
+                m_buffers[sender][owner_of(i)].push_back(r);
+            }
+
+            template < typename Function >
+            void receive(std::size_t owner, Function f)
+            {
+                for (std::size_t sender = 0; sender < m_num_owners; ++sender)
+                {
+                    std::vector< Request >& in = m_buffers[sender][owner];
+                    for (std::size_t k = 0; k < in.size(); ++k)
+                        f(in[k]);
+                    in.clear();
+                }
+            }
+
+        private:
+            std::size_t m_num_owners;
+            std::size_t m_owner_size;
+            // By sender, then by owner
+            std::vector< std::vector< std::vector< Request > > > m_buffers;
+        };
+
+        /** Dynamic split of [0, size) into chunks claimed by the threads.
+         *
+         * reset(size) is called between rounds; during a round, each call
+         * to next(first, last) claims the next chunk and returns false
+         * once all are taken.  Small enough chunks balance the load when
+         * the work per index varies, as with vertex degrees.
+         */
+        class chunk_dispenser : boost::noncopyable
+        {
+        public:
+            static const std::size_t default_chunk_size = 64;
+
+            explicit chunk_dispenser(
+                std::size_t chunk_size = default_chunk_size)
+            : m_chunk_size(chunk_size), m_size(0), m_next(0)
+            {
+            }
+
+            void reset(std::size_t size)
+            {
+                m_size = size;
+                m_next.store(0, std::memory_order_relaxed);
+            }
+
+            bool next(std::size_t& first, std::size_t& last)
+            {
+                first = m_next.fetch_add(
+                    m_chunk_size, std::memory_order_relaxed);
+                if (first >= m_size)
+                    return false;
+                last = (std::min)(first + m_chunk_size, m_size);
+                return true;
+            }
+
+        private:
+            std::size_t m_chunk_size;
+            std::size_t m_size;
+            std::atomic< std::size_t > m_next;
+        };
+
+    } // namespace detail
+} // namespace graph
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_OWNER_REQUESTS_HPP
@@ -0,0 +1,226 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+#define BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+
+#include <vector>
+#include <cstddef>
+#include <limits>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <boost/integer/integer_log2.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Number of significant bits of x (0 for x == 0)
+    inline std::size_t radix_heap_bit_width(unsigned long long x)
+    {
+        if (x == 0)
+            return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        return std::numeric_limits< unsigned long long >::digits
+            - __builtin_clzll(x);
+#else
+        return boost::integer_log2(x) + 1;
+#endif
+    }
+}
+
+// Radix heap using an indirect key map, for non-negative integer keys
+// [Ahuja, Mehlhorn, Orlin and Tarjan 1990].  It is a monotone priority
+// queue: the keys of pushed and updated values must not be less than the
+// key of the last value removed by pop(), which is the case in Dijkstra's
+// algorithm with non-negative edge weights.  Bucket 0 holds the values whose
+// key equals the last minimum, and bucket i > 0 the values whose key first
+// differs from it in bit i - 1.  When the minimum is needed and bucket 0 is
+// empty, the values of the lowest non-empty bucket are redistributed
+// relative to their minimum;
+// since every value only moves to lower buckets, the amortized cost of an
+// operation is O(log C) for keys at most C above the current minimum, and
+// push and update are O(1).
+//
+// - radix_heap_indirect is a model of UpdatableQueue as is needed for
+//   dijkstra_shortest_paths.
+//
+// - Value must model Assignable.
+// - IndexInHeapMap must be a ReadWritePropertyMap from Value to
+//   std::size_t; it stores the bucket and position of each value.
+// - DistanceMap must be a ReadablePropertyMap from Value to an integral type,
+//   and keys are ordered as by std::less.
+//
+template < typename Value, typename IndexInHeapPropertyMap,
+    typename DistanceMap >
+class radix_heap_indirect
+{
+public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits< DistanceMap >::value_type key_type;
+    typedef DistanceMap key_map;
+
+    BOOST_STATIC_ASSERT_MSG(is_integral< key_type >::value,
+        "radix_heap_indirect requires integral keys");
+
+    radix_heap_indirect(
+        DistanceMap distance, IndexInHeapPropertyMap index_in_heap)
+    : m_buckets(num_buckets)
+    , m_last(0)
+    , m_size(0)
+    , m_distance(distance)
+    , m_index_in_heap(index_in_heap)
+    {
+    }
+
+    size_type size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    void push(const Value& v)
+    {
+        unsigned_key key = get_key(v);
+        BOOST_ASSERT(key >= m_last);
+        insert(v, bucket_of(key));
+        ++m_size;
+    }
+
+    Value& top()
+    {
+        BOOST_ASSERT(!this->empty());
+        refill();
+        return m_buckets[0].back();
+    }
+
+    const Value& top() const
+    {
+        BOOST_ASSERT(!this->empty());
+        refill();
+        return m_buckets[0].back();
+    }
+
+    void pop()
+    {
+        BOOST_ASSERT(!this->empty());
+        refill();
+        put(m_index_in_heap, m_buckets[0].back(), (size_type)(-1));
+        m_buckets[0].pop_back();
+        --m_size;
+    }
+
+    // The key of v must already have been decreased (but not below the
+    // last minimum)
+    void update(const Value& v)
+    {
+        unsigned_key key = get_key(v);
+        BOOST_ASSERT(key >= m_last);
+        size_type index = get(m_index_in_heap, v);
+        size_type bucket = index & bucket_mask;
+        size_type new_bucket = bucket_of(key);
+        if (new_bucket != bucket)
+        {
+            erase(bucket, index >> bucket_bits);
+            insert(v, new_bucket);
+        }
+    }
+
+    bool contains(const Value& v) const
+    {
+        return get(m_index_in_heap, v) != (size_type)(-1);
+    }
+
+    void push_or_update(const Value& v)
+    {
+        if (contains(v))
+            update(v);
+        else
+            push(v);
+    }
+
+    DistanceMap keys() const { return m_distance; }
+
+private:
+    typedef typename make_unsigned< key_type >::type unsigned_key;
+
+    // The bucket of a value is stored in the low bits of its index in heap
+    // and its position in that bucket in the remaining bits
+    static const size_type num_buckets
+        = std::numeric_limits< unsigned_key >::digits + 1;
+    static const size_type bucket_bits = 7;
+    static const size_type bucket_mask = (size_type(1) << bucket_bits) - 1;
+    BOOST_STATIC_ASSERT(num_buckets <= bucket_mask);
+
+    unsigned_key get_key(const Value& v) const
+    {
+        BOOST_ASSERT(!(get(m_distance, v) < key_type(0)));
+        return unsigned_key(get(m_distance, v));
+    }
+
+    size_type bucket_of(unsigned_key key) const
+    {
+        return detail::radix_heap_bit_width(
+            static_cast< unsigned long long >(key ^ m_last));
+    }
+
+    void insert(const Value& v, size_type bucket) const
+    {
+        put(m_index_in_heap, v,
+            (m_buckets[bucket].size() << bucket_bits) | bucket);
+        m_buckets[bucket].push_back(v);
+    }
+
+    void erase(size_type bucket, size_type position)
+    {
+        std::vector< Value >& b = m_buckets[bucket];
+        if (position + 1 != b.size())
+        {
+            b[position] = b.back();
+            put(m_index_in_heap, b[position],
+                (position << bucket_bits) | bucket);
+        }
+        b.pop_back();
+    }
+
+    // If bucket 0 is empty, move the values of the lowest non-empty bucket
+    // to lower buckets, relative to the smallest of their keys.  This is
+    // only done when the minimum is needed, since the keys pushed until then
+    // may be as low as the last minimum removed.
+    void refill() const
+    {
+        if (!m_buckets[0].empty())
+            return;
+        size_type i = 1;
+        while (m_buckets[i].empty())
+            ++i;
+        std::vector< Value >& b = m_buckets[i];
+        unsigned_key new_last = get_key(b[0]);
+        for (size_type j = 1; j < b.size(); ++j)
+        {
+            unsigned_key key = get_key(b[j]);
+            if (key < new_last)
+                new_last = key;
+        }
+        m_last = new_last;
+        for (size_type j = 0; j < b.size(); ++j)
+            insert(b[j], bucket_of(get_key(b[j])));
+        b.clear();
+    }
+
+    mutable std::vector< std::vector< Value > > m_buckets;
+    mutable unsigned_key m_last;
+    size_type m_size;
+    DistanceMap m_distance;
+    IndexInHeapPropertyMap m_index_in_heap;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
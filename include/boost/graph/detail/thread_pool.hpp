@@ -0,0 +1,203 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A minimal fork-join thread pool used by the multithreaded algorithms and
+// constructors in the BGL.  This is an internal detail of the BGL.
+//
+// The pool needs the C++11 thread support library and lambdas.  Without
+// them, or if threads are disabled with BOOST_DISABLE_THREADS, this header
+// only defines BOOST_GRAPH_NO_THREAD_POOL, and the headers that add
+// multithreaded variants to existing facilities leave those variants out.
+
+#ifndef BOOST_GRAPH_DETAIL_THREAD_POOL_HPP
+#define BOOST_GRAPH_DETAIL_THREAD_POOL_HPP
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_HDR_MUTEX) \
+    || defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE)                      \
+    || defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)                              \
+    || defined(BOOST_NO_CXX11_LAMBDAS) || !defined(BOOST_HAS_THREADS)
+#define BOOST_GRAPH_NO_THREAD_POOL
+#else
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <boost/assert.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace boost
+{
+namespace graph
+{
+    namespace detail
+    {
+
+        // Map the user-visible "number of threads" argument (0 meaning "as
+        // many as the hardware supports") to an actual thread count.
+        inline std::size_t resolve_num_threads(std::size_t num_threads)
+        {
+            if (num_threads == 0)
+                num_threads = std::thread::hardware_concurrency();
+            return num_threads == 0 ? 1 : num_threads;
+        }
+
+        // Start of block i when [0, n) is split into num_blocks contiguous
+        // blocks whose sizes differ by at most one.  Every phase of a
+        // multithreaded algorithm that relies on the same partition of the
+        // input must use this function so that the blocks agree.
+        template < typename Size >
+        inline Size block_begin(Size n, std::size_t num_blocks, std::size_t i)
+        {
+            Size q = n / Size(num_blocks);
+            Size r = n % Size(num_blocks);
+            return q * Size(i) + (Size(i) < r ? Size(i) : r);
+        }
+
+        /** Fork-join thread pool.
+         *
+         * The pool owns size() - 1 worker threads; the thread that calls
+         * run() acts as the remaining one.  run(f) calls f(i) once for every
+         * i in [0, size()), concurrently, and returns when all calls have
+         * finished.  If any call throws, the first exception caught is
+         * rethrown from run() after all calls have finished.
+         */
+        class thread_pool : boost::noncopyable
+        {
+        public:
+            explicit thread_pool(std::size_t num_threads = 0)
+            : m_size(resolve_num_threads(num_threads))
+            , m_generation(0)
+            , m_pending(0)
+            , m_stop(false)
+            {
+                m_workers.reserve(m_size - 1);
+                try
+                {
+                    for (std::size_t i = 1; i < m_size; ++i)
+                        m_workers.push_back(
+                            std::thread(&thread_pool::worker_loop, this, i));
+                }
+                catch (...)
+                {
+                    stop_workers();
+                    throw;
+                }
+            }
+
+            ~thread_pool() { stop_workers(); }
+
+            std::size_t size() const { return m_size; }
+
+            template < typename Function > void run(Function f)
+            {
+                if (m_size == 1)
+                {
+                    f(std::size_t(0));
+                    return;
+                }
+                {
+                    std::lock_guard< std::mutex > lock(m_mutex);
+                    m_job = f;
+                    m_error = std::exception_ptr();
+                    m_pending = m_size - 1;
+                    ++m_generation;
+                }
+                m_start.notify_all();
+                call(0);
+                std::unique_lock< std::mutex > lock(m_mutex);
+                while (m_pending != 0)
+                    m_done.wait(lock);
+                m_job = std::function< void(std::size_t) >();
+                if (m_error)
+                    std::rethrow_exception(m_error);
+            }
+
+            // Call f(i, first, last) for the size() contiguous blocks
+            // [first, last) of [0, n), one block per thread.
+            template < typename Size, typename Function >
+            void for_each_block(Size n, Function f)
+            {
+                const std::size_t num_blocks = m_size;
+                run([&](std::size_t i) {
+                    f(i, block_begin(n, num_blocks, i),
+                        block_begin(n, num_blocks, i + 1));
+                });
+            }
+
+        private:
+            void stop_workers()
+            {
+                {
+                    std::lock_guard< std::mutex > lock(m_mutex);
+                    m_stop = true;
+                }
+                m_start.notify_all();
+                for (std::size_t i = 0; i < m_workers.size(); ++i)
+                    m_workers[i].join();
+            }
+
+            void call(std::size_t i)
+            {
+                try
+                {
+                    m_job(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard< std::mutex > lock(m_mutex);
+                    if (!m_error)
+                        m_error = std::current_exception();
+                }
+            }
+
+            void worker_loop(std::size_t i)
+            {
+                std::size_t seen_generation = 0;
+                for (;;)
+                {
+                    {
+                        std::unique_lock< std::mutex > lock(m_mutex);
+                        while (!m_stop && m_generation == seen_generation)
+                            m_start.wait(lock);
+                        if (m_stop)
+                            return;
+                        seen_generation = m_generation;
+                    }
+                    call(i);
+                    {
+                        std::lock_guard< std::mutex > lock(m_mutex);
+                        BOOST_ASSERT(m_pending > 0);
+                        if (--m_pending == 0)
+                            m_done.notify_one();
+                    }
+                }
+            }
+
+            std::size_t m_size;
+            std::vector< std::thread > m_workers;
+            std::mutex m_mutex;
+            std::condition_variable m_start;
+            std::condition_variable m_done;
+            std::function< void(std::size_t) > m_job;
+            std::exception_ptr m_error;
+            std::size_t m_generation;
+            std::size_t m_pending;
+            bool m_stop;
+        };
+
+    }
+}
+}
+
+#endif // BOOST_GRAPH_NO_THREAD_POOL
+
+#endif // BOOST_GRAPH_DETAIL_THREAD_POOL_HPP
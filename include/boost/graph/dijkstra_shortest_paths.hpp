@@ -19,12 +19,15 @@
 #include <boost/limits.hpp>
 #include <boost/graph/named_function_params.hpp>
 #include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/search_workspace.hpp>
 #include <boost/graph/relax.hpp>
 #include <boost/pending/indirect_cmp.hpp>
 #include <boost/graph/exception.hpp>
 #include <boost/graph/overloading.hpp>
 #include <boost/smart_ptr.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/radix_heap.hpp>
+#include <boost/graph/detail/bucket_queue.hpp>
 #include <boost/graph/two_bit_color_map.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
 #include <boost/property_map/property_map.hpp>
@@ -322,6 +325,182 @@ namespace detail
     };
 }
 
+// Selectors for the priority queue used by dijkstra_shortest_paths, passed
+// with the priority_queue_selector named parameter.  The radix heap and the
+// bucket queue are monotone priority queues that require integral distances
+// ordered by std::less and non-negative edge weights; the bucket queue keeps
+// one bucket per distance value up to the largest edge weight, which is
+// computed from the graph unless given to bucket_queueS.
+struct d_ary_heapS
+{
+};
+struct radix_heapS
+{
+};
+struct bucket_queueS
+{
+    explicit bucket_queueS(std::size_t max_weight = 0)
+    : max_weight(max_weight)
+    {
+    }
+    std::size_t max_weight;
+};
+
+// Maps a priority queue selector to the queue type; specialize it to use
+// dijkstra_shortest_paths with another selector.  build() may store the
+// index in heap of each vertex in index_in_heap_holder.
+template < class QueueSelector, class Graph, class IndexMap,
+    class DistanceMap, class WeightMap, class Compare >
+struct dijkstra_queue_generator
+{
+};
+
+template < class Graph, class IndexMap, class DistanceMap, class WeightMap,
+    class Compare >
+struct dijkstra_queue_generator< d_ary_heapS, Graph, IndexMap, DistanceMap,
+    WeightMap, Compare >
+{
+    typedef detail::vertex_property_map_generator< Graph, IndexMap,
+        std::size_t >
+        IndexInHeapMapHelper;
+    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+    typedef d_ary_heap_indirect<
+        typename graph_traits< Graph >::vertex_descriptor, 4, IndexInHeapMap,
+        DistanceMap, Compare >
+        type;
+    static type build(const Graph& g, const IndexMap& index,
+        DistanceMap distance, WeightMap, const Compare& compare, d_ary_heapS,
+        boost::scoped_array< std::size_t >& index_in_heap_holder)
+    {
+        return type(distance,
+            IndexInHeapMapHelper::build(g, index, index_in_heap_holder),
+            compare);
+    }
+};
+
+template < class Graph, class IndexMap, class DistanceMap, class WeightMap,
+    class Compare >
+struct dijkstra_queue_generator< radix_heapS, Graph, IndexMap, DistanceMap,
+    WeightMap, Compare >
+{
+    typedef detail::vertex_property_map_generator< Graph, IndexMap,
+        std::size_t >
+        IndexInHeapMapHelper;
+    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+    typedef radix_heap_indirect<
+        typename graph_traits< Graph >::vertex_descriptor, IndexInHeapMap,
+        DistanceMap >
+        type;
+    static type build(const Graph& g, const IndexMap& index,
+        DistanceMap distance, WeightMap, const Compare&, radix_heapS,
+        boost::scoped_array< std::size_t >& index_in_heap_holder)
+    {
+        return type(distance,
+            IndexInHeapMapHelper::build(g, index, index_in_heap_holder));
+    }
+};
+
+template < class Graph, class IndexMap, class DistanceMap, class WeightMap,
+    class Compare >
+struct dijkstra_queue_generator< bucket_queueS, Graph, IndexMap, DistanceMap,
+    WeightMap, Compare >
+{
+    typedef detail::vertex_property_map_generator< Graph, IndexMap,
+        std::size_t >
+        IndexInHeapMapHelper;
+    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+    typedef bucket_queue_indirect<
+        typename graph_traits< Graph >::vertex_descriptor, IndexInHeapMap,
+        DistanceMap >
+        type;
+    static type build(const Graph& g, const IndexMap& index,
+        DistanceMap distance, WeightMap weight, const Compare&,
+        bucket_queueS selector,
+        boost::scoped_array< std::size_t >& index_in_heap_holder)
+    {
+        std::size_t max_weight = selector.max_weight;
+        if (max_weight == 0)
+        {
+            typename graph_traits< Graph >::vertex_iterator ui, ui_end;
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
+                for (boost::tie(ei, ei_end) = out_edges(*ui, g); ei != ei_end;
+                     ++ei)
+                {
+                    typename property_traits< WeightMap >::value_type w
+                        = get(weight, *ei);
+                    if (w > 0 && std::size_t(w) > max_weight)
+                        max_weight = std::size_t(w);
+                }
+        }
+        return type(distance,
+            IndexInHeapMapHelper::build(g, index, index_in_heap_holder),
+            max_weight);
+    }
+};
+
+namespace detail
+{
+    // Run the search with the queue chosen by queue_selector
+    template < class Graph, class SourceInputIter, class DijkstraVisitor,
+        class PredecessorMap, class DistanceMap, class WeightMap,
+        class IndexMap, class Compare, class Combine, class DistZero,
+        class ColorMap, class QueueSelector >
+    inline void dijkstra_no_init_dispatch(const Graph& g,
+        SourceInputIter s_begin, SourceInputIter s_end,
+        PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+        IndexMap index_map, Compare compare, Combine combine, DistZero zero,
+        DijkstraVisitor vis, ColorMap color, QueueSelector queue_selector)
+    {
+        typedef dijkstra_queue_generator< QueueSelector, Graph, IndexMap,
+            DistanceMap, WeightMap, Compare >
+            QueueGenerator;
+        typedef typename QueueGenerator::type MutableQueue;
+        boost::scoped_array< std::size_t > index_in_heap_map_holder;
+        MutableQueue Q = QueueGenerator::build(g, index_map, distance, weight,
+            compare, queue_selector, index_in_heap_map_holder);
+
+        detail::dijkstra_bfs_visitor< DijkstraVisitor, MutableQueue,
+            WeightMap, PredecessorMap, DistanceMap, Combine, Compare >
+            bfs_vis(
+                vis, Q, weight, predecessor, distance, combine, compare, zero);
+
+        breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+    }
+
+    // Initialize distances and run the search with the chosen queue
+    template < class VertexListGraph, class SourceInputIter,
+        class DijkstraVisitor, class PredecessorMap, class DistanceMap,
+        class WeightMap, class IndexMap, class Compare, class Combine,
+        class DistInf, class DistZero, class ColorMap, class QueueSelector >
+    inline void dijkstra_dispatch3(const VertexListGraph& g,
+        SourceInputIter s_begin, SourceInputIter s_end,
+        PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+        IndexMap index_map, Compare compare, Combine combine, DistInf inf,
+        DistZero zero, DijkstraVisitor vis, ColorMap color,
+        QueueSelector queue_selector)
+    {
+        typedef typename property_traits< ColorMap >::value_type ColorValue;
+        typedef color_traits< ColorValue > Color;
+        typename graph_traits< VertexListGraph >::vertex_iterator ui, ui_end;
+        for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
+        {
+            vis.initialize_vertex(*ui, g);
+            put(distance, *ui, inf);
+            put(predecessor, *ui, *ui);
+            put(color, *ui, Color::white());
+        }
+        for (SourceInputIter it = s_begin; it != s_end; ++it)
+        {
+            put(distance, *it, zero);
+        }
+
+        dijkstra_no_init_dispatch(g, s_begin, s_end, predecessor, distance,
+            weight, index_map, compare, combine, zero, vis, color,
+            queue_selector);
+    }
+} // namespace detail
+
 // Call breadth first search with default color map.
 template < class Graph, class SourceInputIter, class DijkstraVisitor,
     class PredecessorMap, class DistanceMap, class WeightMap, class IndexMap,
@@ -362,29 +541,8 @@ inline void dijkstra_shortest_paths_no_init(const Graph& g,
     DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
     Combine combine, DistZero zero, DijkstraVisitor vis, ColorMap color)
 {
-    typedef indirect_cmp< DistanceMap, Compare > IndirectCmp;
-    IndirectCmp icmp(distance, compare);
-
-    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
-
-    // Now the default: use a d-ary heap
-    boost::scoped_array< std::size_t > index_in_heap_map_holder;
-    typedef detail::vertex_property_map_generator< Graph, IndexMap,
-        std::size_t >
-        IndexInHeapMapHelper;
-    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
-    IndexInHeapMap index_in_heap
-        = IndexInHeapMapHelper::build(g, index_map, index_in_heap_map_holder);
-    typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
-        Compare >
-        MutableQueue;
-    MutableQueue Q(distance, index_in_heap, compare);
-
-    detail::dijkstra_bfs_visitor< DijkstraVisitor, MutableQueue, WeightMap,
-        PredecessorMap, DistanceMap, Combine, Compare >
-        bfs_vis(vis, Q, weight, predecessor, distance, combine, compare, zero);
-
-    breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+    detail::dijkstra_no_init_dispatch(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, zero, vis, color, d_ary_heapS());
 }
 
 // Call breadth first search
@@ -401,6 +559,45 @@ inline void dijkstra_shortest_paths_no_init(const Graph& g,
         weight, index_map, compare, combine, zero, vis, color);
 }
 
+// Start a new query on the workspace and call breadth first search with its
+// labels and queue, in time proportional to the vertices reached
+template < class Graph, class SourceInputIter, class Distance, class IndexMap,
+    class WeightMap, class DijkstraVisitor >
+inline void dijkstra_shortest_paths_no_init(const Graph& g,
+    SourceInputIter s_begin, SourceInputIter s_end,
+    search_workspace< Graph, Distance, IndexMap >& workspace,
+    WeightMap weight, DijkstraVisitor vis)
+{
+    typedef search_workspace< Graph, Distance, IndexMap > Workspace;
+    typedef typename Workspace::queue_type MutableQueue;
+    typedef typename Workspace::distance_map_type DistanceMap;
+    typedef typename Workspace::predecessor_map_type PredecessorMap;
+    typedef closed_plus< Distance > Combine;
+    typedef std::less< Distance > Compare;
+
+    workspace.new_query();
+    DistanceMap distance = workspace.distance_map();
+    for (SourceInputIter it = s_begin; it != s_end; ++it)
+        put(distance, *it, Distance());
+    MutableQueue& Q = workspace.distance_queue();
+    detail::dijkstra_bfs_visitor< DijkstraVisitor, MutableQueue, WeightMap,
+        PredecessorMap, DistanceMap, Combine, Compare >
+        bfs_vis(vis, Q, weight, workspace.predecessor_map(), distance,
+            Combine((std::numeric_limits< Distance >::max)()), Compare(),
+            Distance());
+    breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, workspace.color_map());
+}
+
+template < class Graph, class Distance, class IndexMap, class WeightMap,
+    class DijkstraVisitor >
+inline void dijkstra_shortest_paths_no_init(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    search_workspace< Graph, Distance, IndexMap >& workspace,
+    WeightMap weight, DijkstraVisitor vis)
+{
+    dijkstra_shortest_paths_no_init(g, &s, &s + 1, workspace, weight, vis);
+}
+
 // Initialize distances and call breadth first search with default color map
 template < class VertexListGraph, class SourceInputIter, class DijkstraVisitor,
     class PredecessorMap, class DistanceMap, class WeightMap, class IndexMap,
@@ -410,12 +607,15 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     SourceInputIter s_begin, SourceInputIter s_end, PredecessorMap predecessor,
     DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
     Combine combine, DistInf inf, DistZero zero, DijkstraVisitor vis,
-    const bgl_named_params< T, Tag, Base >& BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
-        VertexListGraph, vertex_list_graph_tag))
+    const bgl_named_params< T, Tag, Base >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+            VertexListGraph, vertex_list_graph_tag))
 {
     boost::two_bit_color_map< IndexMap > color(num_vertices(g), index_map);
-    dijkstra_shortest_paths(g, s_begin, s_end, predecessor, distance, weight,
-        index_map, compare, combine, inf, zero, vis, color);
+    detail::dijkstra_dispatch3(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, inf, zero, vis, color,
+        choose_param(get_param(params, priority_queue_selector_t()),
+            d_ary_heapS()));
 }
 
 // Initialize distances and call breadth first search with default color map
@@ -428,11 +628,12 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
     IndexMap index_map, Compare compare, Combine combine, DistInf inf,
     DistZero zero, DijkstraVisitor vis,
-    const bgl_named_params< T, Tag, Base >& BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
-        VertexListGraph, vertex_list_graph_tag))
+    const bgl_named_params< T, Tag, Base >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+            VertexListGraph, vertex_list_graph_tag))
 {
     dijkstra_shortest_paths(g, &s, &s + 1, predecessor, distance, weight,
-        index_map, compare, combine, inf, zero, vis);
+        index_map, compare, combine, inf, zero, vis, params);
 }
 
 // Initialize distances and call breadth first search
@@ -446,23 +647,9 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     Combine combine, DistInf inf, DistZero zero, DijkstraVisitor vis,
     ColorMap color)
 {
-    typedef typename property_traits< ColorMap >::value_type ColorValue;
-    typedef color_traits< ColorValue > Color;
-    typename graph_traits< VertexListGraph >::vertex_iterator ui, ui_end;
-    for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
-    {
-        vis.initialize_vertex(*ui, g);
-        put(distance, *ui, inf);
-        put(predecessor, *ui, *ui);
-        put(color, *ui, Color::white());
-    }
-    for (SourceInputIter it = s_begin; it != s_end; ++it)
-    {
-        put(distance, *it, zero);
-    }
-
-    dijkstra_shortest_paths_no_init(g, s_begin, s_end, predecessor, distance,
-        weight, index_map, compare, combine, zero, vis, color);
+    detail::dijkstra_dispatch3(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, inf, zero, vis, color,
+        d_ary_heapS());
 }
 
 // Initialize distances and call breadth first search
@@ -0,0 +1,251 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DIRECTION_OPTIMIZING_BREADTH_FIRST_SEARCH_HPP
+#define BOOST_GRAPH_DIRECTION_OPTIMIZING_BREADTH_FIRST_SEARCH_HPP
+
+/*
+  Direction-optimizing breadth-first search (S. Beamer, K. Asanovic and
+  D. Patterson, "Direction-Optimizing Breadth-First Search", SC 2012).
+
+  Levels with a small frontier are expanded top-down, by scanning the
+  out-edges of the frontier vertices.  When the frontier becomes large
+  relative to the unexplored part of the graph, levels are instead expanded
+  bottom-up: every unvisited vertex scans its in-edges until it finds a
+  parent in the frontier, which is kept as a bitmap.  On low-diameter graphs
+  this skips most of the edges the top-down traversal would examine.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Dense set of vertex indices, used for the visited set and for the
+    // frontiers of the bottom-up levels.
+    class bfs_vertex_bitmap
+    {
+    public:
+        explicit bfs_vertex_bitmap(std::size_t n) : m_words((n + 63) / 64, 0)
+        {
+        }
+
+        bool test(std::size_t i) const
+        {
+            return (m_words[i / 64] >> (i % 64)) & 1;
+        }
+
+        void set(std::size_t i)
+        {
+            m_words[i / 64] |= boost::uint64_t(1) << (i % 64);
+        }
+
+        void clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+
+        void swap(bfs_vertex_bitmap& other) { m_words.swap(other.m_words); }
+
+    private:
+        std::vector< boost::uint64_t > m_words;
+    };
+
+    // Expand one level top-down.  Returns the sum of the out-degrees of the
+    // vertices discovered, which is the number of edges the next top-down
+    // level would examine.
+    template < typename Graph, typename DistanceMap, typename PredecessorMap,
+        typename VertexIndexMap, typename Distance >
+    std::size_t dobfs_top_down_step(const Graph& g,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            frontier,
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >& next,
+        bfs_vertex_bitmap& visited, DistanceMap distance,
+        PredecessorMap predecessor, VertexIndexMap index, Distance level)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+        std::size_t scout_count = 0;
+        for (std::size_t i = 0; i < frontier.size(); ++i)
+        {
+            Vertex u = frontier[i];
+            for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+            {
+                Vertex v = target(*ei, g);
+                std::size_t v_index = get(index, v);
+                if (!visited.test(v_index))
+                {
+                    visited.set(v_index);
+                    put(distance, v, level);
+                    put(predecessor, v, u);
+                    next.push_back(v);
+                    scout_count += out_degree(v, g);
+                }
+            }
+        }
+        return scout_count;
+    }
+
+    // Expand one level bottom-up.  Returns the number of vertices
+    // discovered.
+    template < typename Graph, typename DistanceMap, typename PredecessorMap,
+        typename VertexIndexMap, typename Distance >
+    std::size_t dobfs_bottom_up_step(const Graph& g,
+        const bfs_vertex_bitmap& frontier, bfs_vertex_bitmap& next,
+        bfs_vertex_bitmap& visited, DistanceMap distance,
+        PredecessorMap predecessor, VertexIndexMap index, Distance level)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        typename graph_traits< Graph >::in_edge_iterator ei, ei_end;
+        std::size_t awake_count = 0;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            Vertex v = *vi;
+            std::size_t v_index = get(index, v);
+            if (visited.test(v_index))
+                continue;
+            for (boost::tie(ei, ei_end) = in_edges(v, g); ei != ei_end; ++ei)
+            {
+                Vertex u = source(*ei, g);
+                if (frontier.test(get(index, u)))
+                {
+                    visited.set(v_index);
+                    put(distance, v, level);
+                    put(predecessor, v, u);
+                    next.set(v_index);
+                    ++awake_count;
+                    break;
+                }
+            }
+        }
+        return awake_count;
+    }
+} // namespace detail
+
+/* Breadth-first search from s that records, for every vertex reachable from
+   s, its distance in edges from s in distance and its parent in a
+   breadth-first tree in predecessor.  The predecessor of s is s itself;
+   vertices that are not reachable are not written.  The graph must model
+   BidirectionalGraph (the in-edges are scanned by the bottom-up levels) and
+   VertexListGraph.
+
+   alpha and beta are the switching heuristics of Beamer et al.: a level is
+   expanded bottom-up once the frontier's out-edges exceed 1/alpha of the
+   edges left unexplored, and top-down again once the frontier shrinks to
+   fewer than 1/beta of the vertices.
+*/
+template < typename Graph, typename DistanceMap, typename PredecessorMap,
+    typename VertexIndexMap >
+void direction_optimizing_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, DistanceMap distance,
+    PredecessorMap predecessor, VertexIndexMap index, double alpha = 15.0,
+    double beta = 18.0)
+{
+    BOOST_CONCEPT_ASSERT((BidirectionalGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename property_traits< DistanceMap >::value_type Distance;
+    BOOST_CONCEPT_ASSERT((WritablePropertyMapConcept< DistanceMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (WritablePropertyMapConcept< PredecessorMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (ReadablePropertyMapConcept< VertexIndexMap, Vertex >));
+
+    const std::size_t n = num_vertices(g);
+    detail::bfs_vertex_bitmap visited(n), front(n), next_front(n);
+    std::vector< Vertex > queue, next_queue;
+
+    // Number of edges the remaining top-down levels could examine
+    double edges_to_check = 0;
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        edges_to_check += double(out_degree(*vi, g));
+
+    Distance level = Distance();
+    visited.set(get(index, s));
+    put(distance, s, level);
+    put(predecessor, s, s);
+    queue.push_back(s);
+    std::size_t scout_count = out_degree(s, g);
+
+    while (!queue.empty())
+    {
+        if (double(scout_count) > edges_to_check / alpha)
+        {
+            // Switch to bottom-up until the frontier shrinks again
+            for (std::size_t i = 0; i < queue.size(); ++i)
+                front.set(get(index, queue[i]));
+            std::size_t awake_count = queue.size();
+            std::size_t old_awake_count;
+            do
+            {
+                old_awake_count = awake_count;
+                ++level;
+                awake_count = detail::dobfs_bottom_up_step(g, front,
+                    next_front, visited, distance, predecessor, index, level);
+                front.swap(next_front);
+                next_front.clear();
+            } while (awake_count >= old_awake_count
+                || double(awake_count) > double(n) / beta);
+
+            queue.clear();
+            if (awake_count != 0)
+            {
+                for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+                    if (front.test(get(index, *vi)))
+                        queue.push_back(*vi);
+            }
+            front.clear();
+            scout_count = 1;
+        }
+        else
+        {
+            ++level;
+            edges_to_check -= double(scout_count);
+            scout_count = detail::dobfs_top_down_step(g, queue, next_queue,
+                visited, distance, predecessor, index, level);
+            queue.swap(next_queue);
+            next_queue.clear();
+        }
+    }
+}
+
+template < typename Graph, typename DistanceMap, typename PredecessorMap >
+void direction_optimizing_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, DistanceMap distance,
+    PredecessorMap predecessor)
+{
+    direction_optimizing_breadth_first_search(
+        g, s, distance, predecessor, get(vertex_index, g));
+}
+
+// Named parameter variant: distance_map, predecessor_map and
+// vertex_index_map are all optional.
+template < typename Graph, typename P, typename T, typename R >
+void direction_optimizing_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< P, T, R >& params)
+{
+    direction_optimizing_breadth_first_search(g, s,
+        choose_param(get_param(params, vertex_distance), dummy_property_map()),
+        choose_param(
+            get_param(params, vertex_predecessor), dummy_property_map()),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index));
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DIRECTION_OPTIMIZING_BREADTH_FIRST_SEARCH_HPP
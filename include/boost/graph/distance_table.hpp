@@ -0,0 +1,481 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_DISTANCE_TABLE_HPP
+#define BOOST_GRAPH_DISTANCE_TABLE_HPP
+
+/*
+  Many-to-many shortest path distances.
+
+  dijkstra_distance_table copies the graph once into a compressed sparse
+  row layout with the weights next to the targets, which all threads then
+  share, and runs one Dijkstra search per source on it.  The sources are
+  handed to the threads through an atomic counter; each thread reuses one
+  search_workspace, so a search costs time proportional to the vertices it
+  touches, and stops as soon as all targets are settled.
+
+  contraction_hierarchy_distance_table uses the bucket method of S. Knopp,
+  P. Sanders, D. Schultes, F. Schulz and D. Wagner ("Computing
+  many-to-many shortest paths using highway hierarchies", 2007) on a
+  contraction_hierarchy.  An upward search over the reversed edges from
+  each target t leaves an entry (t, d(v, t)) in the bucket of every vertex
+  v it reaches.  An upward search from each source s then scans the buckets
+  of the vertices it reaches: the distance from s to t is the smallest
+  d(s, v) + d(v, t).  Both kinds of searches run in parallel, and only
+  visit the small upward search spaces of the hierarchy, so this is much
+  faster than Dijkstra's algorithm when the hierarchy is already built.
+
+  Both write row i of the table, the distances from the i-th source to all
+  targets, from a single thread, either to a dense matrix D[i][j] or to a
+  sparse table whose row i receives the pairs (j, distance) of the
+  reachable targets.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/search_workspace.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/contraction_hierarchy.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Row i of a dense table is written to D[i][j]
+    template < typename DistanceMatrix > class dense_distance_table_writer
+    {
+    public:
+        explicit dense_distance_table_writer(DistanceMatrix& table)
+        : m_table(table)
+        {
+        }
+
+        template < typename Distance >
+        void write_row(std::size_t i, const std::vector< Distance >& row) const
+        {
+            for (std::size_t j = 0; j < row.size(); ++j)
+                m_table[i][j] = row[j];
+        }
+
+    private:
+        DistanceMatrix& m_table;
+    };
+
+    // Row i of a sparse table receives the pairs (j, distance) of the
+    // reachable targets
+    template < typename SparseTable > class sparse_distance_table_writer
+    {
+    public:
+        explicit sparse_distance_table_writer(SparseTable& table)
+        : m_table(table)
+        {
+        }
+
+        template < typename Distance >
+        void write_row(std::size_t i, const std::vector< Distance >& row) const
+        {
+            m_table[i].clear();
+            for (std::size_t j = 0; j < row.size(); ++j)
+            {
+                if (row[j] != (std::numeric_limits< Distance >::max)())
+                    m_table[i].push_back(std::make_pair(j, row[j]));
+            }
+        }
+
+    private:
+        SparseTable& m_table;
+    };
+
+    // Thrown by distance_table_visitor once all targets are settled
+    struct distance_table_done
+    {
+    };
+
+    // Stops a search once the targets, counted with their multiplicity in
+    // target_count, have all been examined
+    template < typename Vertex >
+    class distance_table_visitor : public default_dijkstra_visitor
+    {
+    public:
+        distance_table_visitor(
+            const std::vector< std::size_t >& target_count,
+            std::size_t& remaining)
+        : m_target_count(&target_count), m_remaining(&remaining)
+        {
+        }
+
+        template < typename Graph > void examine_vertex(Vertex u, const Graph&)
+        {
+            std::size_t count = (*m_target_count)[u];
+            if (count != 0)
+            {
+                *m_remaining -= count;
+                if (*m_remaining == 0)
+                    throw distance_table_done();
+            }
+        }
+
+    private:
+        const std::vector< std::size_t >* m_target_count;
+        std::size_t* m_remaining;
+    };
+
+    template < typename Graph, typename SourceIterator,
+        typename TargetIterator, typename TableWriter, typename WeightMap,
+        typename VertexIndexMap >
+    void dijkstra_distance_table_impl(const Graph& g, SourceIterator s_begin,
+        SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+        const TableWriter& writer, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads)
+    {
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        typedef compressed_sparse_row_graph< directedS, no_property,
+            Distance >
+            Layout;
+        typedef typename graph_traits< Layout >::vertex_descriptor Vertex;
+        typedef search_workspace< Layout, Distance > Workspace;
+
+        std::vector< Vertex > sources, targets;
+        for (; s_begin != s_end; ++s_begin)
+            sources.push_back(Vertex(get(index, *s_begin)));
+        for (; t_begin != t_end; ++t_begin)
+            targets.push_back(Vertex(get(index, *t_begin)));
+
+        // Graph layout shared by all searches
+        std::vector< std::pair< Vertex, Vertex > > edges;
+        std::vector< Distance > weights;
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end;
+                 ++ei)
+            {
+                Distance w = get(weight, *ei);
+                if (w < Distance())
+                    boost::throw_exception(negative_edge());
+                edges.push_back(std::make_pair(Vertex(get(index, *vi)),
+                    Vertex(get(index, target(*ei, g)))));
+                weights.push_back(w);
+            }
+        }
+        Vertex n = Vertex(num_vertices(g));
+        Layout layout(edges_are_unsorted_multi_pass_parallel, edges.begin(),
+            edges.end(), weights.begin(), n, num_threads);
+        std::vector< std::pair< Vertex, Vertex > >().swap(edges);
+        std::vector< Distance >().swap(weights);
+
+        std::vector< std::size_t > target_count(n, 0);
+        for (std::size_t j = 0; j < targets.size(); ++j)
+            ++target_count[targets[j]];
+
+        std::atomic< std::size_t > next_source(0);
+        boost::graph::detail::thread_pool pool(
+            (std::min)(boost::graph::detail::resolve_num_threads(num_threads),
+                (std::max)(sources.size(), std::size_t(1))));
+        pool.run([&](std::size_t) {
+            Workspace workspace(layout);
+            std::vector< Distance > row(targets.size());
+            for (;;)
+            {
+                std::size_t i = next_source++;
+                if (i >= sources.size())
+                    break;
+                std::size_t remaining = targets.size();
+                if (remaining != 0)
+                {
+                    try
+                    {
+                        dijkstra_shortest_paths_no_init(layout, sources[i],
+                            workspace, get(edge_bundle, layout),
+                            distance_table_visitor< Vertex >(
+                                target_count, remaining));
+                    }
+                    catch (const distance_table_done&)
+                    {
+                    }
+                }
+                for (std::size_t j = 0; j < targets.size(); ++j)
+                    row[j] = get(workspace.distance_map(), targets[j]);
+                writer.write_row(i, row);
+            }
+        });
+    }
+
+    // Complete upward search from a vertex in one of the search graphs of
+    // a contraction hierarchy.  The labels are reset in time proportional
+    // to the number of vertices touched.
+    template < typename Weight, typename Vertex >
+    class ch_upward_search : boost::noncopyable
+    {
+    public:
+        typedef typename contraction_hierarchy< Weight,
+            Vertex >::search_graph_type Graph;
+
+        explicit ch_upward_search(std::size_t n)
+        : m_distance((std::max)(n, std::size_t(1)), inf())
+        , m_index_in_heap(m_distance.size(), std::size_t(-1))
+        , m_queue(DistanceMap(&m_distance[0]),
+              IndexInHeapMap(&m_index_in_heap[0]))
+        {
+        }
+
+        // Search from s; afterwards touched() holds the vertices reached
+        // and distance(v) their distances
+        void run(const Graph& g, Vertex s)
+        {
+            for (std::size_t i = 0; i < m_touched.size(); ++i)
+                m_distance[m_touched[i]] = inf();
+            m_touched.clear();
+            m_distance[s] = Weight(0);
+            m_touched.push_back(s);
+            m_queue.push(s);
+            while (!m_queue.empty())
+            {
+                Vertex u = m_queue.top();
+                m_queue.pop();
+                Weight du = m_distance[u];
+                typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end;
+                     ++ei)
+                {
+                    Vertex v = target(*ei, g);
+                    Weight d = du + g[*ei].weight;
+                    if (d < m_distance[v])
+                    {
+                        if (m_distance[v] == inf())
+                            m_touched.push_back(v);
+                        m_distance[v] = d;
+                        m_queue.push_or_update(v);
+                    }
+                }
+            }
+        }
+
+        const std::vector< Vertex >& touched() const { return m_touched; }
+
+        Weight distance(Vertex v) const { return m_distance[v]; }
+
+    private:
+        typedef iterator_property_map< Weight*, identity_property_map >
+            DistanceMap;
+        typedef iterator_property_map< std::size_t*, identity_property_map >
+            IndexInHeapMap;
+        typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
+            std::less< Weight > >
+            Queue;
+
+        static Weight inf() { return (std::numeric_limits< Weight >::max)(); }
+
+        std::vector< Weight > m_distance;
+        std::vector< std::size_t > m_index_in_heap;
+        std::vector< Vertex > m_touched;
+        Queue m_queue;
+    };
+
+    template < typename Weight, typename Vertex, typename SourceIterator,
+        typename TargetIterator, typename TableWriter >
+    void ch_distance_table_impl(
+        const contraction_hierarchy< Weight, Vertex >& ch,
+        SourceIterator s_begin, SourceIterator s_end, TargetIterator t_begin,
+        TargetIterator t_end, const TableWriter& writer,
+        std::size_t num_threads)
+    {
+        typedef ch_upward_search< Weight, Vertex > Search;
+        // Entry (j, d(v, targets[j])) of the bucket of v
+        typedef std::pair< std::size_t, Weight > BucketEntry;
+
+        std::vector< Vertex > sources(s_begin, s_end), targets(t_begin, t_end);
+        std::size_t n = ch.num_vertices();
+        boost::graph::detail::thread_pool pool(
+            (std::min)(boost::graph::detail::resolve_num_threads(num_threads),
+                (std::max)((std::max)(sources.size(), targets.size()),
+                    std::size_t(1))));
+
+        // Backward searches from the targets, each thread collecting the
+        // entries (v, j, d) of a block of targets
+        std::vector< std::vector< std::pair< Vertex, BucketEntry > > >
+            entries(pool.size());
+        pool.for_each_block(targets.size(),
+            [&](std::size_t b, std::size_t first, std::size_t last) {
+                Search search(n);
+                for (std::size_t j = first; j < last; ++j)
+                {
+                    BOOST_ASSERT(targets[j] < n);
+                    search.run(ch.downward_graph(), targets[j]);
+                    for (std::size_t k = 0; k < search.touched().size(); ++k)
+                    {
+                        Vertex v = search.touched()[k];
+                        entries[b].push_back(std::make_pair(
+                            v, BucketEntry(j, search.distance(v))));
+                    }
+                }
+            });
+
+        // Buckets in a compressed sparse row layout
+        std::vector< std::size_t > bucket_start(n + 1, 0);
+        for (std::size_t b = 0; b < entries.size(); ++b)
+        {
+            for (std::size_t k = 0; k < entries[b].size(); ++k)
+                ++bucket_start[entries[b][k].first + 1];
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            bucket_start[v + 1] += bucket_start[v];
+        std::vector< BucketEntry > buckets(bucket_start[n]);
+        {
+            std::vector< std::size_t > fill(
+                bucket_start.begin(), bucket_start.end() - 1);
+            for (std::size_t b = 0; b < entries.size(); ++b)
+            {
+                for (std::size_t k = 0; k < entries[b].size(); ++k)
+                    buckets[fill[entries[b][k].first]++]
+                        = entries[b][k].second;
+                std::vector< std::pair< Vertex, BucketEntry > >().swap(
+                    entries[b]);
+            }
+        }
+
+        // Forward searches from the sources scan the buckets
+        std::atomic< std::size_t > next_source(0);
+        pool.run([&](std::size_t) {
+            Search search(n);
+            std::vector< Weight > row(targets.size());
+            for (;;)
+            {
+                std::size_t i = next_source++;
+                if (i >= sources.size())
+                    break;
+                BOOST_ASSERT(sources[i] < n);
+                std::fill(row.begin(), row.end(),
+                    (std::numeric_limits< Weight >::max)());
+                search.run(ch.upward_graph(), sources[i]);
+                for (std::size_t k = 0; k < search.touched().size(); ++k)
+                {
+                    Vertex v = search.touched()[k];
+                    Weight dv = search.distance(v);
+                    for (std::size_t e = bucket_start[v];
+                         e < bucket_start[v + 1]; ++e)
+                    {
+                        Weight d = dv + buckets[e].second;
+                        if (d < row[buckets[e].first])
+                            row[buckets[e].first] = d;
+                    }
+                }
+                writer.write_row(i, row);
+            }
+        });
+    }
+}
+
+/** Distances from every source to every target with Dijkstra's algorithm.
+ *
+ * D[i][j] is set to the length of a shortest path from the i-th source to
+ * the j-th target, or std::numeric_limits<Distance>::max() if there is
+ * none, where Distance is the value type of the weight map.  The rows are
+ * computed by num_threads threads (0 for one per hardware thread), each
+ * row by a single thread.
+ */
+template < typename Graph, typename SourceIterator, typename TargetIterator,
+    typename DistanceMatrix, typename WeightMap, typename VertexIndexMap >
+void dijkstra_distance_table(const Graph& g, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    DistanceMatrix& D, WeightMap weight, VertexIndexMap index,
+    std::size_t num_threads = 0)
+{
+    detail::dijkstra_distance_table_impl(g, s_begin, s_end, t_begin, t_end,
+        detail::dense_distance_table_writer< DistanceMatrix >(D), weight,
+        index, num_threads);
+}
+
+template < typename Graph, typename SourceIterator, typename TargetIterator,
+    typename DistanceMatrix >
+void dijkstra_distance_table(const Graph& g, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    DistanceMatrix& D, std::size_t num_threads = 0)
+{
+    dijkstra_distance_table(g, s_begin, s_end, t_begin, t_end, D,
+        get(edge_weight, g), get(vertex_index, g), num_threads);
+}
+
+/** Like dijkstra_distance_table, but row i of table is cleared and
+ * receives std::make_pair(j, d) for each target j reachable from the i-th
+ * source at distance d, in increasing order of j.
+ */
+template < typename Graph, typename SourceIterator, typename TargetIterator,
+    typename SparseTable, typename WeightMap, typename VertexIndexMap >
+void dijkstra_sparse_distance_table(const Graph& g, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    SparseTable& table, WeightMap weight, VertexIndexMap index,
+    std::size_t num_threads = 0)
+{
+    detail::dijkstra_distance_table_impl(g, s_begin, s_end, t_begin, t_end,
+        detail::sparse_distance_table_writer< SparseTable >(table), weight,
+        index, num_threads);
+}
+
+template < typename Graph, typename SourceIterator, typename TargetIterator,
+    typename SparseTable >
+void dijkstra_sparse_distance_table(const Graph& g, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    SparseTable& table, std::size_t num_threads = 0)
+{
+    dijkstra_sparse_distance_table(g, s_begin, s_end, t_begin, t_end, table,
+        get(edge_weight, g), get(vertex_index, g), num_threads);
+}
+
+/** Distances from every source to every target with the bucket method on
+ * a contraction hierarchy.  Sources and targets are vertex indices of the
+ * hierarchy; D[i][j] is set as by dijkstra_distance_table.
+ */
+template < typename Weight, typename Vertex, typename SourceIterator,
+    typename TargetIterator, typename DistanceMatrix >
+void contraction_hierarchy_distance_table(
+    const contraction_hierarchy< Weight, Vertex >& ch, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    DistanceMatrix& D, std::size_t num_threads = 0)
+{
+    detail::ch_distance_table_impl(ch, s_begin, s_end, t_begin, t_end,
+        detail::dense_distance_table_writer< DistanceMatrix >(D),
+        num_threads);
+}
+
+template < typename Weight, typename Vertex, typename SourceIterator,
+    typename TargetIterator, typename SparseTable >
+void contraction_hierarchy_sparse_distance_table(
+    const contraction_hierarchy< Weight, Vertex >& ch, SourceIterator s_begin,
+    SourceIterator s_end, TargetIterator t_begin, TargetIterator t_end,
+    SparseTable& table, std::size_t num_threads = 0)
+{
+    detail::ch_distance_table_impl(ch, s_begin, s_end, t_begin, t_end,
+        detail::sparse_distance_table_writer< SparseTable >(table),
+        num_threads);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DISTANCE_TABLE_HPP
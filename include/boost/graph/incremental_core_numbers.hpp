@@ -0,0 +1,589 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
+#define BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/core_numbers.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace boost
+{
+
+/**
+ * Maintains the core numbers of an undirected graph without self-loops
+ * while edges are added to it and removed from it, by the order-based
+ * algorithm of Zhang, Yu, Zhang and Qin.
+ *
+ * The core numbers are computed by the bucket algorithm on construction.
+ * After add_edge(u, v, g), call edge_added(u, v), and after
+ * remove_edge(u, v, g), edge_removed(u, v); both return the number of
+ * vertices whose core number changed, by one.
+ *
+ * Besides the core numbers, the order in which the bucket algorithm could
+ * remove the vertices is kept, as one list per core number with labels
+ * for constant time comparisons, along with the remaining degree of every
+ * vertex, its number of neighbors that come after it in that order, which
+ * is at most its core number. An inserted edge only adds to the remaining
+ * degree of its earlier end, so most insertions change nothing else. When
+ * the remaining degree of that end exceeds its core number k, the
+ * vertices of core number k that come after it are scanned in order, but
+ * only those with neighbors among the candidates for the (k + 1)-core
+ * found so far. For removals, the number of neighbors of core number at
+ * least its own of every vertex is also kept, and only the vertices left
+ * with fewer than k such neighbors are visited, then moved to the end of
+ * the order of core number k - 1.
+ *
+ * Vertices may be added to the graph, with indices following those of
+ * the vertices already there, but not removed.
+ */
+template < typename Graph,
+    typename VertexIndexMap =
+        typename property_map< Graph, vertex_index_t >::const_type >
+class incremental_core_numbers
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    BOOST_STATIC_ASSERT((is_convertible<
+        typename graph_traits< Graph >::directed_category*,
+        undirected_tag* >::value));
+
+public:
+    typedef typename graph_traits< Graph >::vertex_descriptor vertex_type;
+
+    explicit incremental_core_numbers(const Graph& g)
+    : m_g(g), m_vertex_index(get(vertex_index, g)), m_update(0)
+    {
+        init();
+    }
+
+    incremental_core_numbers(const Graph& g, VertexIndexMap vertex_index)
+    : m_g(g), m_vertex_index(vertex_index), m_update(0)
+    {
+        init();
+    }
+
+    std::size_t core_number(vertex_type v) const
+    {
+        std::size_t i = get(m_vertex_index, v);
+        return i < m_core.size() ? m_core[i] : 0;
+    }
+
+    std::size_t edge_added(vertex_type u, vertex_type v)
+    {
+        std::size_t iu = index(u), iv = index(v);
+        if (m_core[iv] >= m_core[iu])
+            ++m_max_core_degree[iu];
+        if (m_core[iu] >= m_core[iv])
+            ++m_max_core_degree[iv];
+
+        std::size_t root = precedes(iu, iv) ? iu : iv;
+        const std::size_t k = m_core[root];
+        if (++m_remaining_degree[root] <= k)
+            return 0;
+
+        start_update();
+        m_candidates.clear();
+        m_examined.clear();
+        m_heap.clear();
+        std::size_t w = root;
+        touch(w);
+        for (;;)
+        {
+            m_flags[w] |= examined_flag;
+            if (m_remaining_degree[w] + m_candidate_degree[w] > k)
+                add_candidate(w, k);
+            else if (m_candidate_degree[w] > 0)
+                keep(w, k);
+            if (m_heap.empty())
+                break;
+            std::pop_heap(m_heap.begin(), m_heap.end(), later(m_label));
+            w = m_heap.back();
+            m_heap.pop_back();
+        }
+
+        // The candidates left go to the front of the (k + 1)-order
+        ensure_level(k + 1);
+        std::vector< std::size_t > promoted;
+        std::size_t last = npos;
+        for (std::size_t i = 0; i < m_candidates.size(); ++i)
+        {
+            std::size_t y = m_candidates[i];
+            if (!(m_flags[y] & candidate_flag))
+                continue;
+            m_core[y] = k + 1;
+            link_after(k + 1, last, y);
+            last = y;
+            promoted.push_back(y);
+        }
+
+        // The promoted vertices now count for their neighbors of core
+        // number k + 1
+        out_edge_iterator e, e_end;
+        for (std::size_t i = 0; i < promoted.size(); ++i)
+            for (boost::tie(e, e_end)
+                 = out_edges(m_vertex_of[promoted[i]], m_g);
+                 e != e_end; ++e)
+            {
+                std::size_t x = get(m_vertex_index, target(*e, m_g));
+                if (m_core[x] == k + 1 && !(flags(x) & candidate_flag))
+                    ++m_max_core_degree[x];
+            }
+        for (std::size_t i = 0; i < promoted.size(); ++i)
+        {
+            m_max_core_degree[promoted[i]]
+                = count_max_core_degree(promoted[i]);
+            m_remaining_degree[promoted[i]]
+                = count_remaining_degree(promoted[i]);
+        }
+        for (std::size_t i = 0; i < m_examined.size(); ++i)
+            m_remaining_degree[m_examined[i]]
+                = count_remaining_degree(m_examined[i]);
+        return promoted.size();
+    }
+
+    std::size_t edge_removed(vertex_type u, vertex_type v)
+    {
+        std::size_t iu = index(u), iv = index(v);
+        if (m_core[iv] >= m_core[iu])
+            --m_max_core_degree[iu];
+        if (m_core[iu] >= m_core[iv])
+            --m_max_core_degree[iv];
+        --m_remaining_degree[precedes(iu, iv) ? iu : iv];
+
+        const std::size_t k = (std::min)(m_core[iu], m_core[iv]);
+        if (k == 0)
+            return 0;
+        start_update();
+
+        // A vertex is demoted when it is taken from the stack, so that it
+        // counts for its neighbors until then
+        std::vector< std::size_t > stack, demoted;
+        std::size_t ends[2] = { iu, iv };
+        for (int i = 0; i < 2; ++i)
+        {
+            touch(ends[i]);
+            if (m_core[ends[i]] == k && m_max_core_degree[ends[i]] < k
+                && !(m_flags[ends[i]] & candidate_flag))
+            {
+                m_flags[ends[i]] |= candidate_flag;
+                stack.push_back(ends[i]);
+            }
+        }
+        out_edge_iterator e, e_end;
+        while (!stack.empty())
+        {
+            std::size_t w = stack.back();
+            stack.pop_back();
+            m_core[w] = k - 1;
+            demoted.push_back(w);
+            for (boost::tie(e, e_end) = out_edges(m_vertex_of[w], m_g);
+                 e != e_end; ++e)
+            {
+                std::size_t x = get(m_vertex_index, target(*e, m_g));
+                if (m_core[x] != k)
+                    continue;
+                touch(x);
+                if (--m_max_core_degree[x] < k
+                    && !(m_flags[x] & candidate_flag))
+                {
+                    m_flags[x] |= candidate_flag;
+                    stack.push_back(x);
+                }
+            }
+        }
+
+        // The vertices left in the k-order before a demoted vertex no
+        // longer have it after them, once it is at the end of the
+        // (k - 1)-order
+        for (std::size_t i = 0; i < demoted.size(); ++i)
+            for (boost::tie(e, e_end) = out_edges(m_vertex_of[demoted[i]], m_g);
+                 e != e_end; ++e)
+            {
+                std::size_t x = get(m_vertex_index, target(*e, m_g));
+                if (m_core[x] == k && m_label[x] < m_label[demoted[i]])
+                    --m_remaining_degree[x];
+            }
+        for (std::size_t i = 0; i < demoted.size(); ++i)
+        {
+            unlink(k, demoted[i]);
+            link_after(k - 1, m_tail[k - 1], demoted[i]);
+        }
+        for (std::size_t i = 0; i < demoted.size(); ++i)
+        {
+            m_max_core_degree[demoted[i]]
+                = count_max_core_degree(demoted[i]);
+            m_remaining_degree[demoted[i]]
+                = count_remaining_degree(demoted[i]);
+        }
+        return demoted.size();
+    }
+
+private:
+    typedef typename graph_traits< Graph >::out_edge_iterator
+        out_edge_iterator;
+    typedef boost::uint64_t label_type;
+
+    static const std::size_t npos = std::size_t(-1);
+
+    enum
+    {
+        examined_flag = 1,
+        candidate_flag = 2,
+        queued_flag = 4
+    };
+
+    struct later
+    {
+        explicit later(const std::vector< label_type >& label)
+        : label(&label)
+        {
+        }
+
+        bool operator()(std::size_t i, std::size_t j) const
+        {
+            return (*label)[i] > (*label)[j];
+        }
+
+        const std::vector< label_type >* label;
+    };
+
+    static label_type max_label() { return label_type(1) << 62; }
+
+    void init()
+    {
+        const std::size_t n = num_vertices(m_g);
+        m_vertex_of.resize(n);
+        typename graph_traits< Graph >::vertex_iterator v, v_end;
+        for (boost::tie(v, v_end) = vertices(m_g); v != v_end; ++v)
+            m_vertex_of[get(m_vertex_index, *v)] = *v;
+        std::vector< vertex_type > order;
+        std::size_t max_core = detail::bucket_core_order(
+            m_g, m_vertex_index, m_vertex_of, m_core, order);
+
+        // The order of removal, split by core number, with evenly spread
+        // labels
+        m_prev.assign(n, npos);
+        m_next.assign(n, npos);
+        m_label.resize(n);
+        ensure_level(max_core);
+        std::vector< std::size_t > size(max_core + 1, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            ++size[m_core[i]];
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            std::size_t i = get(m_vertex_index, order[p]);
+            std::size_t k = m_core[i];
+            std::size_t last = m_tail[k];
+            m_label[i] = (last == npos ? 0 : m_label[last])
+                + max_label() / (size[k] + 1);
+            m_prev[i] = last;
+            if (last == npos)
+                m_head[k] = i;
+            else
+                m_next[last] = i;
+            m_tail[k] = i;
+        }
+
+        m_max_core_degree.resize(n);
+        m_remaining_degree.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_max_core_degree[i] = count_max_core_degree(i);
+            m_remaining_degree[i] = count_remaining_degree(i);
+        }
+        m_stamp.assign(n, 0);
+        m_candidate_degree.resize(n);
+        m_sequence.resize(n);
+        m_flags.resize(n);
+    }
+
+    // The index of v, making room for it at the end of the 0-order if it
+    // was added since
+    std::size_t index(vertex_type v)
+    {
+        std::size_t i = get(m_vertex_index, v);
+        while (m_core.size() <= i)
+        {
+            std::size_t j = m_core.size();
+            m_core.push_back(0);
+            m_vertex_of.push_back(v);
+            m_max_core_degree.push_back(0);
+            m_remaining_degree.push_back(0);
+            m_prev.push_back(npos);
+            m_next.push_back(npos);
+            m_label.push_back(0);
+            m_stamp.push_back(0);
+            m_candidate_degree.push_back(0);
+            m_sequence.push_back(0);
+            m_flags.push_back(0);
+            ensure_level(0);
+            link_after(0, m_tail[0], j);
+        }
+        m_vertex_of[i] = v;
+        return i;
+    }
+
+    bool precedes(std::size_t i, std::size_t j) const
+    {
+        return m_core[i] < m_core[j]
+            || (m_core[i] == m_core[j] && m_label[i] < m_label[j]);
+    }
+
+    // Removes w, of core number k, from the k-order, and makes the
+    // neighbors after it, which now have it after them, wait to be
+    // scanned
+    void add_candidate(std::size_t w, std::size_t k)
+    {
+        m_flags[w] |= candidate_flag;
+        m_sequence[w] = m_candidates.size();
+        m_candidates.push_back(w);
+        out_edge_iterator e, e_end;
+        for (boost::tie(e, e_end) = out_edges(m_vertex_of[w], m_g);
+             e != e_end; ++e)
+        {
+            std::size_t x = get(m_vertex_index, target(*e, m_g));
+            if (m_core[x] != k)
+                continue;
+            touch(x);
+            if ((m_flags[x] & examined_flag) || m_label[x] < m_label[w])
+                continue;
+            ++m_candidate_degree[x];
+            if (!(m_flags[x] & queued_flag))
+            {
+                m_flags[x] |= queued_flag;
+                m_heap.push_back(x);
+                std::push_heap(m_heap.begin(), m_heap.end(), later(m_label));
+            }
+        }
+        unlink(k, w);
+    }
+
+    // Keeps w in the k-order, before the candidates, which its candidate
+    // neighbors can then no longer count; those left with too few
+    // neighbors after them go back into the k-order, right after w
+    void keep(std::size_t w, std::size_t k)
+    {
+        m_examined.push_back(w);
+        std::size_t cursor = w;
+        out_edge_iterator e, e_end;
+        for (boost::tie(e, e_end) = out_edges(m_vertex_of[w], m_g);
+             e != e_end; ++e)
+        {
+            std::size_t x = get(m_vertex_index, target(*e, m_g));
+            if (!(flags(x) & candidate_flag))
+                continue;
+            --m_remaining_degree[x];
+            if (m_remaining_degree[x] + m_candidate_degree[x] <= k)
+                cursor = put_back(x, k, cursor);
+        }
+
+        while (!m_put_back.empty())
+        {
+            std::size_t y = m_put_back.back();
+            m_put_back.pop_back();
+            for (boost::tie(e, e_end) = out_edges(m_vertex_of[y], m_g);
+                 e != e_end; ++e)
+            {
+                std::size_t x = get(m_vertex_index, target(*e, m_g));
+                if (m_core[x] != k)
+                    continue;
+                unsigned char f = flags(x);
+                if (f & candidate_flag)
+                {
+                    if (m_sequence[x] < m_sequence[y])
+                        --m_remaining_degree[x];
+                    else
+                        --m_candidate_degree[x];
+                    if (m_remaining_degree[x] + m_candidate_degree[x] <= k)
+                        cursor = put_back(x, k, cursor);
+                }
+                else if (!(f & examined_flag) && m_label[x] > m_label[y])
+                    --m_candidate_degree[x];
+            }
+        }
+    }
+
+    std::size_t put_back(std::size_t x, std::size_t k, std::size_t cursor)
+    {
+        m_flags[x] &= ~candidate_flag;
+        link_after(k, cursor, x);
+        m_examined.push_back(x);
+        m_put_back.push_back(x);
+        return x;
+    }
+
+    void ensure_level(std::size_t k)
+    {
+        if (m_head.size() <= k)
+        {
+            m_head.resize(k + 1, npos);
+            m_tail.resize(k + 1, npos);
+        }
+    }
+
+    void unlink(std::size_t k, std::size_t i)
+    {
+        if (m_prev[i] == npos)
+            m_head[k] = m_next[i];
+        else
+            m_next[m_prev[i]] = m_next[i];
+        if (m_next[i] == npos)
+            m_tail[k] = m_prev[i];
+        else
+            m_prev[m_next[i]] = m_prev[i];
+        m_prev[i] = m_next[i] = npos;
+    }
+
+    // Inserts i into the k-order after a, or first if a is npos, with a
+    // label between those of its neighbors, relabeling the smallest
+    // window around it whose labels are spread out enough if there is no
+    // room
+    void link_after(std::size_t k, std::size_t a, std::size_t i)
+    {
+        std::size_t b = a == npos ? m_head[k] : m_next[a];
+        m_prev[i] = a;
+        m_next[i] = b;
+        if (a == npos)
+            m_head[k] = i;
+        else
+            m_next[a] = i;
+        if (b == npos)
+            m_tail[k] = i;
+        else
+            m_prev[b] = i;
+
+        label_type low = a == npos ? 0 : m_label[a];
+        label_type high = b == npos ? max_label() : m_label[b];
+        if (high - low >= 2)
+        {
+            m_label[i] = low + (high - low) / 2;
+            return;
+        }
+
+        std::size_t first = i, last = i, count = 1, grow = 1;
+        for (;;)
+        {
+            low = m_prev[first] == npos ? 0 : m_label[m_prev[first]];
+            high = m_next[last] == npos ? max_label() : m_label[m_next[last]];
+            label_type gap = (high - low) / (count + 1);
+            if (gap >= count
+                || (m_prev[first] == npos && m_next[last] == npos))
+            {
+                for (std::size_t j = first, t = 1;; j = m_next[j], ++t)
+                {
+                    m_label[j] = low + gap * t;
+                    if (j == last)
+                        break;
+                }
+                return;
+            }
+            for (std::size_t t = 0; t < grow && m_prev[first] != npos; ++t)
+            {
+                first = m_prev[first];
+                ++count;
+            }
+            for (std::size_t t = 0; t < grow && m_next[last] != npos; ++t)
+            {
+                last = m_next[last];
+                ++count;
+            }
+            grow *= 2;
+        }
+    }
+
+    void start_update()
+    {
+        if (++m_update == 0)
+        {
+            std::fill(m_stamp.begin(), m_stamp.end(), 0);
+            m_update = 1;
+        }
+    }
+
+    // Resets the per-update state of i on its first use in an update
+    void touch(std::size_t i)
+    {
+        if (m_stamp[i] != m_update)
+        {
+            m_stamp[i] = m_update;
+            m_candidate_degree[i] = 0;
+            m_flags[i] = 0;
+        }
+    }
+
+    unsigned char flags(std::size_t i) const
+    {
+        return m_stamp[i] == m_update ? m_flags[i] : 0;
+    }
+
+    // The number of neighbors of i of core number at least its own
+    std::size_t count_max_core_degree(std::size_t i) const
+    {
+        std::size_t degree = 0;
+        out_edge_iterator e, e_end;
+        for (boost::tie(e, e_end) = out_edges(m_vertex_of[i], m_g); e != e_end;
+             ++e)
+            if (m_core[get(m_vertex_index, target(*e, m_g))] >= m_core[i])
+                ++degree;
+        return degree;
+    }
+
+    // The number of neighbors of i after it in the order
+    std::size_t count_remaining_degree(std::size_t i) const
+    {
+        std::size_t degree = 0;
+        out_edge_iterator e, e_end;
+        for (boost::tie(e, e_end) = out_edges(m_vertex_of[i], m_g); e != e_end;
+             ++e)
+            if (precedes(i, get(m_vertex_index, target(*e, m_g))))
+                ++degree;
+        return degree;
+    }
+
+    const Graph& m_g;
+    VertexIndexMap m_vertex_index;
+    std::vector< std::size_t > m_core;
+    std::vector< vertex_type > m_vertex_of;
+    std::vector< std::size_t > m_max_core_degree;
+    std::vector< std::size_t > m_remaining_degree;
+
+    // The order: a doubly linked list of vertex indices, with increasing
+    // labels, for each core number
+    std::vector< std::size_t > m_prev;
+    std::vector< std::size_t > m_next;
+    std::vector< label_type > m_label;
+    std::vector< std::size_t > m_head;
+    std::vector< std::size_t > m_tail;
+
+    // The state of the current update, valid for the vertices stamped
+    // with its number
+    std::vector< std::size_t > m_stamp;
+    std::vector< std::size_t > m_candidate_degree;
+    std::vector< std::size_t > m_sequence;
+    std::vector< unsigned char > m_flags;
+    std::size_t m_update;
+    std::vector< std::size_t > m_candidates;
+    std::vector< std::size_t > m_examined;
+    std::vector< std::size_t > m_heap;
+    std::vector< std::size_t > m_put_back;
+};
+
+template < typename Graph, typename VertexIndexMap >
+const std::size_t incremental_core_numbers< Graph, VertexIndexMap >::npos;
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_INCREMENTAL_CORE_NUMBERS_HPP
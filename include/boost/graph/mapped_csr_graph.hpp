@@ -0,0 +1,819 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Persistent on-disk layout for compressed sparse row graphs, and a read-only
+// graph type that works directly on a memory-mapped file in that layout.
+
+#ifndef BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
+#define BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+
+namespace boost
+{
+
+// Thrown when a CSR graph file cannot be written, or when a file does not
+// hold a graph in the expected layout (bad magic number, unsupported version,
+// different integer sizes or byte order, or truncated arrays).
+struct BOOST_SYMBOL_VISIBLE bad_csr_graph_file : public graph_exception
+{
+    std::string statement;
+    explicit bad_csr_graph_file(const std::string& what_arg)
+    : statement("CSR graph file: " + what_arg)
+    {
+    }
+    ~bad_csr_graph_file() throw() BOOST_OVERRIDE {}
+    const char* what() const throw() BOOST_OVERRIDE
+    {
+        return statement.c_str();
+    }
+};
+
+namespace detail
+{
+    /* Layout of a CSR graph file (version 1).
+     *
+     * The file starts with a csr_graph_file_header, followed by the arrays
+     * below, each of which starts at a multiple of csr_graph_file_alignment
+     * bytes from the beginning of the file.  All values are stored in the
+     * byte order of the machine that wrote the file; the byte_order field
+     * lets a reader on a machine of different byte order reject the file.
+     *
+     *   rowstart          EdgeIndex[num_vertices + 1]
+     *   column            Vertex[num_edges]
+     *   edge_property     EdgeProperty[num_edges]       (optional)
+     *   inverse_rowstart  EdgeIndex[num_vertices + 1]   (optional)
+     *   inverse_column    Vertex[num_edges]             (optional)
+     *   inverse_edge      EdgeIndex[num_edges]          (optional)
+     *
+     * The inverse arrays are the in-edges of a bidirectional graph: for each
+     * vertex, its in-edges' sources and the indices of those edges in the
+     * forward arrays.  An offset of zero marks an array as absent.
+     */
+    struct csr_graph_file_header
+    {
+        char magic[8];
+        boost::uint32_t version;
+        boost::uint32_t byte_order;
+        boost::uint32_t vertex_size;
+        boost::uint32_t edge_index_size;
+        boost::uint32_t edge_property_size;
+        boost::uint32_t flags;
+        boost::uint64_t num_vertices;
+        boost::uint64_t num_edges;
+        boost::uint64_t rowstart_offset;
+        boost::uint64_t column_offset;
+        boost::uint64_t edge_property_offset;
+        boost::uint64_t inverse_rowstart_offset;
+        boost::uint64_t inverse_column_offset;
+        boost::uint64_t inverse_edge_offset;
+    };
+
+    static const char csr_graph_file_magic[8]
+        = { 'B', 'G', 'L', 'C', 'S', 'R', '\0', '\0' };
+    static const boost::uint32_t csr_graph_file_version = 1;
+    static const boost::uint32_t csr_graph_file_byte_order = 0x01020304;
+    static const boost::uint64_t csr_graph_file_alignment = 64;
+
+    enum csr_graph_file_flags
+    {
+        csr_graph_file_has_edge_properties = 1,
+        csr_graph_file_has_inverse = 2
+    };
+
+    inline boost::uint64_t csr_graph_file_align(boost::uint64_t offset)
+    {
+        return (offset + csr_graph_file_alignment - 1)
+            / csr_graph_file_alignment * csr_graph_file_alignment;
+    }
+
+    // Writes the arrays of a CSR graph file, keeping track of the current
+    // offset so that each array can be padded to the required alignment.
+    class csr_graph_file_writer
+    {
+    public:
+        explicit csr_graph_file_writer(std::ostream& out)
+        : m_out(out), m_offset(0)
+        {
+        }
+
+        boost::uint64_t offset() const { return m_offset; }
+
+        void write_bytes(const void* data, std::size_t n)
+        {
+            m_out.write(static_cast< const char* >(data), n);
+            if (!m_out)
+                throw bad_csr_graph_file("error writing file");
+            m_offset += n;
+        }
+
+        void pad()
+        {
+            static const char zeros[csr_graph_file_alignment] = { 0 };
+            write_bytes(zeros, csr_graph_file_align(m_offset) - m_offset);
+        }
+
+        template < typename T >
+        boost::uint64_t write_array(const std::vector< T >& v)
+        {
+            pad();
+            boost::uint64_t start = m_offset;
+            if (!v.empty())
+                write_bytes(&v[0], v.size() * sizeof(T));
+            return start;
+        }
+
+    private:
+        std::ostream& m_out;
+        boost::uint64_t m_offset;
+    };
+
+    template < typename Graph, typename EdgePropertyMap >
+    boost::uint64_t write_csr_graph_file_edge_properties(
+        csr_graph_file_writer& writer, const Graph& g,
+        const EdgePropertyMap& edge_map)
+    {
+        typedef typename property_traits< EdgePropertyMap >::value_type
+            value_type;
+        BOOST_STATIC_ASSERT(std::is_trivially_copyable< value_type >::value);
+        const std::size_t chunk_size = 4096;
+        writer.pad();
+        boost::uint64_t start = writer.offset();
+        // Write in chunks to bound the temporary storage
+        std::vector< value_type > buffer;
+        buffer.reserve(chunk_size);
+        BGL_FORALL_EDGES_T(e, g, Graph)
+        {
+            buffer.push_back(get(edge_map, e));
+            if (buffer.size() == chunk_size)
+            {
+                writer.write_bytes(
+                    &buffer[0], buffer.size() * sizeof(value_type));
+                buffer.clear();
+            }
+        }
+        if (!buffer.empty())
+            writer.write_bytes(&buffer[0], buffer.size() * sizeof(value_type));
+        return start;
+    }
+
+    // Directed CSR graphs have no in-edge arrays to write
+    template < typename VertexProperty, typename EdgeProperty,
+        typename GraphProperty, typename Vertex, typename EdgeIndex >
+    void write_csr_graph_file_inverse(csr_graph_file_writer&,
+        csr_graph_file_header&,
+        const compressed_sparse_row_graph< directedS, VertexProperty,
+            EdgeProperty, GraphProperty, Vertex, EdgeIndex >&)
+    {
+    }
+
+    template < typename VertexProperty, typename EdgeProperty,
+        typename GraphProperty, typename Vertex, typename EdgeIndex >
+    void write_csr_graph_file_inverse(csr_graph_file_writer& writer,
+        csr_graph_file_header& header,
+        const compressed_sparse_row_graph< bidirectionalS, VertexProperty,
+            EdgeProperty, GraphProperty, Vertex, EdgeIndex >& g)
+    {
+        header.flags |= csr_graph_file_has_inverse;
+        header.inverse_rowstart_offset
+            = writer.write_array(g.m_backward.m_rowstart);
+        header.inverse_column_offset
+            = writer.write_array(g.m_backward.m_column);
+        header.inverse_edge_offset
+            = writer.write_array(g.m_backward.m_edge_properties);
+    }
+
+    template < typename Graph, typename EdgePropertyMap >
+    void write_csr_graph_file_impl(std::ostream& out, const Graph& g,
+        const EdgePropertyMap* edge_map, std::size_t edge_property_size)
+    {
+        typedef typename Graph::vertex_descriptor Vertex;
+        typedef typename Graph::edges_size_type EdgeIndex;
+
+        csr_graph_file_header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, csr_graph_file_magic, sizeof(header.magic));
+        header.version = csr_graph_file_version;
+        header.byte_order = csr_graph_file_byte_order;
+        header.vertex_size = sizeof(Vertex);
+        header.edge_index_size = sizeof(EdgeIndex);
+        header.edge_property_size = boost::uint32_t(edge_property_size);
+        header.num_vertices = num_vertices(g);
+        header.num_edges = num_edges(g);
+
+        // The header is written twice: once as a placeholder and once the
+        // offsets of the arrays are known.
+        std::ostream::pos_type start = out.tellp();
+        csr_graph_file_writer writer(out);
+        writer.write_bytes(&header, sizeof(header));
+        header.rowstart_offset = writer.write_array(g.m_forward.m_rowstart);
+        header.column_offset = writer.write_array(g.m_forward.m_column);
+        if (edge_map)
+        {
+            header.flags |= csr_graph_file_has_edge_properties;
+            header.edge_property_offset
+                = write_csr_graph_file_edge_properties(writer, g, *edge_map);
+        }
+        write_csr_graph_file_inverse(writer, header, g);
+        writer.pad();
+
+        out.seekp(start);
+        out.write(reinterpret_cast< const char* >(&header), sizeof(header));
+        out.seekp(start + std::streamoff(writer.offset()));
+        if (!out)
+            throw bad_csr_graph_file("error writing file");
+    }
+
+    // A read-only view of an array stored in a mapped CSR graph file, with
+    // enough of the interface of std::vector for the CSR iterators.
+    template < typename T > class csr_graph_file_array
+    {
+    public:
+        typedef T value_type;
+        typedef const T* const_iterator;
+        typedef const T* iterator;
+
+        csr_graph_file_array() : m_data(0), m_size(0) {}
+        csr_graph_file_array(const T* data, std::size_t size)
+        : m_data(data), m_size(size)
+        {
+        }
+
+        const T& operator[](std::size_t i) const
+        {
+            BOOST_ASSERT(i < m_size);
+            return m_data[i];
+        }
+        const T* begin() const { return m_data; }
+        const T* end() const { return m_data + m_size; }
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        const T& back() const { return (*this)[m_size - 1]; }
+
+    private:
+        const T* m_data;
+        std::size_t m_size;
+    };
+
+    template < typename Vertex, typename EdgeIndex >
+    struct csr_graph_file_structure
+    {
+        csr_graph_file_array< EdgeIndex > m_rowstart;
+        csr_graph_file_array< Vertex > m_column;
+        // Only used by the in-edge arrays: the index of each edge in the
+        // forward arrays
+        csr_graph_file_array< EdgeIndex > m_edge_properties;
+    };
+}
+
+// Write the CSR graph g to out (which must be opened in binary mode) in the
+// CSR graph file layout.  The in-edge arrays are written for bidirectional
+// graphs.
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex >
+void write_csr_graph_file(std::ostream& out,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex >& g)
+{
+    typedef compressed_sparse_row_graph< Directed, VertexProperty,
+        EdgeProperty, GraphProperty, Vertex, EdgeIndex >
+        Graph;
+    typedef typename property_map< Graph, edge_index_t >::const_type
+        EdgeIndexMap;
+    detail::write_csr_graph_file_impl(
+        out, g, static_cast< const EdgeIndexMap* >(0), 0);
+}
+
+// Same as above, but also store the value of edge_map for every edge.  The
+// value type of edge_map must be trivially copyable; it is stored as is.
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename EdgePropertyMap >
+void write_csr_graph_file(std::ostream& out,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex >& g,
+    const EdgePropertyMap& edge_map)
+{
+    detail::write_csr_graph_file_impl(out, g, &edge_map,
+        sizeof(typename property_traits< EdgePropertyMap >::value_type));
+}
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex >
+void write_csr_graph_file(const std::string& filename,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex >& g)
+{
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw bad_csr_graph_file("cannot open " + filename + " for writing");
+    write_csr_graph_file(out, g);
+}
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename EdgePropertyMap >
+void write_csr_graph_file(const std::string& filename,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex >& g,
+    const EdgePropertyMap& edge_map)
+{
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw bad_csr_graph_file("cannot open " + filename + " for writing");
+    write_csr_graph_file(out, g, edge_map);
+}
+
+/** Read-only compressed sparse row graph stored in a CSR graph file.
+ *
+ * The graph refers directly to the arrays of the file, which is mapped into
+ * memory rather than read, so opening a graph takes constant time and pages
+ * are only loaded as the graph is traversed.  Opening only checks the header
+ * and the bounds of the arrays; validate() checks every row start and column
+ * entry of a file that may be corrupt.  Directed must be directedS or
+ * bidirectionalS; the latter requires a file with in-edge arrays.
+ * EdgeProperty, if not no_property, is the type of the edge values stored in
+ * the file.  Vertex and EdgeIndex must match the types of the graph that was
+ * written.  Copies of a mapped_csr_graph share the same mapping.
+ */
+template < typename Directed = directedS, typename EdgeProperty = no_property,
+    typename Vertex = std::size_t, typename EdgeIndex = Vertex >
+class mapped_csr_graph
+{
+    BOOST_STATIC_ASSERT((is_same< Directed, directedS >::value
+        || is_same< Directed, bidirectionalS >::value));
+
+public:
+    // For Graph
+    typedef Vertex vertex_descriptor;
+    typedef detail::csr_edge_descriptor< Vertex, EdgeIndex > edge_descriptor;
+    typedef typename mpl::if_< is_same< Directed, bidirectionalS >,
+        bidirectional_tag, directed_tag >::type directed_category;
+    typedef allow_parallel_edge_tag edge_parallel_category;
+
+    struct directed_traversal_category : public incidence_graph_tag,
+                                         public adjacency_graph_tag,
+                                         public vertex_list_graph_tag,
+                                         public edge_list_graph_tag
+    {
+    };
+
+    struct bidirectional_traversal_category : public bidirectional_graph_tag,
+                                              public adjacency_graph_tag,
+                                              public vertex_list_graph_tag,
+                                              public edge_list_graph_tag
+    {
+    };
+
+    typedef typename mpl::if_< is_same< Directed, bidirectionalS >,
+        bidirectional_traversal_category, directed_traversal_category >::type
+        traversal_category;
+
+    static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+    // For VertexListGraph
+    typedef counting_iterator< Vertex > vertex_iterator;
+    typedef Vertex vertices_size_type;
+
+    // For EdgeListGraph
+    typedef EdgeIndex edges_size_type;
+    typedef detail::csr_edge_iterator< mapped_csr_graph > edge_iterator;
+
+    // For IncidenceGraph
+    typedef detail::csr_out_edge_iterator< mapped_csr_graph >
+        out_edge_iterator;
+    typedef EdgeIndex degree_size_type;
+
+    // For AdjacencyGraph
+    typedef const Vertex* adjacency_iterator;
+
+    // For BidirectionalGraph
+    typedef typename mpl::if_< is_same< Directed, bidirectionalS >,
+        detail::csr_in_edge_iterator< mapped_csr_graph >, void >::type
+        in_edge_iterator;
+
+    typedef EdgeProperty edge_bundled;
+
+    // Map the CSR graph file filename into memory
+    explicit mapped_csr_graph(const std::string& filename)
+    {
+        using namespace boost::interprocess;
+        try
+        {
+            file_mapping file(filename.c_str(), read_only);
+            m_region.reset(new mapped_region(file, read_only));
+        }
+        catch (const interprocess_exception& e)
+        {
+            throw bad_csr_graph_file(
+                "cannot map " + filename + ": " + e.what());
+        }
+        attach(m_region->get_address(), m_region->get_size());
+    }
+
+    // Use a CSR graph file that is already in memory.  The memory is not
+    // copied and must outlive the graph; data must be aligned to at least
+    // the alignment of Vertex, EdgeIndex and EdgeProperty.
+    mapped_csr_graph(const void* data, std::size_t size)
+    {
+        attach(data, size);
+    }
+
+    // Directly access an edge bundle
+    const EdgeProperty& operator[](const edge_descriptor& e) const
+    {
+        BOOST_ASSERT(m_edge_properties);
+        return m_edge_properties[e.idx];
+    }
+
+    // Whether the file stores edge values (see edge_bundle below)
+    bool has_edge_properties() const { return m_edge_properties != 0; }
+
+    // Check that the row starts do not decrease and that every column and
+    // in-edge entry is in range, so that traversals of a file that may be
+    // corrupt stay within the mapped arrays.  Reads the whole file; throws
+    // bad_csr_graph_file.
+    void validate() const
+    {
+        boost::uint64_t nv = m_forward.m_rowstart.size() - 1;
+        boost::uint64_t ne = m_forward.m_column.size();
+        validate_structure(m_forward, nv);
+        if (m_backward.m_rowstart.size() != 0)
+        {
+            validate_structure(m_backward, nv);
+            for (boost::uint64_t i = 0; i != ne; ++i)
+                if (boost::uint64_t(m_backward.m_edge_properties[i]) >= ne)
+                    throw bad_csr_graph_file("edge index out of range");
+        }
+    }
+
+    // private: used by the CSR iterators and the free functions below
+    detail::csr_graph_file_structure< Vertex, EdgeIndex > m_forward;
+    detail::csr_graph_file_structure< Vertex, EdgeIndex > m_backward;
+    const EdgeProperty* m_edge_properties;
+
+private:
+    template < typename T >
+    static const T* array_at(const char* base, std::size_t size,
+        boost::uint64_t offset, boost::uint64_t count)
+    {
+        if (offset == 0 || offset > size
+            || count > (size - offset) / sizeof(T))
+            throw bad_csr_graph_file("array out of bounds");
+        if (reinterpret_cast< std::size_t >(base + offset)
+                % std::alignment_of< T >::value
+            != 0)
+            throw bad_csr_graph_file("array is not aligned");
+        return reinterpret_cast< const T* >(base + offset);
+    }
+
+    // The first and last row starts, whose check takes constant time
+    static void check_row_start_bounds(
+        const detail::csr_graph_file_structure< Vertex, EdgeIndex >& s,
+        boost::uint64_t nv, boost::uint64_t ne)
+    {
+        if (s.m_rowstart[0] != 0 || s.m_rowstart[nv] != EdgeIndex(ne))
+            throw bad_csr_graph_file("inconsistent row starts");
+    }
+
+    static void validate_structure(
+        const detail::csr_graph_file_structure< Vertex, EdgeIndex >& s,
+        boost::uint64_t nv)
+    {
+        for (boost::uint64_t v = 0; v != nv; ++v)
+            if (s.m_rowstart[v + 1] < s.m_rowstart[v])
+                throw bad_csr_graph_file("inconsistent row starts");
+        for (boost::uint64_t i = 0; i != s.m_column.size(); ++i)
+            if (boost::uint64_t(s.m_column[i]) >= nv)
+                throw bad_csr_graph_file("vertex out of range");
+    }
+
+    void attach(const void* data, std::size_t size)
+    {
+        const char* base = static_cast< const char* >(data);
+        detail::csr_graph_file_header header;
+        if (size < sizeof(header))
+            throw bad_csr_graph_file("file too short");
+        std::memcpy(&header, base, sizeof(header));
+        if (std::memcmp(header.magic, detail::csr_graph_file_magic,
+                sizeof(header.magic))
+            != 0)
+            throw bad_csr_graph_file("not a CSR graph file");
+        if (header.version != detail::csr_graph_file_version)
+            throw bad_csr_graph_file("unsupported version");
+        if (header.byte_order != detail::csr_graph_file_byte_order)
+            throw bad_csr_graph_file("byte order mismatch");
+        if (header.vertex_size != sizeof(Vertex)
+            || header.edge_index_size != sizeof(EdgeIndex))
+            throw bad_csr_graph_file("vertex or edge index size mismatch");
+
+        boost::uint64_t nv = header.num_vertices;
+        boost::uint64_t ne = header.num_edges;
+        if (nv >= boost::uint64_t(null_vertex()) || nv + 1 == 0)
+            throw bad_csr_graph_file("too many vertices");
+        m_forward.m_rowstart = detail::csr_graph_file_array< EdgeIndex >(
+            array_at< EdgeIndex >(base, size, header.rowstart_offset, nv + 1),
+            nv + 1);
+        m_forward.m_column = detail::csr_graph_file_array< Vertex >(
+            array_at< Vertex >(base, size, header.column_offset, ne), ne);
+        check_row_start_bounds(m_forward, nv, ne);
+
+        m_edge_properties = 0;
+        if (header.flags & detail::csr_graph_file_has_edge_properties)
+        {
+            if (!is_same< EdgeProperty, no_property >::value)
+            {
+                if (header.edge_property_size != sizeof(EdgeProperty))
+                    throw bad_csr_graph_file("edge property size mismatch");
+                m_edge_properties = array_at< EdgeProperty >(
+                    base, size, header.edge_property_offset, ne);
+            }
+        }
+        else if (!is_same< EdgeProperty, no_property >::value)
+            throw bad_csr_graph_file("file has no edge properties");
+
+        if (header.flags & detail::csr_graph_file_has_inverse)
+        {
+            m_backward.m_rowstart = detail::csr_graph_file_array< EdgeIndex >(
+                array_at< EdgeIndex >(
+                    base, size, header.inverse_rowstart_offset, nv + 1),
+                nv + 1);
+            m_backward.m_column = detail::csr_graph_file_array< Vertex >(
+                array_at< Vertex >(
+                    base, size, header.inverse_column_offset, ne),
+                ne);
+            m_backward.m_edge_properties
+                = detail::csr_graph_file_array< EdgeIndex >(
+                    array_at< EdgeIndex >(
+                        base, size, header.inverse_edge_offset, ne),
+                    ne);
+            check_row_start_bounds(m_backward, nv, ne);
+        }
+        else if (is_same< Directed, bidirectionalS >::value)
+            throw bad_csr_graph_file("file has no in-edge arrays");
+    }
+
+    boost::shared_ptr< boost::interprocess::mapped_region > m_region;
+};
+
+#define BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS                         \
+    typename Directed, typename EdgeProperty, typename Vertex, \
+        typename EdgeIndex
+#define BOOST_MAPPED_CSR_GRAPH_TYPE \
+    mapped_csr_graph< Directed, EdgeProperty, Vertex, EdgeIndex >
+#define BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE \
+    mapped_csr_graph< bidirectionalS, EdgeProperty, Vertex, EdgeIndex >
+
+// From VertexListGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex num_vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_rowstart.size() - 1;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< counting_iterator< Vertex >, counting_iterator< Vertex > >
+vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(counting_iterator< Vertex >(0),
+        counting_iterator< Vertex >(num_vertices(g)));
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex vertex(Vertex i, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return i;
+}
+
+// From IncidenceGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex source(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return e.src;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex target(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_column[e.idx];
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator >
+out_edges(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor ed;
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator it;
+    EdgeIndex v_row_start = g.m_forward.m_rowstart[v];
+    EdgeIndex next_row_start = g.m_forward.m_rowstart[v + 1];
+    return std::make_pair(it(ed(v, v_row_start)), it(ed(v, next_row_start)));
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex out_degree(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_rowstart[v + 1] - g.m_forward.m_rowstart[v];
+}
+
+// From BidirectionalGraph
+template < typename EdgeProperty, typename Vertex, typename EdgeIndex >
+inline std::pair<
+    typename BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE::in_edge_iterator,
+    typename BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE::in_edge_iterator >
+in_edges(Vertex v, const BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE::in_edge_iterator it;
+    EdgeIndex v_row_start = g.m_backward.m_rowstart[v];
+    EdgeIndex next_row_start = g.m_backward.m_rowstart[v + 1];
+    return std::make_pair(it(g, v_row_start), it(g, next_row_start));
+}
+
+template < typename EdgeProperty, typename Vertex, typename EdgeIndex >
+inline EdgeIndex in_degree(Vertex v, const BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_backward.m_rowstart[v + 1] - g.m_backward.m_rowstart[v];
+}
+
+template < typename EdgeProperty, typename Vertex, typename EdgeIndex >
+inline EdgeIndex degree(Vertex v, const BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return in_degree(v, g) + out_degree(v, g);
+}
+
+// From AdjacencyGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< const Vertex*, const Vertex* > adjacent_vertices(
+    Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    const Vertex* column = g.m_forward.m_column.begin();
+    return std::make_pair(column + g.m_forward.m_rowstart[v],
+        column + g.m_forward.m_rowstart[v + 1]);
+}
+
+// From EdgeListGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex num_edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_column.size();
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+std::pair< typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator >
+edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator ei;
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor edgedesc;
+    if (g.m_forward.m_rowstart.size() == 1 || g.m_forward.m_column.empty())
+    {
+        return std::make_pair(ei(), ei());
+    }
+    else
+    {
+        // Find the first vertex that has outgoing edges
+        Vertex src = 0;
+        while (g.m_forward.m_rowstart[src + 1] == 0)
+            ++src;
+        return std::make_pair(
+            ei(g, edgedesc(src, 0), g.m_forward.m_rowstart[src + 1]),
+            ei(g, edgedesc(num_vertices(g), g.m_forward.m_column.size()), 0));
+    }
+}
+
+// edge() can be provided in linear time in the degree of i
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor, bool >
+edge(Vertex i, Vertex j, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor ed;
+    for (EdgeIndex k = g.m_forward.m_rowstart[i];
+         k != g.m_forward.m_rowstart[i + 1]; ++k)
+    {
+        if (g.m_forward.m_column[k] == j)
+            return std::make_pair(ed(i, k), true);
+    }
+    return std::make_pair(ed(), false);
+}
+
+// Find an edge given its index in the graph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor edge_from_index(
+    EdgeIndex idx, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    BOOST_ASSERT(idx < num_edges(g));
+    const EdgeIndex* src_plus_1 = std::upper_bound(
+        g.m_forward.m_rowstart.begin(), g.m_forward.m_rowstart.end(), idx);
+    // Get last source whose rowstart is at most idx
+    // upper_bound returns this position plus 1
+    Vertex src = (src_plus_1 - g.m_forward.m_rowstart.begin()) - 1;
+    return typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor(src, idx);
+}
+
+// Property maps: vertex and edge indices, and the edge values stored in the
+// file (edge_bundle)
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_index_t >
+{
+    typedef typed_identity_property_map< Vertex > type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, edge_index_t >
+{
+    typedef detail::csr_edge_index_map< Vertex, EdgeIndex > type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t >
+{
+    typedef iterator_property_map< const EdgeProperty*,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, EdgeProperty,
+        const EdgeProperty& >
+        type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typed_identity_property_map< Vertex > get(
+    vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return typed_identity_property_map< Vertex >();
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex get(vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&, Vertex v)
+{
+    return v;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline detail::csr_edge_index_map< Vertex, EdgeIndex > get(
+    edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return detail::csr_edge_index_map< Vertex, EdgeIndex >();
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex get(edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return e.idx;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t >::type
+get(edge_bundle_t, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+        edge_bundle_t >::type result_type;
+    BOOST_ASSERT(g.has_edge_properties());
+    return result_type(g.m_edge_properties,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >());
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline const EdgeProperty& get(edge_bundle_t,
+    const BOOST_MAPPED_CSR_GRAPH_TYPE& g,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return g[e];
+}
+
+#undef BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS
+#undef BOOST_MAPPED_CSR_GRAPH_TYPE
+#undef BOOST_BIDIR_MAPPED_CSR_GRAPH_TYPE
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_MAPPED_CSR_GRAPH_HPP
@@ -127,6 +127,15 @@ struct index_in_heap_map_t
 struct max_priority_queue_t
 {
 };
+struct bucket_width_t
+{
+};
+struct num_threads_t
+{
+};
+struct priority_queue_selector_t
+{
+};
 
 #define BOOST_BGL_DECLARE_NAMED_PARAMS                                         \
     BOOST_BGL_ONE_PARAM_CREF(weight_map, edge_weight)                          \
@@ -179,7 +188,10 @@ struct max_priority_queue_t
     BOOST_BGL_ONE_PARAM_CREF(vertices_equivalent, vertices_equivalent)         \
     BOOST_BGL_ONE_PARAM_CREF(edges_equivalent, edges_equivalent)               \
     BOOST_BGL_ONE_PARAM_CREF(index_in_heap_map, index_in_heap_map)             \
-    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue)
+    BOOST_BGL_ONE_PARAM_REF(max_priority_queue, max_priority_queue)            \
+    BOOST_BGL_ONE_PARAM_CREF(bucket_width, bucket_width)                       \
+    BOOST_BGL_ONE_PARAM_CREF(num_threads, num_threads)                         \
+    BOOST_BGL_ONE_PARAM_CREF(priority_queue_selector, priority_queue_selector)
 
 template < typename T, typename Tag, typename Base = no_property >
 struct bgl_named_params
@@ -0,0 +1,384 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BELLMAN_FORD_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_PARALLEL_BELLMAN_FORD_SHORTEST_PATHS_HPP
+
+/*
+  Multithreaded single-source shortest paths with negative weights.
+
+  The Bellman-Ford algorithm runs in rounds over the active vertices, those
+  whose distance decreased in the previous round, rather than over all the
+  edges.  As in delta_stepping_shortest_paths, each thread owns a
+  contiguous range of vertex indices (see detail/owner_requests.hpp), and
+  a round has two steps separated by a barrier: the threads scan the
+  out-edges of chunks of the active vertices and send the relaxations that
+  improve a distance to the owners of the targets, then every owner
+  applies the best ones for its vertices and makes them active.  The
+  distance and predecessor maps are thus only written by one thread at a
+  time for any vertex and need not be atomic.
+
+  Any cycle among the predecessors is a negative cycle (B. V. Cherkassky
+  and A. V. Goldberg, "Negative-cycle detection algorithms", Mathematical
+  Programming 85, 1999), and one appears once the distances around a
+  reachable negative cycle have decreased enough.  The predecessors are
+  searched for a cycle each time V more relaxations have been applied, in
+  time O(V), so a negative cycle is found long before V rounds while the
+  search only adds a constant factor to the work.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/relax.hpp>
+#include <boost/graph/queue_bellman_ford_shortest_paths.hpp>
+#include <boost/graph/detail/owner_requests.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    template < typename Graph, typename PredecessorMap, typename DistanceMap,
+        typename WeightMap, typename VertexIndexMap, typename Compare,
+        typename Combine >
+    class parallel_bellman_ford_impl
+    {
+        typedef graph_traits< Graph > Traits;
+        typedef typename Traits::vertex_descriptor Vertex;
+        typedef typename Traits::edge_descriptor Edge;
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+
+        struct request
+        {
+            std::size_t target;
+            Distance distance;
+            std::size_t source;
+            Edge edge;
+        };
+
+        // State of the vertices owned by one thread
+        struct owner_state
+        {
+            // Vertices made active in the current round
+            std::vector< std::size_t > active;
+            std::size_t num_relaxed;
+        };
+
+    public:
+        parallel_bellman_ford_impl(const Graph& g, PredecessorMap predecessor,
+            DistanceMap distance, WeightMap weight, VertexIndexMap index,
+            Compare compare, Combine combine, std::size_t num_threads)
+        : m_g(g)
+        , m_predecessor(predecessor)
+        , m_distance(distance)
+        , m_weight(weight)
+        , m_index(index)
+        , m_compare(compare)
+        , m_combine(combine)
+        , m_pool(num_threads)
+        , m_num_owners(m_pool.size())
+        , m_requests(num_vertices(g), m_num_owners)
+        , m_vertex_of(num_vertices(g))
+        , m_parent(num_vertices(g), npos())
+        , m_parent_edge(num_vertices(g))
+        , m_is_active(num_vertices(g), 0)
+        , m_owners(m_num_owners)
+        {
+        }
+
+        template < typename DistInf, typename OutputIterator >
+        bool run(DistInf inf, OutputIterator negative_cycle)
+        {
+            typename Traits::vertex_iterator vi, vi_end;
+            for (boost::tie(vi, vi_end) = vertices(m_g); vi != vi_end; ++vi)
+            {
+                std::size_t i = get(m_index, *vi);
+                m_vertex_of[i] = *vi;
+                if (m_compare(get(m_distance, *vi), Distance(inf)))
+                    m_active.push_back(i);
+            }
+
+            const std::size_t n = m_vertex_of.size();
+            std::size_t relaxed = 0;
+            while (!m_active.empty())
+            {
+                m_chunks.reset(m_active.size());
+                m_pool.run([&](std::size_t t) { relax_edges(t); });
+                m_pool.run([&](std::size_t t) { apply_requests(t); });
+                m_active.clear();
+                for (std::size_t t = 0; t < m_num_owners; ++t)
+                {
+                    owner_state& owner = m_owners[t];
+                    m_active.insert(m_active.end(), owner.active.begin(),
+                        owner.active.end());
+                    owner.active.clear();
+                    relaxed += owner.num_relaxed;
+                }
+                if (relaxed >= n && !m_active.empty())
+                {
+                    relaxed = 0;
+                    std::size_t c = find_cycle();
+                    if (c != npos())
+                    {
+                        output_cycle(c, negative_cycle);
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        static std::size_t npos() { return std::size_t(-1); }
+
+        // Scan the out-edges of the active vertices, taking chunks of them
+        // as they are needed, and send requests for the edges that improve
+        // a distance
+        void relax_edges(std::size_t t)
+        {
+            typename Traits::out_edge_iterator ei, ei_end;
+            std::size_t first, last;
+            while (m_chunks.next(first, last))
+            {
+                for (std::size_t k = first; k < last; ++k)
+                {
+                    std::size_t i = m_active[k];
+                    Vertex u = m_vertex_of[i];
+                    Distance d_u = get(m_distance, u);
+                    for (boost::tie(ei, ei_end) = out_edges(u, m_g);
+                         ei != ei_end; ++ei)
+                    {
+                        Vertex v = target(*ei, m_g);
+                        Distance d_v = m_combine(d_u, get(m_weight, *ei));
+                        if (m_compare(d_v, get(m_distance, v)))
+                        {
+                            std::size_t j = get(m_index, v);
+                            request r = { j, d_v, i, *ei };
+                            m_requests.send(t, j, r);
+                        }
+                    }
+                }
+            }
+        }
+
+        void apply_requests(std::size_t t)
+        {
+            owner_state& owner = m_owners[t];
+            owner.num_relaxed = 0;
+            m_requests.receive(t, [&](const request& r) {
+                Vertex v = m_vertex_of[r.target];
+                if (!m_compare(r.distance, get(m_distance, v)))
+                    return;
+                put(m_distance, v, r.distance);
+                put(m_predecessor, v, m_vertex_of[r.source]);
+                m_parent[r.target] = r.source;
+                m_parent_edge[r.target] = r.edge;
+                ++owner.num_relaxed;
+                if (!m_is_active[r.target])
+                {
+                    m_is_active[r.target] = 1;
+                    owner.active.push_back(r.target);
+                }
+            });
+            for (std::size_t k = 0; k < owner.active.size(); ++k)
+                m_is_active[owner.active[k]] = 0;
+        }
+
+        // A vertex on a cycle of the predecessors, or npos.  Each walk up
+        // the predecessors marks the vertices with its own number, and
+        // stops at a vertex without one or marked by an earlier walk.
+        std::size_t find_cycle()
+        {
+            const std::size_t n = m_vertex_of.size();
+            m_walk.assign(n, npos());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::size_t k = i;
+                while (k != npos() && m_walk[k] == npos())
+                {
+                    m_walk[k] = i;
+                    k = m_parent[k];
+                }
+                if (k != npos() && m_walk[k] == i)
+                    return k;
+            }
+            return npos();
+        }
+
+        template < typename OutputIterator >
+        void output_cycle(std::size_t c, OutputIterator negative_cycle) const
+        {
+            std::vector< Edge > cycle;
+            std::size_t k = c;
+            do
+            {
+                cycle.push_back(m_parent_edge[k]);
+                k = m_parent[k];
+            } while (k != c);
+            std::reverse(cycle.begin(), cycle.end());
+            std::copy(cycle.begin(), cycle.end(), negative_cycle);
+        }
+
+        const Graph& m_g;
+        PredecessorMap m_predecessor;
+        DistanceMap m_distance;
+        WeightMap m_weight;
+        VertexIndexMap m_index;
+        Compare m_compare;
+        Combine m_combine;
+        graph::detail::thread_pool m_pool;
+        const std::size_t m_num_owners;
+        graph::detail::owner_requests< request > m_requests;
+        std::vector< Vertex > m_vertex_of;
+        // The predecessor of each vertex and the edge from it, by index
+        std::vector< std::size_t > m_parent;
+        std::vector< Edge > m_parent_edge;
+        // Whether a vertex was made active in the current round; only
+        // accessed by its owner
+        std::vector< char > m_is_active;
+        std::vector< owner_state > m_owners;
+        std::vector< std::size_t > m_active;
+        graph::detail::chunk_dispenser m_chunks;
+        std::vector< std::size_t > m_walk;
+    };
+} // namespace detail
+
+/* Shortest paths from the vertices whose distance is not inf, as
+   queue_bellman_ford_shortest_paths_no_init computes them, using
+   num_threads threads (0 means one per hardware thread).  Returns false if
+   a negative cycle is reachable from those vertices, after writing its
+   edges to negative_cycle in order along the cycle.  Different vertices'
+   entries in distance and predecessor are written concurrently.
+*/
+template < typename Graph, typename PredecessorMap, typename DistanceMap,
+    typename WeightMap, typename VertexIndexMap, typename Compare,
+    typename Combine, typename DistInf, typename OutputIterator >
+bool parallel_bellman_ford_shortest_paths_no_init(const Graph& g,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    VertexIndexMap index, Compare compare, Combine combine, DistInf inf,
+    OutputIterator negative_cycle, std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename graph_traits< Graph >::edge_descriptor Edge;
+    BOOST_CONCEPT_ASSERT((ReadWritePropertyMapConcept< DistanceMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (WritablePropertyMapConcept< PredecessorMap, Vertex >));
+    BOOST_CONCEPT_ASSERT((ReadablePropertyMapConcept< WeightMap, Edge >));
+    BOOST_CONCEPT_ASSERT(
+        (ReadablePropertyMapConcept< VertexIndexMap, Vertex >));
+
+    detail::parallel_bellman_ford_impl< Graph, PredecessorMap, DistanceMap,
+        WeightMap, VertexIndexMap, Compare, Combine >
+        impl(g, predecessor, distance, weight, index, compare, combine,
+            num_threads);
+    return impl.run(inf, negative_cycle);
+}
+
+/* Shortest paths from s, which may go through negative edges, using
+   num_threads threads.  Returns false if a negative cycle is reachable
+   from s, after writing its edges to negative_cycle.
+*/
+template < typename Graph, typename PredecessorMap, typename DistanceMap,
+    typename WeightMap, typename VertexIndexMap, typename Compare,
+    typename Combine, typename DistInf, typename DistZero,
+    typename OutputIterator >
+bool parallel_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    VertexIndexMap index, Compare compare, Combine combine, DistInf inf,
+    DistZero zero, OutputIterator negative_cycle, std::size_t num_threads = 0)
+{
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    {
+        put(distance, *vi, inf);
+        put(predecessor, *vi, *vi);
+    }
+    put(distance, s, zero);
+    return parallel_bellman_ford_shortest_paths_no_init(g, predecessor,
+        distance, weight, index, compare, combine, inf, negative_cycle,
+        num_threads);
+}
+
+namespace detail
+{
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline bool parallel_bellman_ford_dispatch2(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for predecessor map
+        dummy_property_map p_map;
+
+        typedef typename property_traits< DistanceMap >::value_type D;
+        D inf = choose_param(get_param(params, distance_inf_t()),
+            (std::numeric_limits< D >::max)());
+
+        return parallel_bellman_ford_shortest_paths(g, s,
+            choose_param(get_param(params, vertex_predecessor), p_map),
+            distance, weight, index_map,
+            choose_param(
+                get_param(params, distance_compare_t()), std::less< D >()),
+            choose_param(
+                get_param(params, distance_combine_t()), closed_plus< D >(inf)),
+            inf, choose_param(get_param(params, distance_zero_t()), D()),
+            null_edge_output(),
+            std::size_t(
+                choose_param(get_param(params, num_threads_t()), 0)));
+    }
+
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline bool parallel_bellman_ford_dispatch1(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for distance map
+        typedef typename property_traits< WeightMap >::value_type D;
+        typename std::vector< D >::size_type n
+            = is_default_param(distance) ? num_vertices(g) : 1;
+        std::vector< D > distance_map(n);
+
+        return detail::parallel_bellman_ford_dispatch2(g, s,
+            choose_param(distance,
+                make_iterator_property_map(
+                    distance_map.begin(), index_map, distance_map[0])),
+            weight, index_map, params);
+    }
+} // namespace detail
+
+// Named Parameter Variant.  Accepts the parameters of the named parameter
+// variant of queue_bellman_ford_shortest_paths, and num_threads.
+template < class Graph, class Param, class Tag, class Rest >
+inline bool parallel_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    return detail::parallel_bellman_ford_dispatch1(g, s,
+        get_param(params, vertex_distance),
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BELLMAN_FORD_SHORTEST_PATHS_HPP
@@ -0,0 +1,431 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
+#define BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
+
+/*
+  Multithreaded Brandes betweenness centrality.  The sources are handed to a
+  thread pool; the out-edges and weights are copied once into a compressed
+  sparse row layout shared by all threads, and each thread keeps its own
+  labels and centrality buffers, which are summed at the end.
+
+  Requires C++11 threads and lambdas.
+*/
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/graph/property_maps/constant_property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    namespace graph
+    {
+        /**
+         * Out-edges of a graph in a compressed sparse row layout indexed by
+         * vertex index, shared by the threads of the parallel Brandes
+         * algorithm.  Out-edge k of vertex i is stored at position
+         * row_start[i] + k, which also indexes the per-thread edge
+         * centrality buffers; the edge descriptors are only kept when edge
+         * centralities are computed.
+         */
+        template < typename Graph, typename Distance > struct brandes_layout
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef
+                typename graph_traits< Graph >::edge_descriptor edge_descriptor;
+            typedef Distance distance_type;
+
+            template < typename VertexIndexMap, typename WeightMap >
+            brandes_layout(const Graph& g, VertexIndexMap vertex_index,
+                WeightMap weight_map, bool keep_edges)
+            {
+                typedef typename graph_traits< Graph >::vertex_iterator
+                    vertex_iterator;
+                typedef typename graph_traits< Graph >::out_edge_iterator
+                    out_edge_iterator;
+
+                std::size_t n = num_vertices(g);
+                vertex_of.resize(n);
+                row_start.assign(n + 1, 0);
+                vertex_iterator v, v_end;
+                for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+                {
+                    std::size_t i = get(vertex_index, *v);
+                    vertex_of[i] = *v;
+                    row_start[i + 1] = out_degree(*v, g);
+                }
+                for (std::size_t i = 0; i < n; ++i)
+                    row_start[i + 1] += row_start[i];
+
+                targets.resize(row_start[n]);
+                weights.resize(row_start[n]);
+                if (keep_edges)
+                    edge_of.resize(row_start[n]);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    std::size_t k = row_start[i];
+                    out_edge_iterator e, e_end;
+                    for (boost::tie(e, e_end) = out_edges(vertex_of[i], g);
+                         e != e_end; ++e, ++k)
+                    {
+                        targets[k] = get(vertex_index, target(*e, g));
+                        weights[k] = get(weight_map, *e);
+                        if (keep_edges)
+                            edge_of[k] = *e;
+                    }
+                }
+            }
+
+            std::vector< vertex_descriptor > vertex_of;
+            std::vector< std::size_t > row_start;
+            std::vector< std::size_t > targets;
+            std::vector< Distance > weights;
+            std::vector< edge_descriptor > edge_of;
+        };
+
+        /**
+         * Per-thread workspace of the parallel Brandes algorithm: the
+         * distance, path count and dependency of each vertex for the
+         * current source, the vertices in the order they were settled, and
+         * the private centrality buffers summed over the sources handled
+         * by the thread.  Only the labels of the vertices reached from a
+         * source are reset before the next one.
+         */
+        template < typename Distance, typename PathCount,
+            typename Centrality >
+        struct brandes_workspace
+        {
+            typedef iterator_property_map< Distance*, identity_property_map >
+                distance_map;
+            typedef iterator_property_map< std::size_t*,
+                identity_property_map >
+                index_in_heap_map;
+            typedef d_ary_heap_indirect< std::size_t, 4, index_in_heap_map,
+                distance_map, std::less< Distance > >
+                queue_type;
+
+            brandes_workspace(std::size_t n, std::size_t m)
+            : distance((std::max)(n, std::size_t(1)),
+                (std::numeric_limits< Distance >::max)())
+            , path_count(n, 0)
+            , dependency(n, 0)
+            , index_in_heap(distance.size(), std::size_t(-1))
+            , centrality(n, 0)
+            , edge_centrality(m, 0)
+            , queue(distance_map(&distance[0]),
+                  index_in_heap_map(&index_in_heap[0]))
+            {
+            }
+
+            void reset()
+            {
+                for (std::size_t k = 0; k < order.size(); ++k)
+                {
+                    std::size_t w = order[k];
+                    distance[w] = (std::numeric_limits< Distance >::max)();
+                    path_count[w] = 0;
+                    dependency[w] = 0;
+                }
+                order.clear();
+            }
+
+            std::vector< Distance > distance;
+            std::vector< PathCount > path_count;
+            std::vector< Centrality > dependency;
+            std::vector< std::size_t > index_in_heap;
+            std::vector< std::size_t > order;
+            std::vector< Centrality > centrality;
+            std::vector< Centrality > edge_centrality;
+            queue_type queue;
+        };
+
+        // Breadth-first search from s, counting the shortest paths
+        struct brandes_parallel_unweighted_shortest_paths
+        {
+            template < typename Layout, typename Workspace >
+            void operator()(
+                const Layout& layout, std::size_t s, Workspace& ws) const
+            {
+                ws.distance[s] = 0;
+                ws.path_count[s] = 1;
+                ws.order.push_back(s);
+                for (std::size_t head = 0; head < ws.order.size(); ++head)
+                {
+                    std::size_t v = ws.order[head];
+                    for (std::size_t k = layout.row_start[v];
+                         k < layout.row_start[v + 1]; ++k)
+                    {
+                        std::size_t w = layout.targets[k];
+                        if (ws.path_count[w] == 0)
+                        {
+                            ws.distance[w] = ws.distance[v] + 1;
+                            ws.path_count[w] = ws.path_count[v];
+                            ws.order.push_back(w);
+                        }
+                        else if (ws.distance[w] == ws.distance[v] + 1)
+                            ws.path_count[w] += ws.path_count[v];
+                    }
+                }
+            }
+        };
+
+        // Dijkstra's algorithm from s, counting the shortest paths
+        struct brandes_parallel_dijkstra_shortest_paths
+        {
+            template < typename Layout, typename Workspace >
+            void operator()(
+                const Layout& layout, std::size_t s, Workspace& ws) const
+            {
+                typedef typename Layout::distance_type Distance;
+                closed_plus< Distance > combine;
+                ws.distance[s] = Distance(0);
+                ws.path_count[s] = 1;
+                ws.queue.push(s);
+                while (!ws.queue.empty())
+                {
+                    std::size_t v = ws.queue.top();
+                    ws.queue.pop();
+                    ws.order.push_back(v);
+                    for (std::size_t k = layout.row_start[v];
+                         k < layout.row_start[v + 1]; ++k)
+                    {
+                        std::size_t w = layout.targets[k];
+                        Distance d = combine(ws.distance[v], layout.weights[k]);
+                        if (d < ws.distance[w])
+                        {
+                            ws.distance[w] = d;
+                            ws.path_count[w] = ws.path_count[v];
+                            ws.queue.push_or_update(w);
+                        }
+                        else if (d == ws.distance[w] && w != s)
+                            ws.path_count[w] += ws.path_count[v];
+                    }
+                }
+            }
+        };
+
+        /**
+         * Parallel form of brandes_betweenness_centrality_impl.  The
+         * sources are handed to the threads through an atomic counter.
+         * After the search from a source, the dependencies are accumulated
+         * in reverse order of distance over the out-edges (v, w) that lie
+         * on a shortest path, recognized by d(w) = d(v) + w(v, w), so that
+         * no incoming edge lists have to be built.  The private centrality
+         * buffers of the threads are summed at the end.
+         */
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename VertexIndexMap,
+            typename WeightMap, typename ShortestPaths >
+        void parallel_brandes_betweenness_centrality_impl(const Graph& g,
+            CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+            VertexIndexMap vertex_index, WeightMap weight_map,
+            ShortestPaths shortest_paths, std::size_t num_threads)
+        {
+            typedef typename property_traits< WeightMap >::value_type
+                distance_type;
+            typedef typename graph_traits< Graph >::degree_size_type
+                degree_size_type;
+            typedef typename mpl::if_c<
+                (is_same< CentralityMap, dummy_property_map >::value),
+                EdgeCentralityMap, CentralityMap >::type a_centrality_map;
+            typedef typename property_traits< a_centrality_map >::value_type
+                centrality_type;
+            typedef brandes_layout< Graph, distance_type > layout_type;
+            typedef brandes_workspace< distance_type, degree_size_type,
+                centrality_type >
+                workspace_type;
+
+            const bool has_edge_centrality
+                = !is_same< EdgeCentralityMap, dummy_property_map >::value;
+            const layout_type layout(
+                g, vertex_index, weight_map, has_edge_centrality);
+            const std::size_t n = layout.vertex_of.size();
+            const std::size_t m
+                = has_edge_centrality ? layout.targets.size() : 0;
+
+            boost::graph::detail::thread_pool pool(
+                (std::min)(boost::graph::detail::resolve_num_threads(
+                               num_threads),
+                    (std::max)(n, std::size_t(1))));
+            closed_plus< distance_type > combine;
+            std::vector< std::unique_ptr< workspace_type > > workspaces(
+                pool.size());
+            std::atomic< std::size_t > next_source(0);
+            pool.run([&](std::size_t t) {
+                workspaces[t].reset(new workspace_type(n, m));
+                workspace_type& ws = *workspaces[t];
+                for (;;)
+                {
+                    std::size_t s = next_source++;
+                    if (s >= n)
+                        break;
+                    shortest_paths(layout, s, ws);
+                    for (std::size_t k = ws.order.size(); k-- > 0;)
+                    {
+                        std::size_t v = ws.order[k];
+                        for (std::size_t e = layout.row_start[v];
+                             e < layout.row_start[v + 1]; ++e)
+                        {
+                            std::size_t w = layout.targets[e];
+                            if (ws.path_count[w] == 0 || w == s)
+                                continue;
+                            if (ws.distance[w]
+                                != combine(ws.distance[v], layout.weights[e]))
+                                continue;
+                            centrality_type factor
+                                = centrality_type(ws.path_count[v])
+                                / centrality_type(ws.path_count[w]);
+                            factor *= centrality_type(1) + ws.dependency[w];
+                            ws.dependency[v] += factor;
+                            if (has_edge_centrality)
+                                ws.edge_centrality[e] += factor;
+                        }
+                        if (v != s)
+                            ws.centrality[v] += ws.dependency[v];
+                    }
+                    ws.reset();
+                }
+            });
+
+            // Sum the buffers of all threads into the first one
+            std::vector< centrality_type >& total = workspaces[0]->centrality;
+            std::vector< centrality_type >& edge_total
+                = workspaces[0]->edge_centrality;
+            pool.for_each_block(n + m,
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        for (std::size_t t = 1; t < workspaces.size(); ++t)
+                        {
+                            if (i < n)
+                                total[i] += workspaces[t]->centrality[i];
+                            else
+                                edge_total[i - n]
+                                    += workspaces[t]->edge_centrality[i - n];
+                        }
+                    }
+                });
+
+            init_centrality_map(vertices(g), centrality);
+            init_centrality_map(edges(g), edge_centrality_map);
+            for (std::size_t i = 0; i < n; ++i)
+                update_centrality(centrality, layout.vertex_of[i], total[i]);
+            for (std::size_t e = 0; e < m; ++e)
+                update_centrality(
+                    edge_centrality_map, layout.edge_of[e], edge_total[e]);
+
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            const bool is_undirected
+                = is_convertible< directed_category*, undirected_tag* >::value;
+            if (is_undirected)
+            {
+                divide_centrality_by_two(vertices(g), centrality);
+                divide_centrality_by_two(edges(g), edge_centrality_map);
+            }
+        }
+
+        template < typename WeightMap >
+        struct parallel_brandes_betweenness_centrality_dispatch
+        {
+            template < typename Graph, typename CentralityMap,
+                typename EdgeCentralityMap, typename VertexIndexMap >
+            static void run(const Graph& g, CentralityMap centrality,
+                EdgeCentralityMap edge_centrality_map,
+                VertexIndexMap vertex_index, WeightMap weight_map,
+                std::size_t num_threads)
+            {
+                parallel_brandes_betweenness_centrality_impl(g, centrality,
+                    edge_centrality_map, vertex_index, weight_map,
+                    brandes_parallel_dijkstra_shortest_paths(), num_threads);
+            }
+        };
+
+        template <>
+        struct parallel_brandes_betweenness_centrality_dispatch<
+            param_not_found >
+        {
+            template < typename Graph, typename CentralityMap,
+                typename EdgeCentralityMap, typename VertexIndexMap >
+            static void run(const Graph& g, CentralityMap centrality,
+                EdgeCentralityMap edge_centrality_map,
+                VertexIndexMap vertex_index, param_not_found,
+                std::size_t num_threads)
+            {
+                parallel_brandes_betweenness_centrality_impl(g, centrality,
+                    edge_centrality_map, vertex_index,
+                    make_constant_property< typename graph_traits<
+                        Graph >::edge_descriptor >(std::size_t(1)),
+                    brandes_parallel_unweighted_shortest_paths(),
+                    num_threads);
+            }
+        };
+    }
+} // end namespace detail::graph
+
+/**
+ * Multithreaded brandes_betweenness_centrality on an unweighted graph.
+ * The sources are split over num_threads threads (0 for one per hardware
+ * thread), each with its own labels and centrality buffers, which are
+ * summed at the end.  Either centrality map may be a dummy_property_map.
+ */
+template < typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+    typename VertexIndexMap >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+    VertexIndexMap vertex_index, std::size_t num_threads)
+{
+    detail::graph::parallel_brandes_betweenness_centrality_dispatch<
+        param_not_found >::run(g, centrality, edge_centrality_map,
+        vertex_index, param_not_found(), num_threads);
+}
+
+// Multithreaded brandes_betweenness_centrality on a weighted graph
+template < typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+    typename VertexIndexMap, typename WeightMap >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+    VertexIndexMap vertex_index, WeightMap weight_map,
+    std::size_t num_threads)
+{
+    detail::graph::parallel_brandes_betweenness_centrality_dispatch<
+        WeightMap >::run(g, centrality, edge_centrality_map, vertex_index,
+        weight_map, num_threads);
+}
+
+// Named parameters: centrality_map, edge_centrality_map, vertex_index_map,
+// weight_map and num_threads
+template < typename Graph, typename Param, typename Tag, typename Rest >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    typedef bgl_named_params< Param, Tag, Rest > named_params;
+
+    typedef typename get_param_type< edge_weight_t, named_params >::type ew;
+    detail::graph::parallel_brandes_betweenness_centrality_dispatch< ew >::run(
+        g,
+        choose_param(
+            get_param(params, vertex_centrality), dummy_property_map()),
+        choose_param(get_param(params, edge_centrality), dummy_property_map()),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        get_param(params, edge_weight),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BETWEENNESS_CENTRALITY_HPP
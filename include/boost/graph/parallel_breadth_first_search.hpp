@@ -0,0 +1,251 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+#define BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+
+/*
+  Multithreaded level-synchronous breadth-first search.
+
+  The vertices of each level are divided dynamically among the threads in
+  small chunks.  A thread claims an undiscovered target by atomically setting
+  its bit in a shared visited bitmap, and appends the vertices it claims to
+  its own buffer; the buffers are concatenated into the next frontier once
+  all threads have finished the level.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/visitors.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/owner_requests.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+template < class Visitor, class Graph > struct ParallelBFSVisitorConcept
+{
+    void constraints()
+    {
+        BOOST_CONCEPT_ASSERT((CopyConstructibleConcept< Visitor >));
+        vis.discover_vertex(u, g);
+        vis.examine_vertex(u, g);
+        vis.tree_edge(e, g);
+    }
+    Visitor vis;
+    Graph g;
+    typename graph_traits< Graph >::vertex_descriptor u;
+    typename graph_traits< Graph >::edge_descriptor e;
+};
+
+struct parallel_bfs_visitor_base
+{
+};
+
+/* Visitor for parallel_breadth_first_search.  Only the events that the
+   parallel search can report consistently are supported: tree_edge(e) and
+   then discover_vertex(v) when v is discovered, and examine_vertex(u) when
+   u is taken from the frontier.  Each thread calls its own copy of the
+   visitor, and the events of one level are called concurrently from all
+   threads, so the event visitors must be safe to call concurrently for
+   different vertices (record_distances and record_predecessors on a
+   vector-based property map are).  User-defined visitors must derive from
+   parallel_bfs_visitor<> to state that they are thread-safe; other
+   visitors, including bfs_visitor<>, are rejected at compile time.
+*/
+template < class Visitors = null_visitor >
+class parallel_bfs_visitor : public parallel_bfs_visitor_base
+{
+public:
+    parallel_bfs_visitor() {}
+    parallel_bfs_visitor(Visitors vis) : m_vis(vis) {}
+
+    template < class Vertex, class Graph >
+    void discover_vertex(Vertex u, const Graph& g)
+    {
+        invoke_visitors(m_vis, u, g, ::boost::on_discover_vertex());
+    }
+
+    template < class Vertex, class Graph >
+    void examine_vertex(Vertex u, const Graph& g)
+    {
+        invoke_visitors(m_vis, u, g, ::boost::on_examine_vertex());
+    }
+
+    template < class Edge, class Graph >
+    void tree_edge(Edge e, const Graph& g)
+    {
+        invoke_visitors(m_vis, e, g, ::boost::on_tree_edge());
+    }
+
+protected:
+    Visitors m_vis;
+};
+
+template < class Visitors >
+parallel_bfs_visitor< Visitors > make_parallel_bfs_visitor(Visitors vis)
+{
+    return parallel_bfs_visitor< Visitors >(vis);
+}
+
+namespace detail
+{
+    // Bitmap whose bits can be claimed concurrently by several threads
+    class atomic_vertex_bitmap
+    {
+    public:
+        explicit atomic_vertex_bitmap(std::size_t n)
+        : m_size((n + 63) / 64)
+        , m_words(new std::atomic< boost::uint64_t >[m_size])
+        {
+            for (std::size_t i = 0; i < m_size; ++i)
+                m_words[i].store(0, std::memory_order_relaxed);
+        }
+
+        bool test(std::size_t i) const
+        {
+            return (m_words[i / 64].load(std::memory_order_relaxed)
+                       >> (i % 64))
+                & 1;
+        }
+
+        // Set bit i and return true if it was not already set
+        bool claim(std::size_t i)
+        {
+            boost::uint64_t mask = boost::uint64_t(1) << (i % 64);
+            return !(m_words[i / 64].fetch_or(mask, std::memory_order_relaxed)
+                & mask);
+        }
+
+    private:
+        std::size_t m_size;
+        std::unique_ptr< std::atomic< boost::uint64_t >[] > m_words;
+    };
+} // namespace detail
+
+/* Breadth-first search from s using num_threads threads (0 means one per
+   hardware thread).  For every vertex reachable from s, distance receives
+   its distance in edges from s and predecessor its parent in a
+   breadth-first tree; the predecessor of s is s, and vertices that are not
+   reachable are not written.  The distances are the same as those of
+   breadth_first_search, but the tree may differ from run to run.
+
+   distance and predecessor are written concurrently for different
+   vertices, so they must not share storage between keys in a way that
+   makes this a data race (for example, a std::vector<bool>).
+*/
+template < typename Graph, typename DistanceMap, typename PredecessorMap,
+    typename VertexIndexMap, typename ParallelBFSVisitor >
+void parallel_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, DistanceMap distance,
+    PredecessorMap predecessor, VertexIndexMap index, ParallelBFSVisitor vis,
+    std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((ParallelBFSVisitorConcept< ParallelBFSVisitor,
+        Graph >));
+    BOOST_STATIC_ASSERT_MSG(
+        (is_base_of< parallel_bfs_visitor_base, ParallelBFSVisitor >::value),
+        "The visitor of parallel_breadth_first_search must derive from "
+        "parallel_bfs_visitor to show that its events are thread-safe");
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename property_traits< DistanceMap >::value_type Distance;
+    BOOST_CONCEPT_ASSERT((WritablePropertyMapConcept< DistanceMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (WritablePropertyMapConcept< PredecessorMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (ReadablePropertyMapConcept< VertexIndexMap, Vertex >));
+
+    graph::detail::thread_pool pool(num_threads);
+    const std::size_t num_workers = pool.size();
+    detail::atomic_vertex_bitmap visited(num_vertices(g));
+    std::vector< std::vector< Vertex > > local_next(num_workers);
+    std::vector< ParallelBFSVisitor > local_vis(num_workers, vis);
+    std::vector< std::size_t > offsets(num_workers + 1);
+    std::vector< Vertex > frontier, next;
+    // Chunks of the frontier taken by the threads
+    graph::detail::chunk_dispenser chunks;
+
+    Distance level = Distance();
+    visited.claim(get(index, s));
+    put(distance, s, level);
+    put(predecessor, s, s);
+    vis.discover_vertex(s, g);
+    frontier.push_back(s);
+
+    while (!frontier.empty())
+    {
+        ++level;
+        chunks.reset(frontier.size());
+        pool.run([&](std::size_t t) {
+            std::vector< Vertex >& out = local_next[t];
+            ParallelBFSVisitor& thread_vis = local_vis[t];
+            out.clear();
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            std::size_t first, last;
+            while (chunks.next(first, last))
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    Vertex u = frontier[i];
+                    thread_vis.examine_vertex(u, g);
+                    for (boost::tie(ei, ei_end) = out_edges(u, g);
+                         ei != ei_end; ++ei)
+                    {
+                        Vertex v = target(*ei, g);
+                        std::size_t v_index = get(index, v);
+                        // Test before claiming to avoid the atomic write
+                        // for vertices that are already visited
+                        if (!visited.test(v_index) && visited.claim(v_index))
+                        {
+                            put(distance, v, level);
+                            put(predecessor, v, u);
+                            thread_vis.tree_edge(*ei, g);
+                            thread_vis.discover_vertex(v, g);
+                            out.push_back(v);
+                        }
+                    }
+                }
+            }
+        });
+
+        for (std::size_t t = 0; t < num_workers; ++t)
+            offsets[t + 1] = offsets[t] + local_next[t].size();
+        next.resize(offsets[num_workers]);
+        pool.run([&](std::size_t t) {
+            std::copy(local_next[t].begin(), local_next[t].end(),
+                next.begin() + offsets[t]);
+        });
+        frontier.swap(next);
+    }
+}
+
+template < typename Graph, typename DistanceMap, typename PredecessorMap >
+void parallel_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, DistanceMap distance,
+    PredecessorMap predecessor, std::size_t num_threads = 0)
+{
+    parallel_breadth_first_search(g, s, distance, predecessor,
+        get(vertex_index, g), parallel_bfs_visitor<>(), num_threads);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
@@ -0,0 +1,188 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
+#define BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
+
+/*
+  Multithreaded core numbers by parallel peeling.  Requires C++11 threads,
+  atomics and lambdas.
+*/
+
+#include <boost/graph/core_numbers.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // The number of edges into the vertices in [first, last) of
+    // vertex_of, stored by vertex index, for undirected and bidirectional
+    // graphs, and for directed ones the edges out of them counted into
+    // their targets, so that the degrees are complete once all the
+    // vertices are done
+    template < typename Graph, typename VertexIndexMap >
+    void count_in_degrees(const Graph& g, VertexIndexMap vertex_index,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        std::size_t first, std::size_t last,
+        std::atomic< std::size_t >* degree, undirected_tag)
+    {
+        for (std::size_t i = first; i < last; ++i)
+            degree[get(vertex_index, vertex_of[i])].store(
+                out_degree(vertex_of[i], g), std::memory_order_relaxed);
+    }
+
+    template < typename Graph, typename VertexIndexMap >
+    void count_in_degrees(const Graph& g, VertexIndexMap vertex_index,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        std::size_t first, std::size_t last,
+        std::atomic< std::size_t >* degree, bidirectional_tag)
+    {
+        for (std::size_t i = first; i < last; ++i)
+            degree[get(vertex_index, vertex_of[i])].store(
+                in_degree(vertex_of[i], g), std::memory_order_relaxed);
+    }
+
+    template < typename Graph, typename VertexIndexMap >
+    void count_in_degrees(const Graph& g, VertexIndexMap vertex_index,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        std::size_t first, std::size_t last,
+        std::atomic< std::size_t >* degree, directed_tag)
+    {
+        typename graph_traits< Graph >::out_edge_iterator e, e_end;
+        for (std::size_t i = first; i < last; ++i)
+            for (boost::tie(e, e_end) = out_edges(vertex_of[i], g); e != e_end;
+                 ++e)
+                degree[get(vertex_index, target(*e, g))].fetch_add(
+                    1, std::memory_order_relaxed);
+    }
+} // namespace detail
+
+/**
+ * The core numbers of the unweighted case by parallel peeling (the PKC
+ * algorithm of Kabir and Madduri), with num_threads threads. Each round
+ * finds the smallest degree k left, and the threads remove the vertices
+ * of degree k from their blocks, decrementing the degrees of the
+ * neighbors atomically and removing those that fall to k in turn. Gives
+ * the same core numbers as core_numbers(g, c). Returns the largest core
+ * number.
+ */
+template < typename Graph, typename CoreMap, typename VertexIndexMap >
+typename property_traits< CoreMap >::value_type parallel_core_numbers(
+    const Graph& g, CoreMap c, VertexIndexMap vertex_index,
+    std::size_t num_threads)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+    typedef typename property_traits< CoreMap >::value_type core_type;
+
+    const std::size_t n = num_vertices(g);
+    std::vector< vertex > vertex_of(n);
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        vertex_of[get(vertex_index, *vi)] = *vi;
+
+    graph::detail::thread_pool pool(num_threads);
+    std::unique_ptr< std::atomic< std::size_t >[] > degree(
+        new std::atomic< std::size_t >[n]);
+    std::unique_ptr< std::atomic< bool >[] > removed(
+        new std::atomic< bool >[n]);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        degree[i].store(0, std::memory_order_relaxed);
+        removed[i].store(false, std::memory_order_relaxed);
+    }
+    pool.for_each_block(
+        n, [&](std::size_t, std::size_t first, std::size_t last) {
+            detail::count_in_degrees(g, vertex_index, vertex_of, first,
+                last, degree.get(),
+                typename graph_traits< Graph >::directed_category());
+        });
+
+    // The vertices left in the block of each thread, and the smallest
+    // degree among them
+    std::vector< std::vector< std::size_t > > remaining(pool.size());
+    std::vector< std::size_t > smallest(pool.size());
+    pool.for_each_block(
+        n, [&](std::size_t t, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+                remaining[t].push_back(i);
+        });
+
+    std::size_t level = 0;
+    for (;;)
+    {
+        pool.run([&](std::size_t t) {
+            std::vector< std::size_t >& left = remaining[t];
+            std::size_t kept = 0;
+            smallest[t] = (std::numeric_limits< std::size_t >::max)();
+            for (std::size_t k = 0; k < left.size(); ++k)
+                if (!removed[left[k]].load(std::memory_order_relaxed))
+                {
+                    left[kept++] = left[k];
+                    smallest[t] = (std::min)(smallest[t],
+                        degree[left[k]].load(std::memory_order_relaxed));
+                }
+            left.resize(kept);
+        });
+        level = *std::min_element(smallest.begin(), smallest.end());
+        if (level == (std::numeric_limits< std::size_t >::max)())
+            break;
+
+        pool.run([&](std::size_t t) {
+            std::vector< std::size_t > peel;
+            const std::vector< std::size_t >& left = remaining[t];
+            for (std::size_t k = 0; k < left.size(); ++k)
+                if (degree[left[k]].load(std::memory_order_relaxed) == level
+                    && !removed[left[k]].exchange(true))
+                    peel.push_back(left[k]);
+
+            typename graph_traits< Graph >::out_edge_iterator e, e_end;
+            for (std::size_t k = 0; k < peel.size(); ++k)
+                for (boost::tie(e, e_end) = out_edges(vertex_of[peel[k]], g);
+                     e != e_end; ++e)
+                {
+                    std::size_t j = get(vertex_index, target(*e, g));
+                    if (degree[j].load(std::memory_order_relaxed) <= level)
+                        continue;
+                    std::size_t old = degree[j].fetch_sub(1);
+                    if (old <= level)
+                        degree[j].fetch_add(1);
+                    else if (old == level + 1 && !removed[j].exchange(true))
+                        peel.push_back(j);
+                }
+        });
+    }
+
+    std::size_t max_core = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        max_core = (std::max)(max_core, degree[i].load());
+        put(c, vertex_of[i], core_type(degree[i].load()));
+    }
+    return core_type(max_core);
+}
+
+template < typename Graph, typename CoreMap >
+typename property_traits< CoreMap >::value_type parallel_core_numbers(
+    const Graph& g, CoreMap c, std::size_t num_threads = 0)
+{
+    return parallel_core_numbers(g, c, get(vertex_index, g), num_threads);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_CORE_NUMBERS_HPP
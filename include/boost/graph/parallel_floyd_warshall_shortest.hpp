@@ -0,0 +1,316 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_FLOYD_WARSHALL_SHORTEST_HPP
+#define BOOST_GRAPH_PARALLEL_FLOYD_WARSHALL_SHORTEST_HPP
+
+/*
+  Blocked, multithreaded Floyd-Warshall on a row_major_distance_matrix.
+  Requires C++11 threads and lambdas.
+*/
+
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/assert.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace boost
+{
+
+/*
+  A distance matrix stored row by row in n * n contiguous elements, where
+  the distance from u to v is at d[get(vertex_index, g, u)]
+  [get(vertex_index, g, v)].  The overloads of
+  floyd_warshall_initialized_all_pairs_shortest_paths and
+  floyd_warshall_all_pairs_shortest_paths for this matrix, also called by
+  the versions with named parameters of floyd_warshall_shortest.hpp, use
+  the blocked algorithm below.
+*/
+template < typename T > class row_major_distance_matrix
+{
+public:
+    typedef T value_type;
+
+    row_major_distance_matrix(T* data, std::size_t n) : m_data(data), m_n(n)
+    {
+    }
+
+    // Uses the n * n elements of v, which must have that many
+    row_major_distance_matrix(std::vector< T >& v, std::size_t n)
+    : m_data(v.data()), m_n(n)
+    {
+    }
+
+    T* operator[](std::size_t i) const { return m_data + i * m_n; }
+
+    T* data() const { return m_data; }
+
+    std::size_t size() const { return m_n; }
+
+private:
+    T* m_data;
+    std::size_t m_n;
+};
+
+namespace detail
+{
+    /*
+      Blocked Floyd-Warshall (G. Venkataraman, S. Sahni and S. Mukhopadhyaya,
+      "A Blocked All-Pairs Shortest-Paths Algorithm", 2003).  The matrix is
+      cut into square tiles that fit in the L1 cache.  Round kb first runs
+      the plain algorithm on the diagonal tile (kb, kb), then on the other
+      tiles of row and column kb through the diagonal tile, then on all the
+      remaining tiles (ib, jb) through the tiles (ib, kb) and (kb, jb),
+      which no longer change during the round.  The tiles of each of the
+      last two phases are independent and are split among the threads.
+    */
+    template < typename T > struct floyd_warshall_tiles
+    {
+        // 32 KB tiles of doubles
+        static const std::size_t size = 64;
+
+        floyd_warshall_tiles(const row_major_distance_matrix< T >& d)
+        : d(d.data()), n(d.size()), count((n + size - 1) / size)
+        {
+        }
+
+        T* row(std::size_t i) const { return d + i * n; }
+
+        std::size_t first(std::size_t tile) const { return tile * size; }
+
+        std::size_t last(std::size_t tile) const
+        {
+            return (std::min)(n, (tile + 1) * size);
+        }
+
+        T* d;
+        std::size_t n;
+        std::size_t count;
+    };
+
+    // Relaxes di[j] through dik + dk[j] for j in [first, last)
+    template < typename T, typename BinaryPredicate, typename BinaryFunction >
+    inline void floyd_warshall_relax_row(T* di, T dik, const T* dk,
+        std::size_t first, std::size_t last, const BinaryPredicate& compare,
+        const BinaryFunction& combine, const T& inf)
+    {
+        for (std::size_t j = first; j < last; ++j)
+            if (dk[j] != inf)
+                di[j] = min_with_compare(di[j], combine(dik, dk[j]), compare);
+    }
+
+    // The same for the usual operators, without branches in the loops so
+    // that they vectorize.  A sum that would exceed inf is inf, as it
+    // cannot be a shortest distance.
+    template < typename T >
+    inline void floyd_warshall_relax_row(T* BOOST_RESTRICT di, T dik,
+        const T* BOOST_RESTRICT dk, std::size_t first, std::size_t last,
+        const std::less< T >& compare, const closed_plus< T >& combine,
+        const T& inf)
+    {
+        if (combine.inf != inf)
+        {
+            for (std::size_t j = first; j < last; ++j)
+                if (dk[j] != inf)
+                    di[j] = min_with_compare(
+                        di[j], combine(dik, dk[j]), compare);
+        }
+        else if (is_floating_point< T >::value
+            && std::numeric_limits< T >::has_infinity
+            && inf == std::numeric_limits< T >::infinity())
+        {
+            // A sum with an infinite inf is inf, so needs no guard
+            for (std::size_t j = first; j < last; ++j)
+            {
+                T c = dik + dk[j];
+                di[j] = c < di[j] ? c : di[j];
+            }
+        }
+        else if (is_floating_point< T >::value || compare(dik, T()))
+        {
+            // A finite inf plus a negative dik would be a finite distance,
+            // and floating-point sums cannot overflow
+            for (std::size_t j = first; j < last; ++j)
+            {
+                T c = dk[j] != inf ? T(dik + dk[j]) : inf;
+                di[j] = c < di[j] ? c : di[j];
+            }
+        }
+        else
+        {
+            const T limit = T(inf - dik);
+            for (std::size_t j = first; j < last; ++j)
+            {
+                T c = dk[j] <= limit ? T(dik + dk[j]) : inf;
+                di[j] = c < di[j] ? c : di[j];
+            }
+        }
+    }
+
+    // Relaxes d[i][j] for i in tile rows and j in tile columns through
+    // d[i][k] + d[k][j], for each k of tile middles in turn, as the tiles
+    // of rows or columns may be middles.  Row k cannot get shorter through
+    // itself unless there is a negative cycle, which the result tells
+    // anyway, so rows are never relaxed through themselves and the rows
+    // passed to floyd_warshall_relax_row never overlap.
+    template < typename T, typename BinaryPredicate, typename BinaryFunction >
+    void floyd_warshall_tile(const floyd_warshall_tiles< T >& tiles,
+        std::size_t rows, std::size_t columns, std::size_t middles,
+        const BinaryPredicate& compare, const BinaryFunction& combine,
+        const T& inf)
+    {
+        for (std::size_t k = tiles.first(middles); k < tiles.last(middles);
+             ++k)
+            for (std::size_t i = tiles.first(rows); i < tiles.last(rows); ++i)
+            {
+                T* di = tiles.row(i);
+                if (i != k && di[k] != inf)
+                    floyd_warshall_relax_row(di, di[k], tiles.row(k),
+                        tiles.first(columns), tiles.last(columns), compare,
+                        combine, inf);
+            }
+    }
+
+    // The same when the tiles of rows and columns are not middles, row by
+    // row, so that each row of the tile stays in the cache
+    template < typename T, typename BinaryPredicate, typename BinaryFunction >
+    void floyd_warshall_independent_tile(
+        const floyd_warshall_tiles< T >& tiles, std::size_t rows,
+        std::size_t columns, std::size_t middles,
+        const BinaryPredicate& compare, const BinaryFunction& combine,
+        const T& inf)
+    {
+        for (std::size_t i = tiles.first(rows); i < tiles.last(rows); ++i)
+        {
+            T* di = tiles.row(i);
+            for (std::size_t k = tiles.first(middles);
+                 k < tiles.last(middles); ++k)
+                if (di[k] != inf)
+                    floyd_warshall_relax_row(di, di[k], tiles.row(k),
+                        tiles.first(columns), tiles.last(columns), compare,
+                        combine, inf);
+        }
+    }
+
+    template < typename T, typename BinaryPredicate, typename BinaryFunction >
+    void floyd_warshall_blocked(const row_major_distance_matrix< T >& d,
+        const BinaryPredicate& compare, const BinaryFunction& combine,
+        const T& inf, std::size_t num_threads)
+    {
+        const floyd_warshall_tiles< T > tiles(d);
+        const std::size_t count = tiles.count;
+        if (count == 0)
+            return;
+        graph::detail::thread_pool pool(
+            (std::min)(graph::detail::resolve_num_threads(num_threads),
+                (count - 1) * (count - 1) + 1));
+        for (std::size_t kb = 0; kb < count; ++kb)
+        {
+            floyd_warshall_tile(tiles, kb, kb, kb, compare, combine, inf);
+            if (count == 1)
+                break;
+
+            // Tile t of row kb for t < count - 1, of column kb after
+            pool.for_each_block(2 * (count - 1),
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t t = first; t < last; ++t)
+                    {
+                        std::size_t other = t % (count - 1);
+                        other += other >= kb;
+                        if (t < count - 1)
+                            floyd_warshall_tile(
+                                tiles, kb, other, kb, compare, combine, inf);
+                        else
+                            floyd_warshall_tile(
+                                tiles, other, kb, kb, compare, combine, inf);
+                    }
+                });
+
+            pool.for_each_block((count - 1) * (count - 1),
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t t = first; t < last; ++t)
+                    {
+                        std::size_t ib = t / (count - 1),
+                                    jb = t % (count - 1);
+                        ib += ib >= kb;
+                        jb += jb >= kb;
+                        floyd_warshall_independent_tile(
+                            tiles, ib, jb, kb, compare, combine, inf);
+                    }
+                });
+        }
+    }
+} // namespace detail
+
+template < typename VertexListGraph, typename T, typename BinaryPredicate,
+    typename BinaryFunction, typename Infinity, typename Zero >
+bool floyd_warshall_initialized_all_pairs_shortest_paths(
+    const VertexListGraph& g, row_major_distance_matrix< T >& d,
+    const BinaryPredicate& compare, const BinaryFunction& combine,
+    const Infinity& inf, const Zero& zero, std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< VertexListGraph >));
+    BOOST_ASSERT(d.size() == num_vertices(g));
+
+    detail::floyd_warshall_blocked(d, compare, combine, T(inf), num_threads);
+    for (std::size_t i = 0; i < d.size(); ++i)
+        if (compare(d[i][i], zero))
+            return false;
+    return true;
+}
+
+template < typename VertexAndEdgeListGraph, typename T, typename WeightMap,
+    typename BinaryPredicate, typename BinaryFunction, typename Infinity,
+    typename Zero >
+bool floyd_warshall_all_pairs_shortest_paths(const VertexAndEdgeListGraph& g,
+    row_major_distance_matrix< T >& d, const WeightMap& w,
+    const BinaryPredicate& compare, const BinaryFunction& combine,
+    const Infinity& inf, const Zero& zero, std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< VertexAndEdgeListGraph >));
+    BOOST_CONCEPT_ASSERT((EdgeListGraphConcept< VertexAndEdgeListGraph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< VertexAndEdgeListGraph >));
+    BOOST_ASSERT(d.size() == num_vertices(g));
+
+    const std::size_t n = d.size();
+    std::fill(d.data(), d.data() + n * n, T(inf));
+    for (std::size_t i = 0; i < n; ++i)
+        d[i][i] = zero;
+
+    bool is_undirected = is_same<
+        typename graph_traits< VertexAndEdgeListGraph >::directed_category,
+        undirected_tag >::value;
+    typename property_map< VertexAndEdgeListGraph,
+        vertex_index_t >::const_type index
+        = get(vertex_index, g);
+    typename graph_traits< VertexAndEdgeListGraph >::edge_iterator first, last;
+    for (boost::tie(first, last) = edges(g); first != last; first++)
+    {
+        std::size_t u = get(index, source(*first, g));
+        std::size_t v = get(index, target(*first, g));
+        for (int side = 0; side < (is_undirected ? 2 : 1); ++side)
+        {
+            T& duv = side == 0 ? d[u][v] : d[v][u];
+            if (duv != inf)
+                duv = detail::min_with_compare(
+                    T(get(w, *first)), duv, compare);
+            else
+                duv = get(w, *first);
+        }
+    }
+
+    return floyd_warshall_initialized_all_pairs_shortest_paths(
+        g, d, compare, combine, inf, zero, num_threads);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_FLOYD_WARSHALL_SHORTEST_HPP
@@ -0,0 +1,230 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_JOHNSON_ALL_PAIRS_SHORTEST_HPP
+#define BOOST_GRAPH_PARALLEL_JOHNSON_ALL_PAIRS_SHORTEST_HPP
+
+/*
+  parallel_johnson_all_pairs_shortest_paths, which runs the searches of
+  Johnson's algorithm from the sources on several threads and passes each
+  row of distances to a function as soon as it is computed instead of
+  filling a matrix.  Requires C++11 threads, atomics and lambdas.
+*/
+
+#include <boost/graph/johnson_all_pairs_shortest.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Dijkstra's algorithm from s on a graph whose edge bundles are the
+    // weights, leaving the distance of each vertex in row.  Every vertex
+    // leaves the heap, so index_in_heap is back to all -1 afterwards.
+    template < typename Graph, typename DT, typename BinaryPredicate,
+        typename BinaryFunction >
+    class johnson_row_search
+    {
+    public:
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+
+        johnson_row_search(std::size_t n, const BinaryPredicate& compare,
+            const BinaryFunction& combine)
+        : m_row((std::max)(n, std::size_t(1)))
+        , m_index_in_heap(m_row.size(), std::size_t(-1))
+        , m_queue(DistanceMap(m_row.data()),
+              IndexInHeapMap(m_index_in_heap.data()), compare)
+        , m_compare(compare)
+        , m_combine(combine)
+        {
+            m_row.resize(n);
+        }
+
+        void run(const Graph& g, Vertex s, const DT& inf, const DT& zero)
+        {
+            std::fill(m_row.begin(), m_row.end(), inf);
+            m_row[s] = zero;
+            m_queue.push(s);
+            while (!m_queue.empty())
+            {
+                Vertex u = m_queue.top();
+                m_queue.pop();
+                DT du = m_row[u];
+                typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end;
+                     ++ei)
+                {
+                    Vertex v = target(*ei, g);
+                    DT d = m_combine(du, g[*ei]);
+                    if (m_compare(d, m_row[v]))
+                    {
+                        m_row[v] = d;
+                        m_queue.push_or_update(v);
+                    }
+                }
+            }
+        }
+
+        std::vector< DT >& row() { return m_row; }
+
+    private:
+        typedef iterator_property_map< DT*, identity_property_map >
+            DistanceMap;
+        typedef iterator_property_map< std::size_t*, identity_property_map >
+            IndexInHeapMap;
+        typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
+            BinaryPredicate >
+            Queue;
+
+        std::vector< DT > m_row;
+        std::vector< std::size_t > m_index_in_heap;
+        Queue m_queue;
+        BinaryPredicate m_compare;
+        BinaryFunction m_combine;
+    };
+} // namespace detail
+
+/** Johnson's algorithm with the searches from the sources run by
+ * num_threads threads (0 for one per hardware thread), each row streamed
+ * to a function instead of stored in a matrix.
+ *
+ * For each vertex u, row_function(u, row) is called once, with row a
+ * const std::vector<DT>& such that row[get(id1, v)] is the distance from u
+ * to v.  The calls come from several threads at once, for different
+ * sources and in no particular order, and row is only valid during the
+ * call.  Only one row per thread is kept, so the memory used is
+ * O(V * num_threads + E) instead of O(V^2).  No row is passed if there is
+ * a negative cycle, in which case the function returns false.  If
+ * row_function throws, no more rows are started and the exception is
+ * rethrown once the threads are done.
+ */
+template < class VertexAndEdgeListGraph, class RowFunction, class VertexID,
+    class Weight, typename BinaryPredicate, typename BinaryFunction,
+    typename Infinity, class DistanceZero >
+bool parallel_johnson_all_pairs_shortest_paths(
+    const VertexAndEdgeListGraph& g1, RowFunction row_function, VertexID id1,
+    Weight w1, const BinaryPredicate& compare, const BinaryFunction& combine,
+    const Infinity& inf, DistanceZero zero, std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< VertexAndEdgeListGraph >));
+    BOOST_CONCEPT_ASSERT((EdgeListGraphConcept< VertexAndEdgeListGraph >));
+    typedef graph_traits< VertexAndEdgeListGraph > Traits1;
+    typedef typename property_traits< Weight >::value_type DT;
+    typedef compressed_sparse_row_graph< directedS, no_property, DT > Graph2;
+    typedef typename graph_traits< Graph2 >::vertex_descriptor Vertex2;
+
+    typedef typename Traits1::directed_category DirCat;
+    bool is_undirected = is_same< DirCat, undirected_tag >::value;
+
+    // The edges of g1 by vertex index, in both directions if g1 is
+    // undirected, in a layout shared by all threads
+    const std::size_t n = num_vertices(g1);
+    std::vector< typename Traits1::vertex_descriptor > verts1(n);
+    typename Traits1::vertex_iterator v, v_end;
+    for (boost::tie(v, v_end) = vertices(g1); v != v_end; ++v)
+        verts1[get(id1, *v)] = *v;
+    std::vector< std::pair< Vertex2, Vertex2 > > edge_list;
+    std::vector< DT > weights;
+    bool has_negative = false;
+    typename Traits1::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g1); e != e_end; ++e)
+    {
+        Vertex2 a = get(id1, source(*e, g1)), b = get(id1, target(*e, g1));
+        DT w = get(w1, *e);
+        has_negative = has_negative || compare(w, DT(zero));
+        edge_list.push_back(std::make_pair(a, b));
+        weights.push_back(w);
+        if (is_undirected)
+        {
+            edge_list.push_back(std::make_pair(b, a));
+            weights.push_back(w);
+        }
+    }
+    Graph2 g2(edges_are_unsorted_multi_pass_parallel, edge_list.begin(),
+        edge_list.end(), weights.begin(), n, num_threads);
+    std::vector< std::pair< Vertex2, Vertex2 > >().swap(edge_list);
+    std::vector< DT >().swap(weights);
+
+    // Starting from h = 0 everywhere is the same as the first round of
+    // Bellman-Ford from an extra vertex with an edge of weight zero to
+    // every vertex.  Without negative weights, h stays 0 and the weights
+    // are left as they are.
+    std::vector< DT > h(n, DT(zero));
+    if (has_negative)
+    {
+        dummy_property_map pred;
+        bellman_visitor<> bvis;
+        if (!bellman_ford_shortest_paths(g2, n + 1, get(edge_bundle, g2), pred,
+                make_iterator_property_map(h.begin(), get(vertex_index, g2)),
+                combine, compare, bvis))
+            return false;
+        // Reweight the edges to remove negatives
+        typename graph_traits< Graph2 >::edge_iterator e2, e2_end;
+        for (boost::tie(e2, e2_end) = edges(g2); e2 != e2_end; ++e2)
+            g2[*e2] = combine(
+                h[source(*e2, g2)] - h[target(*e2, g2)], g2[*e2]);
+    }
+
+    typedef detail::johnson_row_search< Graph2, DT, BinaryPredicate,
+        BinaryFunction >
+        Search;
+    std::atomic< std::size_t > next_source(0);
+    graph::detail::thread_pool pool(
+        (std::min)(graph::detail::resolve_num_threads(num_threads),
+            (std::max)(n, std::size_t(1))));
+    pool.run([&](std::size_t) {
+        Search search(n, compare, combine);
+        std::vector< DT >& row = search.row();
+        const std::vector< DT >& result = row;
+        for (;;)
+        {
+            std::size_t u = next_source++;
+            if (u >= n)
+                break;
+            search.run(g2, Vertex2(u), DT(inf), DT(zero));
+            if (has_negative)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    row[i] = combine(h[i] - h[u], row[i]);
+            }
+            try
+            {
+                row_function(verts1[u], result);
+            }
+            catch (...)
+            {
+                next_source = n;
+                throw;
+            }
+        }
+    });
+    return true;
+}
+
+template < class VertexAndEdgeListGraph, class RowFunction >
+bool parallel_johnson_all_pairs_shortest_paths(
+    const VertexAndEdgeListGraph& g, RowFunction row_function,
+    std::size_t num_threads = 0)
+{
+    typedef typename property_map< VertexAndEdgeListGraph,
+        edge_weight_t >::const_type Weight;
+    typedef typename property_traits< Weight >::value_type WT;
+    return parallel_johnson_all_pairs_shortest_paths(g, row_function,
+        get(vertex_index, g), get(edge_weight, g), std::less< WT >(),
+        closed_plus< WT >(), (std::numeric_limits< WT >::max)(), WT(),
+        num_threads);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_JOHNSON_ALL_PAIRS_SHORTEST_HPP
@@ -0,0 +1,132 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
+#define BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
+
+/*
+  Multithreaded PageRank by power iteration over the compressed layout of
+  page_rank.hpp.  Requires C++11 threads and lambdas.
+*/
+
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace boost
+{
+namespace graph
+{
+
+    /**
+     * PageRank by parallel power iteration in pull form, over a
+     * compressed copy of the in-edges of the graph. The rank of the
+     * dangling vertices is spread uniformly over all vertices, so the
+     * ranks sum to one. Stops when the L1 norm of the change of the rank
+     * vector is at most tolerance, or after max_iterations iterations,
+     * and returns the number of iterations.
+     */
+    template < typename Graph, typename RankMap, typename VertexIndexMap >
+    std::size_t parallel_page_rank(const Graph& g, RankMap rank_map,
+        VertexIndexMap index,
+        typename property_traits< RankMap >::value_type damping,
+        typename property_traits< RankMap >::value_type tolerance,
+        std::size_t max_iterations, std::size_t num_threads)
+    {
+        typedef typename property_traits< RankMap >::value_type rank_type;
+
+        detail::page_rank_layout< rank_type > layout(g, index, true);
+        const std::size_t n = layout.size();
+        if (n == 0)
+            return 0;
+        detail::thread_pool pool(num_threads);
+        const std::size_t num_blocks = pool.size();
+
+        // Blocks of vertices with about the same number of in-edges plus
+        // vertices, as row_start[v] + v increases strictly with v
+        std::vector< std::size_t > block_start(num_blocks + 1, n);
+        for (std::size_t i = 0; i < num_blocks; ++i)
+        {
+            std::size_t work = detail::block_begin(
+                layout.row_start[n] + n, num_blocks, i);
+            std::size_t first = 0, last = n;
+            while (first < last)
+            {
+                std::size_t middle = first + (last - first) / 2;
+                if (layout.row_start[middle] + middle < work)
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+            block_start[i] = first;
+        }
+
+        std::vector< rank_type > rank(n, rank_type(1) / rank_type(n));
+        std::vector< rank_type > next(n), contribution(n);
+        std::vector< rank_type > partial(num_blocks);
+        std::size_t iteration = 0;
+        while (iteration < max_iterations)
+        {
+            ++iteration;
+            pool.run([&](std::size_t i) {
+                rank_type dangling(0);
+                for (std::size_t u = block_start[i]; u < block_start[i + 1];
+                     ++u)
+                {
+                    contribution[u] = rank[u] * layout.inv_out_degree[u];
+                    if (layout.inv_out_degree[u] == rank_type(0))
+                        dangling += rank[u];
+                }
+                partial[i] = dangling;
+            });
+            rank_type dangling(0);
+            for (std::size_t i = 0; i < num_blocks; ++i)
+                dangling += partial[i];
+            const rank_type base
+                = ((rank_type(1) - damping) + damping * dangling)
+                / rank_type(n);
+
+            pool.run([&](std::size_t i) {
+                rank_type residual(0);
+                for (std::size_t v = block_start[i]; v < block_start[i + 1];
+                     ++v)
+                {
+                    rank_type sum(0);
+                    for (std::size_t k = layout.row_start[v];
+                         k < layout.row_start[v + 1]; ++k)
+                        sum += contribution[layout.neighbors[k]];
+                    next[v] = base + damping * sum;
+                    residual += std::abs(next[v] - rank[v]);
+                }
+                partial[i] = residual;
+            });
+            rank.swap(next);
+            rank_type residual(0);
+            for (std::size_t i = 0; i < num_blocks; ++i)
+                residual += partial[i];
+            if (residual <= tolerance)
+                break;
+        }
+        detail::put_page_rank(g, rank_map, index, rank);
+        return iteration;
+    }
+
+    template < typename Graph, typename RankMap >
+    std::size_t parallel_page_rank(const Graph& g, RankMap rank_map,
+        typename property_traits< RankMap >::value_type damping = 0.85,
+        typename property_traits< RankMap >::value_type tolerance = 1e-6,
+        std::size_t max_iterations = 100, std::size_t num_threads = 0)
+    {
+        return parallel_page_rank(g, rank_map, get(vertex_index, g), damping,
+            tolerance, max_iterations, num_threads);
+    }
+
+}
+} // end namespace boost::graph
+
+#endif // BOOST_GRAPH_PARALLEL_PAGE_RANK_HPP
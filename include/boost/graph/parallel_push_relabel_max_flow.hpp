@@ -0,0 +1,470 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
+#define BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
+
+/*
+  Multithreaded maximum flow by the synchronous push-relabel method
+  (A. V. Goldberg and R. E. Tarjan, "A new approach to the maximum-flow
+  problem", JACM 35, 1988; N. Baumstark, G. Blelloch and J. Shun,
+  "Efficient Implementation of a Synchronous Parallel Push-Relabel
+  Algorithm", ESA 2015).
+
+  The algorithm runs in pulses over the active vertices, each in three
+  steps separated by barriers, with the distance labels fixed during the
+  first two:
+
+  - The threads discharge chunks of the active vertices along their
+    admissible edges, those to a vertex of label one less.  An edge (u, v)
+    and its reverse are then only changed by u, since v would need a label
+    one more than that of u to push back, so the residual capacities need
+    no synchronization.  The flow arriving at v is sent as a request to
+    the owner of v, the thread owning the range of indices of v, as in
+    delta_stepping_shortest_paths (see detail/owner_requests.hpp).
+  - The vertices left with excess and no admissible edge compute their new
+    label from the labels of their neighbors, and send it to their owner.
+    Since all the labels are raised at once from the old ones, they stay
+    valid.
+  - Every owner applies the new labels and the flow sent to its vertices,
+    and collects the vertices that are active in the next pulse.
+
+  The labels are recomputed by a level-synchronous breadth-first search
+  from the sink, also split between the owners, at the start and each time
+  the relabeling work exceeds a multiple of 6 V + E / 2; the vertices it
+  does not reach drop out, which subsumes the gap heuristic.  A second
+  phase returns the excess of the vertices that cannot reach the sink to
+  the source, by the same pulses towards the source with the sink blocked.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/owner_requests.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    template < class Graph, class EdgeCapacityMap,
+        class ResidualCapacityEdgeMap, class ReverseEdgeMap,
+        class VertexIndexMap, class FlowValue >
+    class parallel_push_relabel
+    {
+        typedef graph_traits< Graph > Traits;
+        typedef typename Traits::vertex_descriptor Vertex;
+        typedef typename Traits::edge_descriptor Edge;
+        typedef typename Traits::out_edge_iterator OutEdgeIterator;
+
+        // Flow pushed to a vertex
+        struct push_request
+        {
+            std::size_t target;
+            FlowValue delta;
+        };
+
+        // The new label of a vertex
+        struct relabel_request
+        {
+            std::size_t vertex;
+            std::size_t label;
+        };
+
+        struct owner_state
+        {
+            // The vertices of this owner that are active next
+            std::vector< std::size_t > active;
+            // The vertices discharged by this thread that need a new label
+            std::vector< std::size_t > relabeled;
+            std::size_t work;
+        };
+
+    public:
+        parallel_push_relabel(Graph& g, EdgeCapacityMap capacity,
+            ResidualCapacityEdgeMap residual_capacity,
+            ReverseEdgeMap reverse_edge, VertexIndexMap index,
+            std::size_t num_threads)
+        : m_g(g)
+        , m_n(num_vertices(g))
+        , m_capacity(capacity)
+        , m_residual_capacity(residual_capacity)
+        , m_reverse_edge(reverse_edge)
+        , m_index(index)
+        , m_pool(num_threads)
+        , m_num_owners(m_pool.size())
+        , m_pushes(m_n, m_num_owners)
+        , m_relabels(m_n, m_num_owners)
+        , m_vertex_of(m_n)
+        , m_current(m_n)
+        , m_excess(m_n, 0)
+        , m_label(m_n, m_n)
+        , m_is_active(m_n, 0)
+        , m_owners(m_num_owners)
+        {
+            // The relabeling work that triggers a global relabeling
+            m_nm = 6 * m_n + num_edges(g) / 2;
+            typename Traits::vertex_iterator u, u_end;
+            for (boost::tie(u, u_end) = vertices(g); u != u_end; ++u)
+                m_vertex_of[get(index, *u)] = *u;
+        }
+
+        FlowValue maximum_flow(Vertex src, Vertex sink)
+        {
+            m_pool.for_each_block(
+                m_n, [&](std::size_t, std::size_t first, std::size_t last) {
+                    OutEdgeIterator a, a_end;
+                    for (std::size_t i = first; i < last; ++i)
+                        for (boost::tie(a, a_end)
+                             = out_edges(m_vertex_of[i], m_g);
+                             a != a_end; ++a)
+                            put(m_residual_capacity, *a,
+                                get(m_capacity, *a));
+                });
+
+            OutEdgeIterator a, a_end;
+            for (boost::tie(a, a_end) = out_edges(src, m_g); a != a_end; ++a)
+                if (target(*a, m_g) != src)
+                {
+                    FlowValue delta = get(m_residual_capacity, *a);
+                    put(m_residual_capacity, *a, 0);
+                    Edge rev = get(m_reverse_edge, *a);
+                    put(m_residual_capacity, rev,
+                        get(m_residual_capacity, rev) + delta);
+                    m_excess[get(m_index, target(*a, m_g))] += delta;
+                }
+
+            // Phase one computes a maximum preflow; phase two returns the
+            // excess that cannot reach the sink to the source
+            run(get(m_index, sink), get(m_index, src));
+            FlowValue flow = m_excess[get(m_index, sink)];
+            run(get(m_index, src), get(m_index, sink));
+            return flow;
+        }
+
+    private:
+        // Pushes flow from every vertex with excess towards the target,
+        // whose label is zero, while the blocked vertex keeps label n
+        void run(std::size_t target_index, std::size_t blocked_index)
+        {
+            m_target = target_index;
+            m_blocked = blocked_index;
+            global_relabel();
+            std::size_t work = 0;
+            while (!m_active.empty())
+            {
+                m_chunks.reset(m_active.size());
+                m_pool.run([&](std::size_t t) { discharge(t); });
+                m_relabeled.clear();
+                for (std::size_t t = 0; t < m_num_owners; ++t)
+                {
+                    std::vector< std::size_t >& relabeled
+                        = m_owners[t].relabeled;
+                    m_relabeled.insert(
+                        m_relabeled.end(), relabeled.begin(), relabeled.end());
+                    relabeled.clear();
+                }
+                m_chunks.reset(m_relabeled.size());
+                m_pool.run([&](std::size_t t) { relabel(t); });
+                m_pool.run([&](std::size_t t) { apply_requests(t); });
+                m_active.clear();
+                for (std::size_t t = 0; t < m_num_owners; ++t)
+                {
+                    owner_state& owner = m_owners[t];
+                    m_active.insert(m_active.end(), owner.active.begin(),
+                        owner.active.end());
+                    owner.active.clear();
+                    work += owner.work;
+                }
+                // As often as push_relabel_max_flow
+                if (work > 2 * m_nm)
+                {
+                    work = 0;
+                    global_relabel();
+                }
+            }
+        }
+
+        // Push the excess of chunks of the active vertices along their
+        // admissible edges, and keep those that still have excess for
+        // relabeling
+        void discharge(std::size_t t)
+        {
+            owner_state& owner = m_owners[t];
+            owner.work = 0;
+            OutEdgeIterator a, a_end;
+            std::size_t first, last;
+            while (m_chunks.next(first, last))
+            {
+                for (std::size_t k = first; k < last; ++k)
+                {
+                    std::size_t u = m_active[k];
+                    std::size_t du = m_label[u];
+                    FlowValue excess = m_excess[u];
+                    for (boost::tie(a, a_end) = m_current[u]; a != a_end;
+                         ++a)
+                    {
+                        std::size_t v = get(m_index, target(*a, m_g));
+                        // Checked first: v may push back along the reverse
+                        // edge only if its label is one more than du
+                        if (m_label[v] + 1 != du)
+                            continue;
+                        FlowValue r = get(m_residual_capacity, *a);
+                        if (r == 0)
+                            continue;
+                        FlowValue delta = (std::min)(excess, r);
+                        put(m_residual_capacity, *a, r - delta);
+                        Edge rev = get(m_reverse_edge, *a);
+                        put(m_residual_capacity, rev,
+                            get(m_residual_capacity, rev) + delta);
+                        excess -= delta;
+                        push_request request = { v, delta };
+                        m_pushes.send(t, v, request);
+                        if (excess == 0)
+                            break;
+                    }
+                    m_current[u].first = a;
+                    m_excess[u] = excess;
+                    if (excess > 0)
+                        owner.relabeled.push_back(u);
+                }
+            }
+        }
+
+        // The new labels of the vertices left with excess, from the labels
+        // of the targets of their residual edges
+        void relabel(std::size_t t)
+        {
+            owner_state& owner = m_owners[t];
+            OutEdgeIterator a, a_end, min_edge;
+            std::size_t first, last;
+            while (m_chunks.next(first, last))
+            {
+                for (std::size_t k = first; k < last; ++k)
+                {
+                    std::size_t u = m_relabeled[k];
+                    std::size_t min_label = m_n;
+                    owner.work += 12;
+                    for (boost::tie(a, a_end) = out_edges(m_vertex_of[u], m_g);
+                         a != a_end; ++a)
+                    {
+                        ++owner.work;
+                        if (get(m_residual_capacity, *a) > 0)
+                        {
+                            std::size_t d
+                                = m_label[get(m_index, target(*a, m_g))];
+                            if (d < min_label)
+                            {
+                                min_label = d;
+                                min_edge = a;
+                            }
+                        }
+                    }
+                    relabel_request request = { u, m_n };
+                    if (min_label + 1 < m_n)
+                    {
+                        request.label = min_label + 1;
+                        m_current[u] = std::make_pair(min_edge, a_end);
+                    }
+                    m_relabels.send(t, u, request);
+                }
+            }
+        }
+
+        // Apply the new labels and the flow sent to the vertices of this
+        // owner, and collect those that are active next
+        void apply_requests(std::size_t t)
+        {
+            owner_state& owner = m_owners[t];
+            m_relabels.receive(t, [&](const relabel_request& r) {
+                m_label[r.vertex] = r.label;
+                if (r.label < m_n)
+                    activate(owner, r.vertex);
+            });
+            m_pushes.receive(t, [&](const push_request& r) {
+                m_excess[r.target] += r.delta;
+                if (r.target != m_target && m_label[r.target] < m_n)
+                    activate(owner, r.target);
+            });
+            for (std::size_t k = 0; k < owner.active.size(); ++k)
+                m_is_active[owner.active[k]] = 0;
+        }
+
+        void activate(owner_state& owner, std::size_t v)
+        {
+            if (!m_is_active[v])
+            {
+                m_is_active[v] = 1;
+                owner.active.push_back(v);
+            }
+        }
+
+        // The labels are the distances to the target in the residual
+        // graph, from a breadth-first search along the reverse residual
+        // edges whose levels are split between the owners
+        void global_relabel()
+        {
+            m_pool.for_each_block(
+                m_n, [&](std::size_t, std::size_t first, std::size_t last) {
+                    std::fill(
+                        m_label.begin() + first, m_label.begin() + last, m_n);
+                });
+            m_label[m_target] = 0;
+            std::vector< std::size_t > frontier(1, m_target);
+            for (std::size_t level = 1; !frontier.empty(); ++level)
+            {
+                m_pool.for_each_block(frontier.size(),
+                    [&](std::size_t t, std::size_t first, std::size_t last) {
+                        OutEdgeIterator a, a_end;
+                        for (std::size_t k = first; k < last; ++k)
+                            for (boost::tie(a, a_end)
+                                 = out_edges(m_vertex_of[frontier[k]], m_g);
+                                 a != a_end; ++a)
+                            {
+                                std::size_t w
+                                    = get(m_index, target(*a, m_g));
+                                if (m_label[w] == m_n && w != m_blocked
+                                    && get(m_residual_capacity,
+                                           get(m_reverse_edge, *a))
+                                        > 0)
+                                {
+                                    relabel_request request = { w, level };
+                                    m_relabels.send(t, w, request);
+                                }
+                            }
+                    });
+                m_pool.run([&](std::size_t t) {
+                    owner_state& owner = m_owners[t];
+                    m_relabels.receive(t, [&](const relabel_request& r) {
+                        std::size_t w = r.vertex;
+                        if (m_label[w] != m_n)
+                            return;
+                        m_label[w] = r.label;
+                        m_current[w] = out_edges(m_vertex_of[w], m_g);
+                        owner.active.push_back(w);
+                    });
+                });
+                frontier.clear();
+                for (std::size_t t = 0; t < m_num_owners; ++t)
+                {
+                    frontier.insert(frontier.end(),
+                        m_owners[t].active.begin(), m_owners[t].active.end());
+                    m_owners[t].active.clear();
+                }
+            }
+
+            m_pool.for_each_block(
+                m_n, [&](std::size_t t, std::size_t first, std::size_t last) {
+                    for (std::size_t i = first; i < last; ++i)
+                        if (i != m_target && m_label[i] < m_n
+                            && m_excess[i] > 0)
+                            m_owners[t].active.push_back(i);
+                });
+            m_active.clear();
+            for (std::size_t t = 0; t < m_num_owners; ++t)
+            {
+                m_active.insert(m_active.end(), m_owners[t].active.begin(),
+                    m_owners[t].active.end());
+                m_owners[t].active.clear();
+            }
+        }
+
+        Graph& m_g;
+        const std::size_t m_n;
+        std::size_t m_nm;
+        EdgeCapacityMap m_capacity;
+        ResidualCapacityEdgeMap m_residual_capacity;
+        ReverseEdgeMap m_reverse_edge;
+        VertexIndexMap m_index;
+        graph::detail::thread_pool m_pool;
+        const std::size_t m_num_owners;
+        // Flow and new labels sent to the owners of the vertices
+        graph::detail::owner_requests< push_request > m_pushes;
+        graph::detail::owner_requests< relabel_request > m_relabels;
+
+        // By vertex index
+        std::vector< Vertex > m_vertex_of;
+        std::vector< std::pair< OutEdgeIterator, OutEdgeIterator > >
+            m_current;
+        std::vector< FlowValue > m_excess;
+        std::vector< std::size_t > m_label;
+        // Whether a vertex is active in the next pulse; only accessed by
+        // its owner
+        std::vector< char > m_is_active;
+
+        std::vector< owner_state > m_owners;
+        std::vector< std::size_t > m_active;
+        std::vector< std::size_t > m_relabeled;
+        graph::detail::chunk_dispenser m_chunks;
+        std::size_t m_target, m_blocked;
+    };
+} // namespace detail
+
+/** Maximum flow by the push-relabel method on num_threads threads.
+ *
+ * The parameters and the result are those of push_relabel_max_flow.  The
+ * residual capacity map must allow different edges to be written by
+ * different threads at the same time.
+ */
+template < class Graph, class CapacityEdgeMap, class ResidualCapacityEdgeMap,
+    class ReverseEdgeMap, class VertexIndexMap >
+typename property_traits< CapacityEdgeMap >::value_type
+parallel_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink, CapacityEdgeMap cap,
+    ResidualCapacityEdgeMap res, ReverseEdgeMap rev, VertexIndexMap index_map,
+    std::size_t num_threads = 0)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    typedef typename property_traits< CapacityEdgeMap >::value_type FlowValue;
+
+    detail::parallel_push_relabel< Graph, CapacityEdgeMap,
+        ResidualCapacityEdgeMap, ReverseEdgeMap, VertexIndexMap, FlowValue >
+        algo(g, cap, res, rev, index_map, num_threads);
+    return algo.maximum_flow(src, sink);
+}
+
+// Named Parameter Variant.  Accepts the parameters of
+// push_relabel_max_flow, and num_threads.
+template < class Graph, class P, class T, class R >
+typename detail::edge_capacity_value< Graph, P, T, R >::type
+parallel_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink,
+    const bgl_named_params< P, T, R >& params)
+{
+    return parallel_push_relabel_max_flow(g, src, sink,
+        choose_const_pmap(get_param(params, edge_capacity), g, edge_capacity),
+        choose_pmap(get_param(params, edge_residual_capacity), g,
+            edge_residual_capacity),
+        choose_const_pmap(get_param(params, edge_reverse), g, edge_reverse),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        choose_param(get_param(params, num_threads_t()), 0));
+}
+
+template < class Graph >
+typename property_traits<
+    typename property_map< Graph, edge_capacity_t >::const_type >::value_type
+parallel_push_relabel_max_flow(Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor src,
+    typename graph_traits< Graph >::vertex_descriptor sink)
+{
+    bgl_named_params< int, buffer_param_t > params(0); // bogus empty param
+    return parallel_push_relabel_max_flow(g, src, sink, params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_PUSH_RELABEL_MAX_FLOW_HPP
@@ -0,0 +1,167 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+#define BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+namespace graph
+{
+
+    namespace detail
+    {
+        struct push_page_rank_state
+        {
+            push_page_rank_state() : rank(0), residual(0), queued(false) {}
+
+            double rank;
+            double residual;
+            bool queued;
+        };
+    } // end namespace detail
+
+    /**
+     * Personalized PageRank by forward push (Andersen, Chung and Lang).
+     *
+     * The seeds are pairs of a vertex and a non-negative weight; the
+     * random walk restarts at a seed chosen with probability proportional
+     * to its weight, follows a uniformly chosen out-edge with probability
+     * damping at each step, and restarts from vertices without out-edges.
+     * Residual mass is pushed from a vertex u while it exceeds
+     * epsilon * max(out_degree(u, g), 1), so the work is
+     * O(1 / ((1 - damping) epsilon)) whatever the size of the graph, and
+     * only the vertices touched are stored. Writes a pair of a vertex and
+     * its (under-)estimated rank for every vertex of positive estimate to
+     * out, in no particular order, and returns the end of the output.
+     */
+    template < typename IncidenceGraph, typename SeedIterator,
+        typename OutputIterator >
+    OutputIterator personalized_page_rank(const IncidenceGraph& g,
+        SeedIterator seed_begin, SeedIterator seed_end, OutputIterator out,
+        double damping = 0.85, double epsilon = 1e-6)
+    {
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< IncidenceGraph >));
+        typedef typename graph_traits< IncidenceGraph >::vertex_descriptor
+            vertex_descriptor;
+        typedef typename graph_traits< IncidenceGraph >::out_edge_iterator
+            out_edge_iterator;
+        typedef detail::push_page_rank_state state_type;
+
+        BOOST_ASSERT(damping >= 0 && damping < 1 && epsilon > 0);
+
+        // The seeds, normalized into a distribution
+        std::vector< std::pair< vertex_descriptor, double > > seeds(
+            seed_begin, seed_end);
+        double total = 0;
+        for (std::size_t i = 0; i < seeds.size(); ++i)
+            total += seeds[i].second;
+        if (total <= 0)
+            return out;
+
+        boost::unordered_map< vertex_descriptor, state_type > states;
+        std::deque< vertex_descriptor > active;
+        const double threshold = epsilon;
+
+        for (std::size_t i = 0; i < seeds.size(); ++i)
+            states[seeds[i].first].residual += seeds[i].second / total;
+        for (std::size_t i = 0; i < seeds.size(); ++i)
+        {
+            state_type& s = states[seeds[i].first];
+            if (!s.queued)
+            {
+                s.queued = true;
+                active.push_back(seeds[i].first);
+            }
+        }
+
+        while (!active.empty())
+        {
+            vertex_descriptor u = active.front();
+            active.pop_front();
+            state_type& su = states[u];
+            su.queued = false;
+            std::size_t degree = out_degree(u, g);
+            double r = su.residual;
+            if (r <= threshold * double((std::max)(degree, std::size_t(1))))
+                continue;
+
+            su.residual = 0;
+            su.rank += (1 - damping) * r;
+            double push = damping * r;
+            if (degree == 0)
+            {
+                // Restart from the seeds
+                for (std::size_t i = 0; i < seeds.size(); ++i)
+                {
+                    vertex_descriptor v = seeds[i].first;
+                    state_type& sv = states[v];
+                    sv.residual += push * seeds[i].second / total;
+                    if (!sv.queued)
+                    {
+                        sv.queued = true;
+                        active.push_back(v);
+                    }
+                }
+                continue;
+            }
+
+            push /= double(degree);
+            out_edge_iterator e, e_end;
+            for (boost::tie(e, e_end) = out_edges(u, g); e != e_end; ++e)
+            {
+                vertex_descriptor v = target(*e, g);
+                state_type& sv = states[v];
+                sv.residual += push;
+                if (!sv.queued
+                    && sv.residual > threshold
+                            * double((std::max)(
+                                std::size_t(out_degree(v, g)),
+                                std::size_t(1))))
+                {
+                    sv.queued = true;
+                    active.push_back(v);
+                }
+            }
+        }
+
+        typename boost::unordered_map< vertex_descriptor,
+            state_type >::const_iterator i;
+        for (i = states.begin(); i != states.end(); ++i)
+            if (i->second.rank > 0)
+                *out++ = std::make_pair(i->first, i->second.rank);
+        return out;
+    }
+
+    /**
+     * Personalized PageRank from a single seed vertex.
+     */
+    template < typename IncidenceGraph, typename OutputIterator >
+    OutputIterator personalized_page_rank(const IncidenceGraph& g,
+        typename graph_traits< IncidenceGraph >::vertex_descriptor seed,
+        OutputIterator out, double damping = 0.85, double epsilon = 1e-6)
+    {
+        std::pair< typename graph_traits< IncidenceGraph >::vertex_descriptor,
+            double >
+            seeds[1] = { std::make_pair(seed, 1.0) };
+        return personalized_page_rank(
+            g, seeds, seeds + 1, out, damping, epsilon);
+    }
+
+}
+} // end namespace boost::graph
+
+#endif // BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
@@ -0,0 +1,365 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_QUEUE_BELLMAN_FORD_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_QUEUE_BELLMAN_FORD_SHORTEST_PATHS_HPP
+
+/*
+  Single-source shortest paths with negative weights by the queue-based
+  Bellman-Ford algorithm, with the small label first and large label last
+  heuristics of D. P. Bertsekas ("A simple and fast label correcting
+  algorithm for shortest paths", Networks 23, 1993) and the subtree
+  disassembly of R. E. Tarjan (Data Structures and Network Algorithms,
+  1983), as studied by B. V. Cherkassky and A. V. Goldberg ("Negative-cycle
+  detection algorithms", Mathematical Programming 85, 1999).
+
+  Only the vertices whose distance decreased are queued, so a vertex is
+  scanned once per improvement rather than once per pass over all edges.
+  A vertex whose distance decreases is put at the front of the queue if
+  its distance is below that of the front vertex (SLF), and a vertex at
+  the front whose distance is above the mean of the queue is moved to the
+  back (LLL, for arithmetic distance types only).
+
+  The predecessors form a tree, kept as a list of the vertices in preorder
+  with their depths.  When the distance of v decreases, the subtree of v is
+  first taken out of the tree and its vertices out of the queue: their
+  distances are known to decrease as well, through v, so scanning them
+  before that is wasted.  If the vertex u whose edge lowers the distance
+  of v is in that subtree, the tree path from v to u and the edge (u, v)
+  form a negative cycle, found as soon as it appears among the
+  predecessors instead of after V passes.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/relax.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Mean of the distances of the queued vertices, for the LLL heuristic
+    template < typename Distance,
+        bool Arithmetic = is_arithmetic< Distance >::value >
+    class queue_bellman_ford_mean
+    {
+    public:
+        queue_bellman_ford_mean() : m_sum(0), m_count(0) {}
+
+        void add(const Distance& d)
+        {
+            m_sum += double(d);
+            ++m_count;
+        }
+
+        void remove(const Distance& d)
+        {
+            m_sum -= double(d);
+            --m_count;
+        }
+
+        void update(const Distance& from, const Distance& to)
+        {
+            m_sum += double(to) - double(from);
+        }
+
+        bool above(const Distance& d) const
+        {
+            return double(d) * double(m_count) > m_sum;
+        }
+
+    private:
+        double m_sum;
+        std::size_t m_count;
+    };
+
+    template < typename Distance >
+    class queue_bellman_ford_mean< Distance, false >
+    {
+    public:
+        void add(const Distance&) {}
+        void remove(const Distance&) {}
+        void update(const Distance&, const Distance&) {}
+        bool above(const Distance&) const { return false; }
+    };
+} // namespace detail
+
+/* Shortest paths from the vertices whose distance is not inf, the others
+   having distance inf, with predecessor and distance already initialized.
+   Returns true if no negative cycle is reachable from those vertices.
+   Otherwise returns false as soon as one is found, after writing its edges
+   to negative_cycle in order along the cycle; the distances and
+   predecessors are then those reached so far.
+*/
+template < typename Graph, typename PredecessorMap, typename DistanceMap,
+    typename WeightMap, typename VertexIndexMap, typename Compare,
+    typename Combine, typename DistInf, typename OutputIterator >
+bool queue_bellman_ford_shortest_paths_no_init(const Graph& g,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    VertexIndexMap index, Compare compare, Combine combine, DistInf inf,
+    OutputIterator negative_cycle)
+{
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef graph_traits< Graph > Traits;
+    typedef typename Traits::vertex_descriptor Vertex;
+    typedef typename Traits::edge_descriptor Edge;
+    typedef typename property_traits< DistanceMap >::value_type Distance;
+    BOOST_CONCEPT_ASSERT((ReadWritePropertyMapConcept< DistanceMap, Vertex >));
+    BOOST_CONCEPT_ASSERT(
+        (WritablePropertyMapConcept< PredecessorMap, Vertex >));
+    BOOST_CONCEPT_ASSERT((ReadablePropertyMapConcept< WeightMap, Edge >));
+    BOOST_CONCEPT_ASSERT(
+        (ReadablePropertyMapConcept< VertexIndexMap, Vertex >));
+    const std::size_t npos = std::size_t(-1);
+
+    // The tree of predecessors, by vertex index, with an extra root n whose
+    // children are the sources.  next and prev link the vertices of the
+    // tree in preorder, in a circular list through the root.
+    const std::size_t n = num_vertices(g), root = n;
+    std::vector< Vertex > vertex_of(n);
+    std::vector< std::size_t > parent(n, npos);
+    std::vector< Edge > parent_edge(n);
+    std::vector< std::size_t > depth(n + 1, 0), next(n + 1), prev(n + 1);
+    std::vector< char > queued(n, 0);
+    std::deque< std::size_t > queue;
+    detail::queue_bellman_ford_mean< Distance > mean;
+    next[root] = prev[root] = root;
+
+    typename Traits::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    {
+        std::size_t i = get(index, *vi);
+        vertex_of[i] = *vi;
+        Distance d = get(distance, *vi);
+        if (!compare(d, Distance(inf)))
+            continue;
+        parent[i] = root;
+        depth[i] = 1;
+        next[i] = root;
+        prev[i] = prev[root];
+        next[prev[root]] = i;
+        prev[root] = i;
+        queued[i] = 1;
+        mean.add(d);
+        queue.push_back(i);
+    }
+
+    // Consecutive moves to the back, bounded in case rounding makes every
+    // queued distance look above the mean
+    std::size_t moves = 0;
+    typename Traits::out_edge_iterator ei, ei_end;
+    while (!queue.empty())
+    {
+        std::size_t i = queue.front();
+        queue.pop_front();
+        if (!queued[i])
+            continue;
+        Vertex u = vertex_of[i];
+        Distance d_u = get(distance, u);
+        if (mean.above(d_u) && moves < queue.size())
+        {
+            queue.push_back(i);
+            ++moves;
+            continue;
+        }
+        moves = 0;
+        queued[i] = 0;
+        mean.remove(d_u);
+
+        for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+        {
+            Vertex v = target(*ei, g);
+            std::size_t j = get(index, v);
+            Distance d_v = combine(d_u, get(weight, *ei));
+            Distance old = get(distance, v);
+            if (!compare(d_v, old))
+                continue;
+            if (j == i)
+            {
+                *negative_cycle++ = *ei;
+                return false;
+            }
+
+            // Take the subtree of v out of the tree and the queue
+            if (parent[j] != npos)
+            {
+                std::size_t x = next[j];
+                for (; depth[x] > depth[j]; x = next[x])
+                {
+                    if (x == i)
+                    {
+                        // The parents of the vertices already passed are
+                        // cleared, but not the edges from them
+                        std::vector< Edge > cycle(1, *ei);
+                        for (std::size_t k = i; k != j;
+                             k = get(index, source(parent_edge[k], g)))
+                            cycle.push_back(parent_edge[k]);
+                        std::reverse(cycle.begin(), cycle.end() - 1);
+                        std::copy(cycle.begin(), cycle.end(), negative_cycle);
+                        return false;
+                    }
+                    parent[x] = npos;
+                    if (queued[x])
+                    {
+                        queued[x] = 0;
+                        mean.remove(get(distance, vertex_of[x]));
+                    }
+                }
+                next[prev[j]] = x;
+                prev[x] = prev[j];
+            }
+
+            // v becomes the first child of u
+            parent[j] = i;
+            parent_edge[j] = *ei;
+            depth[j] = depth[i] + 1;
+            next[j] = next[i];
+            prev[next[i]] = j;
+            next[i] = j;
+            prev[j] = i;
+
+            put(distance, v, d_v);
+            put(predecessor, v, u);
+            if (queued[j])
+                mean.update(old, d_v);
+            else
+            {
+                queued[j] = 1;
+                mean.add(d_v);
+                if (!queue.empty()
+                    && compare(d_v, get(distance, vertex_of[queue.front()])))
+                    queue.push_front(j);
+                else
+                    queue.push_back(j);
+            }
+        }
+    }
+    return true;
+}
+
+/* Shortest paths from s, which may go through negative edges.  Returns
+   false if a negative cycle is reachable from s, after writing its edges
+   to negative_cycle.
+*/
+template < typename Graph, typename PredecessorMap, typename DistanceMap,
+    typename WeightMap, typename VertexIndexMap, typename Compare,
+    typename Combine, typename DistInf, typename DistZero,
+    typename OutputIterator >
+bool queue_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    VertexIndexMap index, Compare compare, Combine combine, DistInf inf,
+    DistZero zero, OutputIterator negative_cycle)
+{
+    typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    {
+        put(distance, *vi, inf);
+        put(predecessor, *vi, *vi);
+    }
+    put(distance, s, zero);
+    return queue_bellman_ford_shortest_paths_no_init(g, predecessor, distance,
+        weight, index, compare, combine, inf, negative_cycle);
+}
+
+namespace detail
+{
+    // Discards the edges of a negative cycle
+    struct null_edge_output
+    {
+        typedef std::output_iterator_tag iterator_category;
+        typedef void value_type;
+        typedef void difference_type;
+        typedef void pointer;
+        typedef void reference;
+
+        null_edge_output& operator*() { return *this; }
+        null_edge_output& operator++() { return *this; }
+        null_edge_output& operator++(int) { return *this; }
+        template < typename Edge > null_edge_output& operator=(const Edge&)
+        {
+            return *this;
+        }
+    };
+
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline bool queue_bellman_ford_dispatch2(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for predecessor map
+        dummy_property_map p_map;
+
+        typedef typename property_traits< DistanceMap >::value_type D;
+        D inf = choose_param(get_param(params, distance_inf_t()),
+            (std::numeric_limits< D >::max)());
+
+        return queue_bellman_ford_shortest_paths(g, s,
+            choose_param(get_param(params, vertex_predecessor), p_map),
+            distance, weight, index_map,
+            choose_param(
+                get_param(params, distance_compare_t()), std::less< D >()),
+            choose_param(
+                get_param(params, distance_combine_t()), closed_plus< D >(inf)),
+            inf, choose_param(get_param(params, distance_zero_t()), D()),
+            null_edge_output());
+    }
+
+    template < class Graph, class DistanceMap, class WeightMap,
+        class IndexMap, class Params >
+    inline bool queue_bellman_ford_dispatch1(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, WeightMap weight, IndexMap index_map,
+        const Params& params)
+    {
+        // Default for distance map
+        typedef typename property_traits< WeightMap >::value_type D;
+        typename std::vector< D >::size_type n
+            = is_default_param(distance) ? num_vertices(g) : 1;
+        std::vector< D > distance_map(n);
+
+        return detail::queue_bellman_ford_dispatch2(g, s,
+            choose_param(distance,
+                make_iterator_property_map(
+                    distance_map.begin(), index_map, distance_map[0])),
+            weight, index_map, params);
+    }
+} // namespace detail
+
+// Named Parameter Variant.  Accepts weight_map, vertex_index_map,
+// distance_map, predecessor_map, distance_compare, distance_combine,
+// distance_inf and distance_zero.
+template < class Graph, class Param, class Tag, class Rest >
+inline bool queue_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    return detail::queue_bellman_ford_dispatch1(g, s,
+        get_param(params, vertex_distance),
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_QUEUE_BELLMAN_FORD_SHORTEST_PATHS_HPP
@@ -0,0 +1,325 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_REACHABILITY_INDEX_HPP
+#define BOOST_GRAPH_REACHABILITY_INDEX_HPP
+
+/*
+  Reachability queries by interval labels (H. Yildirim, V. Chaoji and
+  M. J. Zaki, "GRAIL: Scalable Reachability Index for Large Graphs", 2010).
+
+  The strong components of the graph are numbered in a topological order
+  of the condensation, so that u can only reach v if the component of v
+  does not come before that of u.  Each labeling comes from a depth-first
+  search of the condensation, with the roots and the successors of each
+  component taken in a random order: the label of a component is the
+  interval [low, post], where post is its postorder number and low the
+  smallest postorder number of the components it reaches.  If c reaches
+  d, the interval of d is within that of c, so a component whose interval
+  does not contain that of the target in one of the labelings cannot
+  reach it.  The labelings differ in the order of the searches, so
+  together they rule out most of the pairs that are not reachable.  Each
+  labeling also keeps the smallest postorder number in the subtree of the
+  component in its search tree, so that a target whose postorder number
+  falls in that subtree is reachable.  The other queries are answered by a
+  depth-first search of the condensation that only enters the components
+  whose intervals contain those of the target and that come before it,
+  and stops at a component whose subtree holds the target.  The labelings
+  are independent and are computed concurrently.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/concept/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/condensation.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
+
+namespace boost
+{
+
+/** A reachability index of a directed graph.
+ *
+ * Vertices are identified by their index in [0, num_vertices()), and the
+ * strong components by their position in a topological order of the
+ * condensation, in [0, num_components()).  Vertex is also the type of the
+ * labels, so a 32-bit type halves the size of the index of a graph with
+ * fewer than 2^32 vertices.  The index can be saved and loaded with
+ * Boost.Serialization; queries go through a reachability_index_query.
+ */
+template < typename Vertex = std::size_t > class reachability_index
+{
+public:
+    typedef Vertex vertex_type;
+
+    reachability_index() : m_num_intervals(0) {}
+
+    template < typename Graph, typename VertexIndexMap >
+    reachability_index(const Graph& g, VertexIndexMap index,
+        std::size_t num_intervals, std::size_t num_threads = 0)
+    {
+        build(g, index, num_intervals, num_threads);
+    }
+
+    template < typename Graph >
+    explicit reachability_index(const Graph& g, std::size_t num_threads = 0)
+    {
+        build(g, get(vertex_index, g), 5, num_threads);
+    }
+
+    std::size_t num_vertices() const { return m_component.size(); }
+
+    std::size_t num_components() const { return m_cyclic.size(); }
+
+    // The number of labelings
+    std::size_t num_intervals() const { return m_num_intervals; }
+
+    Vertex component(Vertex v) const { return m_component[v]; }
+
+    // Whether the vertices of c reach themselves: c has several vertices
+    // or a self-loop
+    bool cyclic(Vertex c) const { return m_cyclic[c] != 0; }
+
+    // The components with an edge from c, in increasing order
+    std::pair< const Vertex*, const Vertex* > successors(Vertex c) const
+    {
+        const Vertex* first = m_successors.data();
+        return std::make_pair(first + m_successor_start[c],
+            first + m_successor_start[c + 1]);
+    }
+
+    // Whether the interval of d is within that of c in every labeling,
+    // which it is if c reaches d
+    bool contains(Vertex c, Vertex d) const
+    {
+        const Vertex* a = m_labels.data() + 3 * m_num_intervals * c;
+        const Vertex* b = m_labels.data() + 3 * m_num_intervals * d;
+        for (std::size_t i = 0; i < 3 * m_num_intervals; i += 3)
+            if (b[i] < a[i] || a[i + 2] < b[i + 2])
+                return false;
+        return true;
+    }
+
+    // Whether d is in the subtree of c in the search tree of one of the
+    // labelings, in which case c reaches d
+    bool spans(Vertex c, Vertex d) const
+    {
+        const Vertex* a = m_labels.data() + 3 * m_num_intervals * c;
+        const Vertex* b = m_labels.data() + 3 * m_num_intervals * d;
+        for (std::size_t i = 0; i < 3 * m_num_intervals; i += 3)
+            if (a[i + 1] <= b[i + 2] && b[i + 2] <= a[i + 2])
+                return true;
+        return false;
+    }
+
+    template < typename Archive >
+    void serialize(Archive& ar, const unsigned int /*version*/)
+    {
+        ar& serialization::make_nvp("num_intervals", m_num_intervals);
+        ar& serialization::make_nvp("component", m_component);
+        ar& serialization::make_nvp("cyclic", m_cyclic);
+        ar& serialization::make_nvp("successor_start", m_successor_start);
+        ar& serialization::make_nvp("successors", m_successors);
+        ar& serialization::make_nvp("labels", m_labels);
+    }
+
+private:
+    template < typename Graph, typename VertexIndexMap >
+    void build(const Graph& g, VertexIndexMap index,
+        std::size_t num_intervals, std::size_t num_threads)
+    {
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+
+        detail::topological_condensation dag;
+        detail::build_topological_condensation(g, index, dag);
+        const std::size_t c = dag.size();
+        // Postorder numbers go up to c
+        if (c >= std::size_t(Vertex(-1)))
+            boost::throw_exception(std::length_error(
+                "reachability_index: too many vertices for the label type"));
+        m_num_intervals = num_intervals;
+        m_component.assign(dag.component.begin(), dag.component.end());
+        m_cyclic.swap(dag.cyclic);
+        m_successor_start.swap(dag.successor_start);
+        m_successors.assign(dag.successors.begin(), dag.successors.end());
+
+        graph::detail::thread_pool pool(
+            (std::min)(graph::detail::resolve_num_threads(num_threads),
+                (std::max)(num_intervals, std::size_t(1))));
+        std::vector< std::vector< Vertex > > labels(num_intervals);
+        pool.run([&](std::size_t t) {
+            for (std::size_t i = t; i < num_intervals; i += pool.size())
+                this->label(i, labels[i]);
+        });
+
+        m_labels.resize(3 * num_intervals * c);
+        pool.for_each_block(
+            c, [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t k = first; k < last; ++k)
+                    for (std::size_t i = 0; i < num_intervals; ++i)
+                        std::copy(labels[i].data() + 3 * k,
+                            labels[i].data() + 3 * k + 3,
+                            m_labels.data() + 3 * (num_intervals * k + i));
+            });
+    }
+
+    // The low, subtree and post numbers of the i-th labeling, from a
+    // depth-first search with its own random order
+    void label(std::size_t i, std::vector< Vertex >& labels) const
+    {
+        const std::size_t c = m_cyclic.size();
+        std::vector< Vertex > low(c, 0), post(c, 0);
+        labels.resize(3 * c);
+        boost::minstd_rand gen(static_cast< boost::uint32_t >(i + 1));
+        std::vector< std::size_t > roots(c);
+        for (std::size_t k = 0; k < c; ++k)
+            roots[k] = k;
+        for (std::size_t k = c; k > 1; --k)
+            std::swap(roots[k - 1],
+                roots[random::uniform_int_distribution< std::size_t >(
+                    0, k - 1)(gen)]);
+
+        // Each component on the stack with the offset at which its
+        // successors start, the number of them taken and the last
+        // postorder number before its subtree
+        struct frame
+        {
+            std::size_t component, offset, taken;
+            Vertex entry;
+        };
+        std::vector< frame > stack;
+        Vertex count = 0;
+        for (std::size_t r = 0; r < c; ++r)
+        {
+            if (post[roots[r]] != 0)
+                continue;
+            frame root = { roots[r], 0, 0, count };
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                frame& top = stack.back();
+                std::size_t first = m_successor_start[top.component];
+                std::size_t degree
+                    = m_successor_start[top.component + 1] - first;
+                if (top.taken == 0 && degree > 1)
+                    top.offset = random::uniform_int_distribution<
+                        std::size_t >(0, degree - 1)(gen);
+                if (top.taken == degree)
+                {
+                    std::size_t k = top.component;
+                    post[k] = ++count;
+                    low[k] = post[k];
+                    for (std::size_t j = first; j < first + degree; ++j)
+                        low[k] = (std::min)(low[k], low[m_successors[j]]);
+                    labels[3 * k] = low[k];
+                    labels[3 * k + 1] = top.entry + 1;
+                    labels[3 * k + 2] = post[k];
+                    stack.pop_back();
+                    continue;
+                }
+                std::size_t s = m_successors[first
+                    + (top.offset + top.taken++) % degree];
+                if (post[s] == 0 && low[s] == 0)
+                {
+                    // Marks s as on the stack
+                    low[s] = 1;
+                    frame next = { s, 0, 0, count };
+                    stack.push_back(next);
+                }
+            }
+        }
+    }
+
+    std::size_t m_num_intervals;
+    std::vector< Vertex > m_component;
+    std::vector< char > m_cyclic;
+    std::vector< std::size_t > m_successor_start;
+    std::vector< Vertex > m_successors;
+    // The low, subtree and post numbers of the labelings, by component
+    std::vector< Vertex > m_labels;
+};
+
+/** Reachability queries on a reachability_index.
+ *
+ * reachable(u, v) tells whether there is a path of at least one edge from
+ * u to v.  The searches that the labels do not settle mark the components
+ * they visit with a number that changes at every query, so a query object
+ * should be reused, and each thread needs its own.
+ */
+template < typename Vertex = std::size_t >
+class reachability_index_query : boost::noncopyable
+{
+public:
+    typedef reachability_index< Vertex > index_type;
+
+    explicit reachability_index_query(const index_type& index)
+    : m_index(index), m_mark(index.num_components(), 0), m_search(0)
+    {
+    }
+
+    bool reachable(Vertex u, Vertex v)
+    {
+        Vertex cu = m_index.component(u), cv = m_index.component(v);
+        if (cu == cv)
+            return m_index.cyclic(cu);
+        if (cv < cu || !m_index.contains(cu, cv))
+            return false;
+        if (m_index.spans(cu, cv))
+            return true;
+
+        if (++m_search == 0)
+        {
+            std::fill(m_mark.begin(), m_mark.end(), 0);
+            m_search = 1;
+        }
+        m_stack.clear();
+        m_stack.push_back(cu);
+        while (!m_stack.empty())
+        {
+            Vertex c = m_stack.back();
+            m_stack.pop_back();
+            std::pair< const Vertex*, const Vertex* > s
+                = m_index.successors(c);
+            for (; s.first != s.second; ++s.first)
+            {
+                Vertex d = *s.first;
+                if (d == cv)
+                    return true;
+                if (d > cv || m_mark[d] == m_search
+                    || !m_index.contains(d, cv))
+                    continue;
+                if (m_index.spans(d, cv))
+                    return true;
+                m_mark[d] = m_search;
+                m_stack.push_back(d);
+            }
+        }
+        return false;
+    }
+
+private:
+    const index_type& m_index;
+    std::vector< std::size_t > m_mark;
+    std::size_t m_search;
+    std::vector< Vertex > m_stack;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_REACHABILITY_INDEX_HPP
@@ -0,0 +1,252 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_SEARCH_WORKSPACE_HPP
+#define BOOST_GRAPH_SEARCH_WORKSPACE_HPP
+
+/*
+  Reusable labels and queues for repeated graph searches.
+
+  A search_workspace owns the distance, cost, predecessor, color and
+  index-in-heap labels of every vertex, together with the priority queues
+  and the FIFO queue of the searches, so that breadth_first_visit,
+  dijkstra_shortest_paths_no_init and astar_search_no_init can be run many
+  times without allocating or initializing anything of size
+  num_vertices(g).  Each label carries the number of the query that last
+  touched it; new_query() increments the current number, which makes all
+  labels read as initialized (infinite distance and cost, the vertex
+  itself as predecessor, white, not in a queue) until they are first
+  accessed.  A query therefore costs time proportional to the number of
+  vertices it touches.
+*/
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/property_map/property_map.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Lvalue property map onto one of the labels of a search_workspace
+    template < typename Workspace, typename Value >
+    class search_workspace_map
+    : public put_get_helper< Value&, search_workspace_map< Workspace, Value > >
+    {
+    public:
+        typedef typename Workspace::vertex_descriptor key_type;
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef lvalue_property_map_tag category;
+        typedef typename Workspace::label label;
+
+        search_workspace_map(Workspace* workspace, Value label::*member)
+        : m_workspace(workspace), m_member(member)
+        {
+        }
+
+        Value& operator[](key_type v) const
+        {
+            return m_workspace->label_of(v).*m_member;
+        }
+
+    private:
+        Workspace* m_workspace;
+        Value label::*m_member;
+    };
+
+    // FIFO queue on a vector that keeps its storage once emptied, as the
+    // Buffer of breadth_first_visit
+    template < typename Value > class search_workspace_fifo
+    {
+    public:
+        search_workspace_fifo() : m_head(0) {}
+
+        bool empty() const { return m_head == m_data.size(); }
+
+        std::size_t size() const { return m_data.size() - m_head; }
+
+        void push(const Value& v) { m_data.push_back(v); }
+
+        Value& top() { return m_data[m_head]; }
+
+        const Value& top() const { return m_data[m_head]; }
+
+        void pop()
+        {
+            if (++m_head == m_data.size())
+                clear();
+        }
+
+        void clear()
+        {
+            m_data.clear();
+            m_head = 0;
+        }
+
+    private:
+        std::vector< Value > m_data;
+        std::size_t m_head;
+    };
+}
+
+/** Labels and queues shared by a sequence of searches on a graph.
+ *
+ * Distance is the type of distances and costs.  The property maps
+ * returned by the workspace stay valid for its lifetime and only describe
+ * the current query.  A workspace is not copyable, and should be used by
+ * one thread at a time.
+ */
+template < typename Graph, typename Distance,
+    typename VertexIndexMap =
+        typename property_map< Graph, vertex_index_t >::const_type >
+class search_workspace : boost::noncopyable
+{
+public:
+    typedef typename graph_traits< Graph >::vertex_descriptor
+        vertex_descriptor;
+    typedef Distance distance_type;
+
+    // Labels of a vertex, valid if version is the current query
+    struct label
+    {
+        Distance distance;
+        Distance cost;
+        vertex_descriptor predecessor;
+        std::size_t index_in_heap;
+        default_color_type color;
+        unsigned version;
+    };
+
+    typedef detail::search_workspace_map< search_workspace, Distance >
+        distance_map_type;
+    typedef distance_map_type cost_map_type;
+    typedef detail::search_workspace_map< search_workspace,
+        vertex_descriptor >
+        predecessor_map_type;
+    typedef detail::search_workspace_map< search_workspace,
+        default_color_type >
+        color_map_type;
+    typedef detail::search_workspace_map< search_workspace, std::size_t >
+        index_in_heap_map_type;
+    typedef d_ary_heap_indirect< vertex_descriptor, 4, index_in_heap_map_type,
+        distance_map_type, std::less< Distance > >
+        queue_type;
+    typedef detail::search_workspace_fifo< vertex_descriptor > buffer_type;
+
+    explicit search_workspace(const Graph& g)
+    : m_labels(num_vertices(g))
+    , m_version(1)
+    , m_index(get(vertex_index, g))
+    , m_distance_queue(distance_map(), index_in_heap_map())
+    , m_cost_queue(cost_map(), index_in_heap_map())
+    {
+        init_labels();
+    }
+
+    search_workspace(const Graph& g, VertexIndexMap index)
+    : m_labels(num_vertices(g))
+    , m_version(1)
+    , m_index(index)
+    , m_distance_queue(distance_map(), index_in_heap_map())
+    , m_cost_queue(cost_map(), index_in_heap_map())
+    {
+        init_labels();
+    }
+
+    // Start a new query: every label reads as initialized again.  Queues
+    // left non-empty by a search that was stopped early are emptied.
+    void new_query()
+    {
+        while (!m_distance_queue.empty())
+            m_distance_queue.pop();
+        while (!m_cost_queue.empty())
+            m_cost_queue.pop();
+        m_buffer.clear();
+        if (++m_version == 0)
+        {
+            // All versions have been used: clear the labels once
+            init_labels();
+            m_version = 1;
+        }
+    }
+
+    // Whether the labels of v were accessed during the current query
+    bool touched(vertex_descriptor v) const
+    {
+        return m_labels[get(m_index, v)].version == m_version;
+    }
+
+    // Labels of v, initialized first if they belong to an earlier query
+    label& label_of(vertex_descriptor v)
+    {
+        label& l = m_labels[get(m_index, v)];
+        if (l.version != m_version)
+        {
+            l.distance = (std::numeric_limits< Distance >::max)();
+            l.cost = (std::numeric_limits< Distance >::max)();
+            l.predecessor = v;
+            l.index_in_heap = std::size_t(-1);
+            l.color = white_color;
+            l.version = m_version;
+        }
+        return l;
+    }
+
+    distance_map_type distance_map()
+    {
+        return distance_map_type(this, &label::distance);
+    }
+
+    cost_map_type cost_map() { return cost_map_type(this, &label::cost); }
+
+    predecessor_map_type predecessor_map()
+    {
+        return predecessor_map_type(this, &label::predecessor);
+    }
+
+    color_map_type color_map() { return color_map_type(this, &label::color); }
+
+    index_in_heap_map_type index_in_heap_map()
+    {
+        return index_in_heap_map_type(this, &label::index_in_heap);
+    }
+
+    // Queue keyed by distance_map(), as used by Dijkstra's algorithm
+    queue_type& distance_queue() { return m_distance_queue; }
+
+    // Queue keyed by cost_map(), as used by A* search
+    queue_type& cost_queue() { return m_cost_queue; }
+
+    // FIFO queue for breadth-first search
+    buffer_type& buffer() { return m_buffer; }
+
+private:
+    void init_labels()
+    {
+        for (std::size_t i = 0; i < m_labels.size(); ++i)
+            m_labels[i].version = 0;
+    }
+
+    std::vector< label > m_labels;
+    unsigned m_version;
+    VertexIndexMap m_index;
+    queue_type m_distance_queue;
+    queue_type m_cost_queue;
+    buffer_type m_buffer;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_SEARCH_WORKSPACE_HPP
@@ -0,0 +1,396 @@
+// Copyright 2026
+
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GRAPH_TRIANGLE_COUNTING_HPP
+#define BOOST_GRAPH_TRIANGLE_COUNTING_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/detail/thread_pool.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    /**
+     * The simple undirected graph underlying a graph, without edge
+     * directions, self-loops and parallel edges, with its edges oriented
+     * from each vertex to the neighbors that come after it in the order
+     * of increasing degree (ties broken by vertex index). Every vertex
+     * then has O(sqrt(E)) out-neighbors, however large its degree.
+     * Vertices are numbered by their position in that order.
+     */
+    class degree_oriented_graph
+    {
+    public:
+        template < typename Graph, typename VertexIndexMap >
+        degree_oriented_graph(const Graph& g, VertexIndexMap vertex_index,
+            graph::detail::thread_pool& pool)
+        {
+            typedef typename graph_traits< Graph >::vertex_iterator
+                vertex_iterator;
+            typedef typename graph_traits< Graph >::out_edge_iterator
+                out_edge_iterator;
+
+            const std::size_t n = num_vertices(g);
+
+            // Neighbors in both directions, with duplicates
+            std::vector< std::size_t > start(n + 1, 0);
+            vertex_iterator u, u_end;
+            out_edge_iterator e, e_end;
+            for (boost::tie(u, u_end) = vertices(g); u != u_end; ++u)
+            {
+                std::size_t iu = get(vertex_index, *u);
+                for (boost::tie(e, e_end) = out_edges(*u, g); e != e_end; ++e)
+                {
+                    std::size_t iv = get(vertex_index, target(*e, g));
+                    if (iu != iv)
+                    {
+                        ++start[iu + 1];
+                        ++start[iv + 1];
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < n; ++i)
+                start[i + 1] += start[i];
+            std::vector< std::size_t > neighbors(start[n]);
+            std::vector< std::size_t > next(start.begin(), start.end() - 1);
+            for (boost::tie(u, u_end) = vertices(g); u != u_end; ++u)
+            {
+                std::size_t iu = get(vertex_index, *u);
+                for (boost::tie(e, e_end) = out_edges(*u, g); e != e_end; ++e)
+                {
+                    std::size_t iv = get(vertex_index, target(*e, g));
+                    if (iu != iv)
+                    {
+                        neighbors[next[iu]++] = iv;
+                        neighbors[next[iv]++] = iu;
+                    }
+                }
+            }
+
+            // Distinct neighbors, at the start of each row
+            m_degree.resize(n);
+            pool.for_each_block(n,
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        std::size_t* row = neighbors.data() + start[i];
+                        std::size_t* row_end = neighbors.data() + start[i + 1];
+                        std::sort(row, row_end);
+                        m_degree[i] = std::unique(row, row_end) - row;
+                    }
+                });
+
+            m_index_of.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                m_index_of[i] = i;
+            std::sort(
+                m_index_of.begin(), m_index_of.end(), by_degree(m_degree));
+            m_position.resize(n);
+            for (std::size_t p = 0; p < n; ++p)
+                m_position[m_index_of[p]] = p;
+
+            // Keep the neighbors that come later
+            m_row_start.assign(n + 1, 0);
+            for (std::size_t p = 0; p < n; ++p)
+            {
+                std::size_t i = m_index_of[p];
+                std::size_t later = 0;
+                for (std::size_t k = start[i]; k < start[i] + m_degree[i]; ++k)
+                    if (m_position[neighbors[k]] > p)
+                        ++later;
+                m_row_start[p + 1] = m_row_start[p] + later;
+            }
+            m_targets.resize(m_row_start[n]);
+            pool.for_each_block(n,
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t p = first; p < last; ++p)
+                    {
+                        std::size_t i = m_index_of[p];
+                        std::size_t out = m_row_start[p];
+                        for (std::size_t k = start[i];
+                             k < start[i] + m_degree[i]; ++k)
+                            if (m_position[neighbors[k]] > p)
+                                m_targets[out++] = m_position[neighbors[k]];
+                    }
+                });
+        }
+
+        std::size_t size() const { return m_index_of.size(); }
+
+        /// Number of distinct neighbors of the vertex of index i
+        std::size_t degree(std::size_t i) const { return m_degree[i]; }
+
+        /// Vertex index of the p-th vertex in degree order
+        std::size_t index_of(std::size_t p) const { return m_index_of[p]; }
+
+        const std::size_t* begin(std::size_t p) const
+        {
+            return m_targets.empty() ? 0 : &m_targets[0] + m_row_start[p];
+        }
+
+        const std::size_t* end(std::size_t p) const
+        {
+            return m_targets.empty() ? 0 : &m_targets[0] + m_row_start[p + 1];
+        }
+
+    private:
+        struct by_degree
+        {
+            explicit by_degree(const std::vector< std::size_t >& degree)
+            : degree(&degree)
+            {
+            }
+
+            bool operator()(std::size_t i, std::size_t j) const
+            {
+                return (*degree)[i] < (*degree)[j]
+                    || ((*degree)[i] == (*degree)[j] && i < j);
+            }
+
+            const std::vector< std::size_t >* degree;
+        };
+
+        std::vector< std::size_t > m_degree;
+        std::vector< std::size_t > m_index_of;
+        std::vector< std::size_t > m_position;
+        std::vector< std::size_t > m_row_start;
+        std::vector< std::size_t > m_targets;
+    };
+
+    /**
+     * Calls f(p, q, r) for every triangle p < q < r of the vertices in
+     * [first, last) of the degree oriented graph, intersecting the
+     * out-neighbors of p, marked with p, with those of each q.
+     */
+    template < typename Function >
+    void for_each_oriented_triangle(const degree_oriented_graph& og,
+        std::size_t first, std::size_t last, std::vector< std::size_t >& mark,
+        Function f)
+    {
+        for (std::size_t p = first; p < last; ++p)
+        {
+            for (const std::size_t* q = og.begin(p); q != og.end(p); ++q)
+                mark[*q] = p;
+            for (const std::size_t* q = og.begin(p); q != og.end(p); ++q)
+                for (const std::size_t* r = og.begin(*q); r != og.end(*q);
+                     ++r)
+                    if (mark[*r] == p)
+                        f(p, *q, *r);
+        }
+    }
+
+    struct count_oriented_triangles
+    {
+        count_oriented_triangles(std::atomic< std::size_t >* count,
+            std::size_t& local)
+        : count(count), local(&local)
+        {
+        }
+
+        void operator()(std::size_t p, std::size_t q, std::size_t r) const
+        {
+            count[p].fetch_add(1, std::memory_order_relaxed);
+            count[q].fetch_add(1, std::memory_order_relaxed);
+            count[r].fetch_add(1, std::memory_order_relaxed);
+            ++*local;
+        }
+
+        std::atomic< std::size_t >* count;
+        std::size_t* local;
+    };
+
+    template < typename Graph, typename VertexIndexMap, typename Visitor >
+    struct list_oriented_triangles
+    {
+        list_oriented_triangles(const degree_oriented_graph& og,
+            const std::vector<
+                typename graph_traits< Graph >::vertex_descriptor >& vertex_of,
+            Visitor& vis)
+        : og(&og), vertex_of(&vertex_of), vis(&vis)
+        {
+        }
+
+        void operator()(std::size_t p, std::size_t q, std::size_t r) const
+        {
+            (*vis)((*vertex_of)[og->index_of(p)],
+                (*vertex_of)[og->index_of(q)], (*vertex_of)[og->index_of(r)]);
+        }
+
+        const degree_oriented_graph* og;
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >*
+            vertex_of;
+        Visitor* vis;
+    };
+
+    /**
+     * Counts the triangles on every vertex with num_threads threads,
+     * which take blocks of vertices in degree order from a shared
+     * counter, and returns the total number of triangles. Writes the
+     * count and the number of distinct neighbors of each vertex, by
+     * vertex index, to triangles and degree.
+     */
+    template < typename Graph, typename VertexIndexMap >
+    std::size_t count_triangles_impl(const Graph& g,
+        VertexIndexMap vertex_index, std::size_t num_threads,
+        std::vector< std::size_t >& triangles,
+        std::vector< std::size_t >& degree)
+    {
+        graph::detail::thread_pool pool(num_threads);
+        degree_oriented_graph og(g, vertex_index, pool);
+        const std::size_t n = og.size();
+
+        std::unique_ptr< std::atomic< std::size_t >[] > count(
+            new std::atomic< std::size_t >[n]);
+        for (std::size_t p = 0; p < n; ++p)
+            count[p].store(0, std::memory_order_relaxed);
+        std::vector< std::size_t > totals(pool.size(), 0);
+        std::atomic< std::size_t > next_block(0);
+        const std::size_t block_size = 64;
+        pool.run([&](std::size_t thread) {
+            std::vector< std::size_t > mark(n, n);
+            count_oriented_triangles counter(count.get(), totals[thread]);
+            for (;;)
+            {
+                std::size_t first = next_block.fetch_add(block_size);
+                if (first >= n)
+                    break;
+                for_each_oriented_triangle(og, first,
+                    (std::min)(n, first + block_size), mark, counter);
+            }
+        });
+
+        triangles.resize(n);
+        degree.resize(n);
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            triangles[og.index_of(p)] = count[p].load();
+            degree[og.index_of(p)] = og.degree(og.index_of(p));
+        }
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < totals.size(); ++i)
+            total += totals[i];
+        return total;
+    }
+} // end namespace detail
+
+/**
+ * Counts the triangles of a graph, ignoring edge directions, self-loops
+ * and parallel edges, by orienting the edges in the order of increasing
+ * degree and intersecting the out-neighbors of both ends of each
+ * oriented edge. Writes the number of triangles that contain each vertex
+ * to the triangle map, and returns the number of triangles.
+ */
+template < typename Graph, typename TriangleCountMap, typename VertexIndexMap >
+std::size_t count_triangles(const Graph& g, TriangleCountMap triangles,
+    VertexIndexMap vertex_index, std::size_t num_threads)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+    typedef typename property_traits< TriangleCountMap >::value_type count_type;
+
+    std::vector< std::size_t > count, degree;
+    std::size_t total = detail::count_triangles_impl(
+        g, vertex_index, num_threads, count, degree);
+    typename graph_traits< Graph >::vertex_iterator v, v_end;
+    for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+        put(triangles, *v, count_type(count[get(vertex_index, *v)]));
+    return total;
+}
+
+template < typename Graph, typename TriangleCountMap >
+std::size_t count_triangles(
+    const Graph& g, TriangleCountMap triangles, std::size_t num_threads = 0)
+{
+    return count_triangles(g, triangles, get(vertex_index, g), num_threads);
+}
+
+/**
+ * Calls vis(u, v, w) once for every triangle of a graph, ignoring edge
+ * directions, self-loops and parallel edges, in a single thread.
+ */
+template < typename Graph, typename TriangleVisitor, typename VertexIndexMap >
+void list_triangles(
+    const Graph& g, TriangleVisitor vis, VertexIndexMap vertex_index)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+
+    graph::detail::thread_pool pool(1);
+    detail::degree_oriented_graph og(g, vertex_index, pool);
+    std::vector< typename graph_traits< Graph >::vertex_descriptor > vertex_of(
+        og.size());
+    typename graph_traits< Graph >::vertex_iterator v, v_end;
+    for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+        vertex_of[get(vertex_index, *v)] = *v;
+
+    std::vector< std::size_t > mark(og.size(), og.size());
+    detail::for_each_oriented_triangle(og, 0, og.size(), mark,
+        detail::list_oriented_triangles< Graph, VertexIndexMap,
+            TriangleVisitor >(og, vertex_of, vis));
+}
+
+template < typename Graph, typename TriangleVisitor >
+void list_triangles(const Graph& g, TriangleVisitor vis)
+{
+    list_triangles(g, vis, get(vertex_index, g));
+}
+
+/**
+ * Computes the clustering coefficient of every vertex of an undirected
+ * graph from the triangle counts of count_triangles, with num_threads
+ * threads, and returns their mean, or 0 for a graph without vertices.
+ * Gives the same coefficients as all_clustering_coefficients(g, cm) on
+ * graphs without self-loops and parallel edges, which are ignored.
+ */
+template < typename Graph, typename ClusteringMap >
+typename property_traits< ClusteringMap >::value_type
+all_clustering_coefficients(
+    const Graph& g, ClusteringMap cm, std::size_t num_threads)
+{
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+    typedef typename graph_traits< Graph >::directed_category directed_category;
+    BOOST_STATIC_ASSERT(
+        (is_convertible< directed_category*, undirected_tag* >::value));
+    typedef typename property_traits< ClusteringMap >::value_type Coefficient;
+
+    typename property_map< Graph, vertex_index_t >::const_type index
+        = get(vertex_index, g);
+    std::vector< std::size_t > count, degree;
+    detail::count_triangles_impl(g, index, num_threads, count, degree);
+
+    Coefficient sum(0);
+    typename graph_traits< Graph >::vertex_iterator v, v_end;
+    for (boost::tie(v, v_end) = vertices(g); v != v_end; ++v)
+    {
+        std::size_t i = get(index, *v);
+        Coefficient cc(0);
+        if (degree[i] >= 2)
+            cc = Coefficient(count[i])
+                / Coefficient(degree[i] * (degree[i] - 1) / 2);
+        put(cm, *v, cc);
+        sum += cc;
+    }
+    if (num_vertices(g) == 0)
+        return Coefficient(0);
+    return sum / Coefficient(num_vertices(g));
+}
+
+} // end namespace boost
+
+#endif // BOOST_GRAPH_TRIANGLE_COUNTING_HPP
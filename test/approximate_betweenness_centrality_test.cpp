@@ -0,0 +1,197 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check that approximate_betweenness_centrality stays within its error
+// bound of brandes_betweenness_centrality, for vertex and edge centralities
+// on unweighted and weighted random graphs, and that the betweenness
+// centrality clustering finds the bridge between two cliques with it.
+
+#include <boost/graph/bc_clustering.hpp>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <vector>
+
+typedef boost::property< boost::edge_weight_t, double,
+    boost::property< boost::edge_index_t, std::size_t > >
+    EdgeProperties;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, EdgeProperties >
+    Digraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, EdgeProperties >
+    Graph;
+
+void check_within(const std::vector< double >& expected,
+    const std::vector< double >& actual, double error)
+{
+    BOOST_TEST_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        BOOST_TEST(std::abs(expected[i] - actual[i]) <= error);
+}
+
+template < typename G > void check_graph(const G& g, int seed)
+{
+    typedef typename boost::property_map< G, boost::vertex_index_t >::const_type
+        VertexIndexMap;
+    typedef typename boost::property_map< G, boost::edge_index_t >::const_type
+        EdgeIndexMap;
+    typedef boost::iterator_property_map< std::vector< double >::iterator,
+        VertexIndexMap >
+        CentralityMap;
+    typedef boost::iterator_property_map< std::vector< double >::iterator,
+        EdgeIndexMap >
+        EdgeCentralityMap;
+    typedef typename boost::graph_traits< G >::directed_category
+        directed_category;
+    const bool is_undirected = boost::is_convertible< directed_category*,
+        boost::undirected_tag* >::value;
+
+    std::size_t n = num_vertices(g), m = num_edges(g);
+    VertexIndexMap vertex_index = get(boost::vertex_index, g);
+    EdgeIndexMap edge_index = get(boost::edge_index, g);
+    double pairs = double(n) * double(n - 1) / (is_undirected ? 2.0 : 1.0);
+    boost::minstd_rand gen(seed);
+
+    for (int weighted = 0; weighted < 2; ++weighted)
+    {
+        std::vector< double > centrality(n), edge_centrality(m);
+        CentralityMap c(centrality.begin(), vertex_index);
+        EdgeCentralityMap ec(edge_centrality.begin(), edge_index);
+        if (weighted)
+            brandes_betweenness_centrality(g,
+                boost::centrality_map(c).edge_centrality_map(ec).weight_map(
+                    get(boost::edge_weight, g)));
+        else
+            brandes_betweenness_centrality(g, c, ec);
+
+        const double epsilon = 0.02, delta = 0.1;
+        std::vector< double > approximate(n, -1.0),
+            approximate_edge(m, -1.0);
+        CentralityMap ac(approximate.begin(), vertex_index);
+        EdgeCentralityMap aec(approximate_edge.begin(), edge_index);
+        std::size_t samples;
+        if (weighted)
+            samples = boost::approximate_betweenness_centrality(g, epsilon,
+                delta, gen,
+                boost::centrality_map(ac).edge_centrality_map(aec).weight_map(
+                    get(boost::edge_weight, g)));
+        else
+            samples = boost::approximate_betweenness_centrality(g, epsilon,
+                delta, gen,
+                boost::centrality_map(ac).edge_centrality_map(aec));
+        BOOST_TEST(n < 2 || samples > 0);
+        BOOST_TEST(samples
+            <= boost::detail::graph::approximate_betweenness_sample_size(
+                n, epsilon, delta / 2));
+        check_within(centrality, approximate, epsilon * pairs);
+        check_within(edge_centrality, approximate_edge, epsilon * pairs);
+
+        // Vertex centrality only
+        if (!weighted)
+        {
+            std::vector< double > vertex_only(n, -1.0);
+            boost::approximate_betweenness_centrality(g,
+                CentralityMap(vertex_only.begin(), vertex_index), epsilon,
+                delta, gen);
+            check_within(centrality, vertex_only, epsilon * pairs);
+        }
+    }
+}
+
+template < typename G > void index_and_weigh(G& g)
+{
+    std::size_t i = 0;
+    BGL_FORALL_EDGES_T(e, g, G)
+    {
+        put(boost::edge_index, g, e, i++);
+        put(boost::edge_weight, g, e, double(1 + i % 3));
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph dg(ERGen(gen, n, p), ERGen(), n);
+    index_and_weigh(dg);
+    check_graph(dg, seed);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > UERGen;
+    Graph ug(UERGen(gen, n, p), UERGen(), n);
+    index_and_weigh(ug);
+    check_graph(ug, seed);
+}
+
+// Two cliques of k vertices joined by the edge (0, k)
+Graph make_barbell(std::size_t k)
+{
+    Graph g(2 * k);
+    for (std::size_t half = 0; half < 2; ++half)
+        for (std::size_t i = 0; i < k; ++i)
+            for (std::size_t j = i + 1; j < k; ++j)
+                add_edge(half * k + i, half * k + j, g);
+    add_edge(0, k, g);
+    index_and_weigh(g);
+    return g;
+}
+
+// Stops after the first edge found and records it
+struct first_edge
+{
+    typedef double centrality_type;
+
+    first_edge(Graph::edge_descriptor& e) : e(&e) {}
+
+    bool operator()(double, Graph::edge_descriptor found, const Graph&)
+    {
+        *e = found;
+        return true;
+    }
+
+    Graph::edge_descriptor* e;
+};
+
+void check_clustering()
+{
+    Graph g = make_barbell(8);
+    std::vector< double > edge_centrality(num_edges(g));
+    boost::minstd_rand gen(7);
+    Graph::edge_descriptor bridge;
+    boost::betweenness_centrality_clustering(g, first_edge(bridge),
+        boost::make_iterator_property_map(
+            edge_centrality.begin(), get(boost::edge_index, g)),
+        get(boost::vertex_index, g),
+        boost::make_approximate_edge_betweenness(0.05, 0.1, gen));
+    BOOST_TEST_EQ((std::min)(source(bridge, g), target(bridge, g)), 0u);
+    BOOST_TEST_EQ((std::max)(source(bridge, g), target(bridge, g)), 8u);
+
+    // Removing edges until the bridge is gone splits the barbell
+    boost::betweenness_centrality_clustering(g,
+        boost::bc_clustering_threshold< double >(0.3, g),
+        boost::make_iterator_property_map(
+            edge_centrality.begin(), get(boost::edge_index, g)),
+        get(boost::vertex_index, g),
+        boost::make_approximate_edge_betweenness(0.05, 0.1, gen));
+    BOOST_TEST(!edge(0, 8, g).second);
+    BOOST_TEST_EQ(num_edges(g), 56u);
+}
+
+int main()
+{
+    check_random_graphs(2, 1, 1);
+    check_random_graphs(30, 90, 2);
+    check_random_graphs(200, 800, 3);
+    check_random_graphs(300, 300, 4);
+    check_clustering();
+    return boost::report_errors();
+}
@@ -0,0 +1,129 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check array_push_relabel_max_flow against edmonds_karp_max_flow on random
+// graphs, for both strategies with and without the heuristics, and check
+// that the residual capacities it leaves are those of a flow.
+
+#include <boost/graph/array_push_relabel_max_flow.hpp>
+#include <boost/graph/edmonds_karp_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+typedef boost::adjacency_list_traits< boost::vecS, boost::vecS,
+    boost::directedS >
+    Traits;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property,
+    boost::property< boost::edge_capacity_t, long,
+        boost::property< boost::edge_residual_capacity_t, long,
+            boost::property< boost::edge_reverse_t,
+                Traits::edge_descriptor > > > >
+    Graph;
+typedef boost::graph_traits< Graph >::edge_descriptor Edge;
+
+void add_arc(Graph& g, std::size_t u, std::size_t v, long capacity)
+{
+    Edge e = add_edge(u, v, g).first, r = add_edge(v, u, g).first;
+    put(boost::edge_capacity, g, e, capacity);
+    put(boost::edge_capacity, g, r, 0);
+    put(boost::edge_reverse, g, e, r);
+    put(boost::edge_reverse, g, r, e);
+}
+
+// The net flow into each vertex, which must be zero but at s and t
+void check_flow(const Graph& g, std::size_t s, std::size_t t, long flow)
+{
+    std::vector< long > balance(num_vertices(g), 0);
+    Graph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+    {
+        long residual = get(boost::edge_residual_capacity, g, *e);
+        long capacity = get(boost::edge_capacity, g, *e);
+        BOOST_TEST(residual >= 0);
+        BOOST_TEST(residual
+                + get(boost::edge_residual_capacity, g,
+                    get(boost::edge_reverse, g, *e))
+            == capacity
+                + get(boost::edge_capacity, g,
+                    get(boost::edge_reverse, g, *e)));
+        if (capacity > 0)
+        {
+            balance[source(*e, g)] -= capacity - residual;
+            balance[target(*e, g)] += capacity - residual;
+        }
+    }
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+        if (v != s && v != t)
+            BOOST_TEST_EQ(balance[v], 0);
+    BOOST_TEST_EQ(balance[t], flow);
+}
+
+void check_random_graph(std::size_t n, std::size_t m, long max_capacity,
+    int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    boost::random::uniform_int_distribution< long > capacity(
+        0, max_capacity);
+    Graph g(n);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        std::size_t u = vertex(gen), v = vertex(gen);
+        add_arc(g, u, v, capacity(gen));
+    }
+    const std::size_t s = 0, t = n - 1;
+    long expected = boost::edmonds_karp_max_flow(g, s, t);
+
+    const boost::push_relabel_options::strategy_type strategies[]
+        = { boost::push_relabel_options::highest_label,
+              boost::push_relabel_options::fifo };
+    const double frequencies[] = { 0.0, 0.5, 4.0 };
+    for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 3; ++j)
+            for (int gap = 0; gap < 2; ++gap)
+            {
+                long flow = boost::array_push_relabel_max_flow(g, s, t,
+                    boost::push_relabel_options(
+                        strategies[i], frequencies[j], gap != 0));
+                BOOST_TEST_EQ(flow, expected);
+                check_flow(g, s, t, flow);
+            }
+}
+
+int main()
+{
+    for (int seed = 1; seed <= 50; ++seed)
+    {
+        check_random_graph(10, 30, 10, seed);
+        check_random_graph(40, 150, 100, seed);
+    }
+    check_random_graph(300, 1500, 1000, 51);
+    check_random_graph(1000, 3000, 5, 52);
+
+    // Excess that cannot reach the sink goes back to the source, around a
+    // cycle and past a self-loop
+    Graph g(6);
+    add_arc(g, 0, 1, 10);
+    add_arc(g, 1, 2, 8);
+    add_arc(g, 2, 1, 8);
+    add_arc(g, 2, 2, 5);
+    add_arc(g, 2, 3, 7);
+    add_arc(g, 3, 5, 2);
+    add_arc(g, 1, 4, 1);
+    long flow = boost::array_push_relabel_max_flow(g, 0, 5);
+    BOOST_TEST_EQ(flow, 2);
+    check_flow(g, 0, 5, flow);
+    BOOST_TEST_EQ(boost::array_push_relabel_max_flow(g, 0, 4,
+                      boost::push_relabel_options(
+                          boost::push_relabel_options::fifo)),
+        1);
+
+    return boost::report_errors();
+}
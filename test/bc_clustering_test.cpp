@@ -0,0 +1,160 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check that the incremental betweenness centrality clustering removes
+// exactly the same edges, and leaves exactly the same edge centralities,
+// as the clustering that recomputes brandes_betweenness_centrality at
+// every step, on directed and undirected random graphs.
+
+#include <boost/graph/bc_clustering.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+#include <vector>
+
+typedef boost::property< boost::edge_index_t, std::size_t > EdgeProperties;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, EdgeProperties >
+    Digraph;
+typedef boost::adjacency_list< boost::listS, boost::vecS, boost::undirectedS,
+    boost::no_property, EdgeProperties >
+    Graph;
+
+struct removal
+{
+    std::size_t source, target;
+    double centrality;
+};
+
+// Records the edges found and stops after a number of steps
+template < typename G > struct record_steps
+{
+    typedef double centrality_type;
+
+    record_steps(std::vector< removal >& steps, std::size_t max_steps)
+    : steps(&steps), max_steps(max_steps)
+    {
+    }
+
+    bool operator()(double centrality,
+        typename boost::graph_traits< G >::edge_descriptor e, const G& g)
+    {
+        removal r = { source(e, g), target(e, g), centrality };
+        steps->push_back(r);
+        return steps->size() > max_steps;
+    }
+
+    std::vector< removal >* steps;
+    std::size_t max_steps;
+};
+
+template < typename G >
+std::vector< double > edge_centralities(
+    const G& g, const std::vector< double >& c)
+{
+    std::vector< double > result;
+    BGL_FORALL_EDGES_T(e, g, G)
+    {
+        result.push_back(c[get(boost::edge_index, g, e)]);
+    }
+    return result;
+}
+
+template < typename G > void check_graph(const G& original, std::size_t steps)
+{
+    std::size_t m = num_edges(original);
+    G full(original), incremental(original);
+    std::vector< removal > full_steps, incremental_steps;
+    std::vector< double > full_centrality(m), incremental_centrality(m);
+
+    boost::betweenness_centrality_clustering(full,
+        record_steps< G >(full_steps, steps),
+        boost::make_iterator_property_map(
+            full_centrality.begin(), get(boost::edge_index, full)),
+        get(boost::vertex_index, full), boost::brandes_edge_betweenness());
+    boost::betweenness_centrality_clustering(incremental,
+        record_steps< G >(incremental_steps, steps),
+        boost::make_iterator_property_map(incremental_centrality.begin(),
+            get(boost::edge_index, incremental)));
+
+    BOOST_TEST_EQ(full_steps.size(), incremental_steps.size());
+    for (std::size_t i = 0;
+         i < full_steps.size() && i < incremental_steps.size(); ++i)
+    {
+        BOOST_TEST_EQ(full_steps[i].source, incremental_steps[i].source);
+        BOOST_TEST_EQ(full_steps[i].target, incremental_steps[i].target);
+        // Bitwise equal, not only close
+        BOOST_TEST(full_steps[i].centrality == incremental_steps[i].centrality);
+    }
+    BOOST_TEST_EQ(num_edges(full), num_edges(incremental));
+    std::vector< double > full_final = edge_centralities(full, full_centrality);
+    std::vector< double > incremental_final
+        = edge_centralities(incremental, incremental_centrality);
+    BOOST_TEST(full_final == incremental_final);
+}
+
+template < typename G > void index_edges(G& g)
+{
+    std::size_t i = 0;
+    BGL_FORALL_EDGES_T(e, g, G)
+    {
+        put(boost::edge_index, g, e, i++);
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph dg(ERGen(gen, n, p), ERGen(), n);
+    index_edges(dg);
+    check_graph(dg, 10);
+    check_graph(dg, num_edges(dg));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > UERGen;
+    Graph ug(UERGen(gen, n, p), UERGen(), n);
+    index_edges(ug);
+    check_graph(ug, 10);
+    check_graph(ug, num_edges(ug));
+}
+
+int main()
+{
+    check_random_graphs(2, 1, 1);
+    check_random_graphs(20, 60, 2);
+    check_random_graphs(60, 150, 3);
+    check_random_graphs(80, 90, 4);
+
+    // A grid has many edges of equal centrality
+    Graph grid(25);
+    for (std::size_t i = 0; i < 5; ++i)
+        for (std::size_t j = 0; j < 5; ++j)
+        {
+            if (i + 1 < 5)
+                add_edge(5 * i + j, 5 * (i + 1) + j, grid);
+            if (j + 1 < 5)
+                add_edge(5 * i + j, 5 * i + j + 1, grid);
+        }
+    index_edges(grid);
+    check_graph(grid, num_edges(grid));
+
+    // The threshold stops before the graph runs out of edges
+    Graph split(grid);
+    std::vector< double > centrality(num_edges(split));
+    boost::betweenness_centrality_clustering(split,
+        boost::bc_clustering_threshold< double >(0.1, split),
+        boost::make_iterator_property_map(
+            centrality.begin(), get(boost::edge_index, split)));
+    BOOST_TEST(num_edges(split) > 0);
+    BOOST_TEST(num_edges(split) < num_edges(grid));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,210 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check bidirectional_dijkstra_shortest_path and
+// bidirectional_astar_shortest_path against dijkstra_shortest_paths on
+// random graphs and on a grid with Euclidean heuristics.
+
+#include <boost/graph/bidirectional_dijkstra_shortest_path.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS,
+    boost::bidirectionalS, boost::no_property,
+    boost::property< boost::edge_weight_t, int > >
+    BidirGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UndirectedGraph;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    boost::no_property, unsigned >
+    CSRGraph;
+
+// Check that path is a path from s to t in g of length dist
+template < typename Graph, typename WeightMap, typename Distance >
+void check_path(const Graph& g, WeightMap weight, std::size_t s,
+    std::size_t t, const std::vector< std::size_t >& path, Distance dist)
+{
+    BOOST_TEST(!path.empty() && path.front() == s && path.back() == t);
+    Distance length = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        // Shortest among the parallel edges
+        bool found = false;
+        Distance w = 0;
+        BGL_FORALL_OUTEDGES_T(path[i], e, g, Graph)
+        {
+            if (target(e, g) == path[i + 1] && (!found || get(weight, e) < w))
+            {
+                w = get(weight, e);
+                found = true;
+            }
+        }
+        BOOST_TEST(found);
+        length += w;
+    }
+    BOOST_TEST(std::abs(double(length) - double(dist)) <= 1e-9 * double(dist));
+}
+
+template < typename Graph, typename WeightMap >
+void check_graph(const Graph& g, WeightMap weight, int seed)
+{
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< Distance > expected(n);
+    for (int query = 0; query < 20; ++query)
+    {
+        std::size_t s = vertex_dist(gen), t = vertex_dist(gen);
+        boost::dijkstra_shortest_paths(
+            g, s, boost::weight_map(weight).distance_map(&expected[0]));
+        std::vector< std::size_t > path;
+        Distance dist = boost::bidirectional_dijkstra_shortest_path(g, s, t,
+            std::back_inserter(path), boost::weight_map(weight));
+        BOOST_TEST_EQ(dist, expected[t]);
+        if (expected[t] == (std::numeric_limits< Distance >::max)())
+            BOOST_TEST(path.empty());
+        else
+            check_path(g, weight, s, t, path, dist);
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< int > weight_dist(0, 100);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, BidirGraph >
+        ERGen;
+    BidirGraph bg(ERGen(gen, n, p), ERGen(), n);
+    BGL_FORALL_EDGES(e, bg, BidirGraph)
+    {
+        put(boost::edge_weight, bg, e, weight_dist(gen));
+    }
+    check_graph(bg, get(boost::edge_weight, bg), seed);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand,
+        UndirectedGraph >
+        UERGen;
+    UndirectedGraph ug(UERGen(gen, n, p), UERGen(), n);
+    BGL_FORALL_EDGES(e, ug, UndirectedGraph)
+    {
+        put(boost::edge_weight, ug, e, weight_dist(gen));
+    }
+    check_graph(ug, get(boost::edge_weight, ug), seed);
+
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+        ERGen(gen, n, p), ERGen());
+    std::vector< unsigned > weights;
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+        weights.push_back(weight_dist(gen));
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    check_graph(csr, get(boost::edge_bundle, csr), seed);
+}
+
+// Euclidean distance to a fixed point of a grid
+struct grid_distance
+{
+    grid_distance(std::size_t width, std::size_t to)
+    : m_width(width), m_to(to)
+    {
+    }
+    double operator()(std::size_t v) const
+    {
+        double dx = double(v % m_width) - double(m_to % m_width);
+        double dy = double(v / m_width) - double(m_to / m_width);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+    std::size_t m_width, m_to;
+};
+
+// Grid whose edge weights are at least the Euclidean length of the edges,
+// so that the Euclidean distances are consistent heuristics
+void check_astar(std::size_t width, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_real_distribution< double > stretch(1.0, 3.0);
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::bidirectionalS, boost::no_property,
+        boost::property< boost::edge_weight_t, double > >
+        Graph;
+    std::size_t n = width * width;
+    Graph g(n);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (v % width + 1 < width)
+        {
+            add_edge(v, v + 1, stretch(gen), g);
+            add_edge(v + 1, v, stretch(gen), g);
+        }
+        if (v + width < n)
+        {
+            add_edge(v, v + width, stretch(gen), g);
+            add_edge(v + width, v, stretch(gen), g);
+        }
+        if (v % width + 1 < width && v + width < n)
+            add_edge(v, v + width + 1, std::sqrt(2.0) * stretch(gen), g);
+    }
+
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< double > expected(n);
+    for (int query = 0; query < 20; ++query)
+    {
+        std::size_t s = vertex_dist(gen), t = vertex_dist(gen);
+        boost::dijkstra_shortest_paths(g, s, boost::distance_map(&expected[0]));
+        std::vector< std::size_t > path;
+        double dist = boost::bidirectional_astar_shortest_path(g, s, t,
+            grid_distance(width, t), grid_distance(width, s),
+            std::back_inserter(path),
+            boost::weight_map(get(boost::edge_weight, g)));
+        BOOST_TEST(std::abs(dist - expected[t]) <= 1e-9 * expected[t]);
+        check_path(g, get(boost::edge_weight, g), s, t, path, dist);
+    }
+}
+
+int main()
+{
+    check_random_graphs(16, 40, 1);
+    check_random_graphs(256, 1024, 2);
+    check_random_graphs(1024, 4096, 3);
+    check_random_graphs(1024, 1024, 4);
+    check_astar(30, 5);
+
+    // Negative weights are rejected
+    BidirGraph g(2);
+    add_edge(0, 1, -1, g);
+    std::vector< std::size_t > path;
+    bool threw = false;
+    try
+    {
+        boost::bidirectional_dijkstra_shortest_path(
+            g, 0, 1, std::back_inserter(path));
+    }
+    catch (const boost::negative_edge&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,102 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check bitset_transitive_closure against transitive_closure on random
+// directed graphs with and without cycles, with memory budgets that keep
+// all, some or none of the sets.
+
+#include <boost/graph/bitset_transitive_closure.hpp>
+#include <boost/graph/transitive_closure.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+
+void check_closure(const Digraph& g, std::size_t memory_budget)
+{
+    const std::size_t n = num_vertices(g);
+    Digraph tc;
+    if (n > 0)
+        boost::transitive_closure(g, tc);
+    std::vector< std::vector< char > > expected(
+        n, std::vector< char >(n, 0));
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(tc); e != e_end; ++e)
+        expected[source(*e, tc)][target(*e, tc)] = 1;
+
+    boost::bitset_transitive_closure< Digraph > closure(g, memory_budget);
+    BOOST_TEST(memory_budget == 0 || closure.memory_usage() <= memory_budget);
+    BOOST_TEST(closure.num_stored_components() <= closure.num_components());
+    for (std::size_t u = 0; u < n; ++u)
+    {
+        for (std::size_t v = 0; v < n; ++v)
+            BOOST_TEST_EQ(closure.reachable(u, v), expected[u][v] != 0);
+
+        std::vector< std::size_t > reached;
+        closure.reachable_from(u, std::back_inserter(reached));
+        std::sort(reached.begin(), reached.end());
+        std::vector< std::size_t > expected_reached;
+        for (std::size_t v = 0; v < n; ++v)
+            if (expected[u][v])
+                expected_reached.push_back(v);
+        BOOST_TEST(reached == expected_reached);
+    }
+}
+
+void check_random_digraph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph g(ERGen(gen, n, m, true), ERGen(), n);
+
+    // The same edges all going forward: a DAG
+    Digraph dag(n);
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        add_edge((std::min)(source(*e, g), target(*e, g)),
+            (std::max)(source(*e, g), target(*e, g)), dag);
+
+    const std::size_t budgets[] = { 0, 1, 64, 1024 };
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        check_closure(g, budgets[i]);
+        check_closure(dag, budgets[i]);
+    }
+}
+
+int main()
+{
+    check_closure(Digraph(), 0);
+    check_closure(Digraph(3), 0);
+
+    check_random_digraph(10, 12, 1);
+    check_random_digraph(100, 150, 2);
+    check_random_digraph(300, 400, 3);
+    check_random_digraph(300, 1200, 4);
+
+    // A self-loop makes a single vertex reach itself, and a budget of one
+    // byte keeps only the empty sets
+    Digraph g(4);
+    add_edge(0, 1, g);
+    add_edge(1, 1, g);
+    add_edge(1, 2, g);
+    boost::bitset_transitive_closure< Digraph > closure(g, 1);
+    BOOST_TEST_EQ(closure.num_components(), 4u);
+    BOOST_TEST_EQ(closure.memory_usage(), 0u);
+    BOOST_TEST(closure.reachable(1, 1));
+    BOOST_TEST(!closure.reachable(0, 0));
+    BOOST_TEST(closure.reachable(0, 2));
+    BOOST_TEST(!closure.reachable(2, 0));
+    BOOST_TEST(!closure.reachable(0, 3));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,221 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check contraction hierarchy queries against dijkstra_shortest_paths on
+// random graphs and grids, sequentially and with several threads, and
+// after a save and load through Boost.Serialization.
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/contraction_hierarchy.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    DirectedGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UndirectedGraph;
+
+// Check that path is a path from s to t in g of length dist
+template < typename Graph, typename Distance >
+void check_path(const Graph& g, std::size_t s, std::size_t t,
+    const std::vector< std::size_t >& path, Distance dist)
+{
+    BOOST_TEST(!path.empty() && path.front() == s && path.back() == t);
+    Distance length = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        // Shortest among the parallel edges
+        bool found = false;
+        Distance w = 0;
+        BGL_FORALL_OUTEDGES_T(path[i], e, g, Graph)
+        {
+            Distance we = get(boost::edge_weight, g, e);
+            if (target(e, g) == path[i + 1] && (!found || we < w))
+            {
+                w = we;
+                found = true;
+            }
+        }
+        BOOST_TEST(found);
+        length += w;
+    }
+    BOOST_TEST(std::abs(double(length) - double(dist)) <= 1e-9 * double(dist));
+}
+
+// Both search graphs only lead up in rank
+template < typename Hierarchy > void check_ranks(const Hierarchy& ch)
+{
+    typedef typename Hierarchy::search_graph_type SearchGraph;
+    std::vector< bool > seen(ch.num_vertices(), false);
+    for (std::size_t v = 0; v < ch.num_vertices(); ++v)
+    {
+        BOOST_TEST(ch.rank(v) < ch.num_vertices() && !seen[ch.rank(v)]);
+        seen[ch.rank(v)] = true;
+    }
+    BGL_FORALL_EDGES_T(e, ch.upward_graph(), SearchGraph)
+    {
+        BOOST_TEST(ch.rank(source(e, ch.upward_graph()))
+            < ch.rank(target(e, ch.upward_graph())));
+    }
+    BGL_FORALL_EDGES_T(e, ch.downward_graph(), SearchGraph)
+    {
+        BOOST_TEST(ch.rank(source(e, ch.downward_graph()))
+            < ch.rank(target(e, ch.downward_graph())));
+    }
+}
+
+template < typename Graph, typename Hierarchy >
+void check_queries(const Graph& g, const Hierarchy& ch, int seed)
+{
+    typedef typename Hierarchy::weight_type Distance;
+    std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< Distance > expected(n);
+    boost::contraction_hierarchy_query< Distance > query(ch);
+    for (int source = 0; source < 5; ++source)
+    {
+        std::size_t s = vertex_dist(gen);
+        boost::dijkstra_shortest_paths(g, s, boost::distance_map(&expected[0]));
+        for (int i = 0; i < 20; ++i)
+        {
+            std::size_t t = vertex_dist(gen);
+            BOOST_TEST_EQ(query.distance(s, t), expected[t]);
+            std::vector< std::size_t > path;
+            Distance dist = query.shortest_path(s, t, std::back_inserter(path));
+            BOOST_TEST_EQ(dist, expected[t]);
+            if (expected[t] == (std::numeric_limits< Distance >::max)())
+                BOOST_TEST(path.empty());
+            else
+                check_path(g, s, t, path, dist);
+        }
+    }
+}
+
+template < typename Graph > void check_graph(const Graph& g, int seed)
+{
+    typedef typename boost::property_map< Graph,
+        boost::edge_weight_t >::const_type WeightMap;
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    typedef boost::contraction_hierarchy< Distance > Hierarchy;
+
+    Hierarchy ch(g, 1);
+    check_ranks(ch);
+    check_queries(g, ch, seed);
+
+    Hierarchy parallel_ch(
+        g, get(boost::edge_weight, g), get(boost::vertex_index, g), 4);
+    check_ranks(parallel_ch);
+    check_queries(g, parallel_ch, seed);
+
+    std::stringstream stream;
+    {
+        boost::archive::text_oarchive oa(stream);
+        oa << static_cast< const Hierarchy& >(ch);
+    }
+    Hierarchy loaded;
+    {
+        boost::archive::text_iarchive ia(stream);
+        ia >> loaded;
+    }
+    BOOST_TEST_EQ(loaded.num_vertices(), ch.num_vertices());
+    BOOST_TEST_EQ(loaded.num_shortcuts(), ch.num_shortcuts());
+    check_queries(g, loaded, seed);
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< int > weight_dist(0, 100);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, DirectedGraph >
+        ERGen;
+    DirectedGraph dg(ERGen(gen, n, p), ERGen(), n);
+    BGL_FORALL_EDGES(e, dg, DirectedGraph)
+    {
+        put(boost::edge_weight, dg, e, weight_dist(gen));
+    }
+    check_graph(dg, seed);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand,
+        UndirectedGraph >
+        UERGen;
+    UndirectedGraph ug(UERGen(gen, n, p), UERGen(), n);
+    BGL_FORALL_EDGES(e, ug, UndirectedGraph)
+    {
+        put(boost::edge_weight, ug, e, weight_dist(gen));
+    }
+    check_graph(ug, seed);
+}
+
+// A road-like grid with random weights and a few one-way streets
+void check_grid(std::size_t width, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_real_distribution< double > weight_dist(1.0, 3.0);
+    boost::random::uniform_int_distribution< int > one_way(0, 9);
+    std::size_t n = width * width;
+    DirectedGraph g(n);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        for (int side = 0; side < 2; ++side)
+        {
+            std::size_t w = side == 0 ? v + 1 : v + width;
+            if ((side == 0 && v % width + 1 == width) || w >= n)
+                continue;
+            int weight = int(10 * weight_dist(gen));
+            add_edge(v, w, weight, g);
+            if (one_way(gen) != 0)
+                add_edge(w, v, weight, g);
+        }
+    }
+    check_graph(g, seed);
+}
+
+int main()
+{
+    check_random_graphs(16, 40, 1);
+    check_random_graphs(256, 1024, 2);
+    check_random_graphs(512, 1024, 3);
+    check_grid(30, 4);
+
+    // Empty graph
+    DirectedGraph empty;
+    boost::contraction_hierarchy< int > empty_ch(empty);
+    BOOST_TEST_EQ(empty_ch.num_vertices(), 0u);
+
+    // Negative weights are rejected
+    DirectedGraph g(2);
+    add_edge(0, 1, -1, g);
+    bool threw = false;
+    try
+    {
+        boost::contraction_hierarchy< int > ch(g);
+    }
+    catch (const boost::negative_edge&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,166 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Test that the multithreaded constructors of the compressed sparse row graph
+// build exactly the same arrays as the sequential ones.
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <list>
+#include <utility>
+#include <vector>
+
+struct EdgeData
+{
+    int weight;
+};
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, EdgeData >
+    CSRGraphT;
+
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    boost::no_property, EdgeData >
+    BidirCSRGraphT;
+
+typedef std::pair< std::size_t, std::size_t > edge_t;
+
+template < typename Structure >
+void check_same_structure(const Structure& a, const Structure& b)
+{
+    BOOST_TEST(a.m_rowstart == b.m_rowstart);
+    BOOST_TEST(a.m_column == b.m_column);
+}
+
+std::vector< int > weights_of(const CSRGraphT& g)
+{
+    std::vector< int > w;
+    BGL_FORALL_EDGES(e, g, CSRGraphT) { w.push_back(g[e].weight); }
+    return w;
+}
+
+// The column array with each row sorted
+std::vector< std::size_t > sorted_rows(const CSRGraphT& g)
+{
+    std::vector< std::size_t > column(
+        g.m_forward.m_column.begin(), g.m_forward.m_column.end());
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+        std::sort(column.begin() + g.m_forward.m_rowstart[v],
+            column.begin() + g.m_forward.m_rowstart[v + 1]);
+    return column;
+}
+
+void test_graph(std::size_t numverts, std::size_t numedges, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, numverts == 0 ? 0 : numverts - 1);
+    std::vector< edge_t > edge_list;
+    std::vector< EdgeData > edge_props;
+    for (std::size_t i = 0; i < numedges && numverts > 0; ++i)
+    {
+        edge_list.push_back(edge_t(vertex_dist(gen), vertex_dist(gen)));
+        EdgeData d = { int(i) };
+        edge_props.push_back(d);
+    }
+
+    CSRGraphT serial(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), edge_props.begin(), numverts);
+    BidirCSRGraphT serial_bidir(boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), edge_list.end(), edge_props.begin(), numverts);
+
+    const std::size_t thread_counts[] = { 1, 2, 3, 4, 7, 16 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(std::size_t);
+         ++i)
+    {
+        std::size_t num_threads = thread_counts[i];
+
+        CSRGraphT g(boost::edges_are_unsorted_multi_pass_parallel,
+            edge_list.begin(), edge_list.end(), numverts, num_threads);
+        check_same_structure(serial.m_forward, g.m_forward);
+
+        CSRGraphT gp(boost::edges_are_unsorted_multi_pass_parallel,
+            edge_list.begin(), edge_list.end(), edge_props.begin(), numverts,
+            num_threads);
+        check_same_structure(serial.m_forward, gp.m_forward);
+        BOOST_TEST(weights_of(serial) == weights_of(gp));
+
+        BidirCSRGraphT gb(boost::edges_are_unsorted_multi_pass_parallel,
+            edge_list.begin(), edge_list.end(), edge_props.begin(), numverts,
+            num_threads);
+        check_same_structure(serial_bidir.m_forward, gb.m_forward);
+        check_same_structure(serial_bidir.m_backward, gb.m_backward);
+        BOOST_TEST(serial_bidir.m_backward.m_edge_properties
+            == gb.m_backward.m_edge_properties);
+
+        std::vector< std::size_t > sources, targets;
+        for (std::size_t j = 0; j < edge_list.size(); ++j)
+        {
+            sources.push_back(edge_list[j].first);
+            targets.push_back(edge_list[j].second);
+        }
+        CSRGraphT gs(boost::construct_from_sources_and_targets_parallel,
+            sources, targets, numverts, num_threads);
+        check_same_structure(serial.m_forward, gs.m_forward);
+        CSRGraphT gsp(boost::construct_from_sources_and_targets_parallel,
+            sources, targets, edge_props, numverts, num_threads);
+        check_same_structure(serial.m_forward, gsp.m_forward);
+        BOOST_TEST(weights_of(serial) == weights_of(gsp));
+
+        // The in-place constructor gives the same rows, but the out-edges of
+        // a vertex may be in another order
+        std::vector< std::size_t > inplace_sources(sources);
+        std::vector< std::size_t > inplace_targets(targets);
+        CSRGraphT gi(boost::construct_inplace_from_sources_and_targets,
+            inplace_sources, inplace_targets, numverts);
+        BOOST_TEST(gi.m_forward.m_rowstart == gs.m_forward.m_rowstart);
+        BOOST_TEST(sorted_rows(gi) == sorted_rows(gs));
+    }
+
+    // Iterators that are not random access fall back to the sequential code
+    std::list< edge_t > edge_list_2(edge_list.begin(), edge_list.end());
+    CSRGraphT gl(boost::edges_are_unsorted_multi_pass_parallel,
+        edge_list_2.begin(), edge_list_2.end(), numverts, 4);
+    check_same_structure(serial.m_forward, gl.m_forward);
+}
+
+// The vectors are left unchanged, and edges with the same source keep
+// their order from them, unlike with the in-place constructor
+void test_sources_and_targets_order()
+{
+    const std::size_t source_array[] = { 2, 0, 1, 0, 2, 1, 0, 2 };
+    const std::size_t target_array[] = { 0, 2, 0, 1, 1, 2, 0, 2 };
+    std::vector< std::size_t > sources(source_array, source_array + 8);
+    std::vector< std::size_t > targets(target_array, target_array + 8);
+    const std::size_t expected_column[] = { 2, 1, 0, 0, 2, 0, 1, 2 };
+
+    CSRGraphT g(boost::construct_from_sources_and_targets_parallel, sources,
+        targets, 3, 2);
+    BOOST_TEST(std::equal(
+        expected_column, expected_column + 8, g.m_forward.m_column.begin()));
+    BOOST_TEST(std::equal(source_array, source_array + 8, sources.begin()));
+    BOOST_TEST(std::equal(target_array, target_array + 8, targets.begin()));
+
+    CSRGraphT gi(
+        boost::construct_inplace_from_sources_and_targets, sources, targets, 3);
+    BOOST_TEST(gi.m_forward.m_rowstart == g.m_forward.m_rowstart);
+    BOOST_TEST(gi.m_forward.m_column != g.m_forward.m_column);
+    BOOST_TEST(sorted_rows(gi) == sorted_rows(g));
+}
+
+int main()
+{
+    test_sources_and_targets_order();
+    test_graph(0, 0, 1);
+    test_graph(1, 5, 2);
+    test_graph(10, 3, 3);
+    test_graph(100, 1000, 4);
+    test_graph(1000, 20000, 5);
+    return boost::report_errors();
+}
@@ -0,0 +1,172 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check delta_stepping_shortest_paths against dijkstra_shortest_paths on
+// random graphs, for several bucket widths and numbers of threads.
+//
+// Usage: delta_stepping_test [n [m [seed]]] also checks a random graph with
+// n vertices and m edges.
+
+#include <boost/graph/delta_stepping_shortest_paths.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    DoubleGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    UndirectedGraph;
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, unsigned >
+    CSRGraph;
+
+// Check that the distances are those computed by Dijkstra's algorithm and
+// that every vertex's predecessor is on a shortest path to it
+template < typename Graph, typename WeightMap, typename Distance >
+void check_paths(const Graph& g, WeightMap weight,
+    const std::vector< Distance >& expected,
+    const std::vector< Distance >& dist, const std::vector< std::size_t >& pred)
+{
+    BOOST_TEST(dist == expected);
+    typename boost::graph_traits< Graph >::out_edge_iterator ei, ei_end;
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+    {
+        if (pred[v] == v)
+            continue;
+        bool found = false;
+        for (boost::tie(ei, ei_end) = out_edges(pred[v], g); ei != ei_end;
+             ++ei)
+        {
+            if (target(*ei, g) == v
+                && dist[pred[v]] + get(weight, *ei) == dist[v])
+                found = true;
+        }
+        BOOST_TEST(found);
+    }
+}
+
+template < typename Graph, typename WeightMap >
+void check_graph(const Graph& g, WeightMap weight, std::size_t s)
+{
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    std::size_t n = num_vertices(g);
+    std::vector< Distance > expected(n);
+    boost::dijkstra_shortest_paths(g, s,
+        boost::weight_map(weight).distance_map(&expected[0]));
+
+    const Distance deltas[] = { Distance(0), Distance(1), Distance(7),
+        Distance(1000000) };
+    const std::size_t thread_counts[] = { 1, 2, 4 };
+    for (std::size_t i = 0; i < sizeof(deltas) / sizeof(Distance); ++i)
+    {
+        for (std::size_t j = 0;
+             j < sizeof(thread_counts) / sizeof(std::size_t); ++j)
+        {
+            std::vector< Distance > dist(n);
+            std::vector< std::size_t > pred(n);
+            boost::delta_stepping_shortest_paths(g, s,
+                boost::weight_map(weight)
+                    .distance_map(&dist[0])
+                    .predecessor_map(&pred[0])
+                    .bucket_width(deltas[i])
+                    .num_threads(thread_counts[j]));
+            check_paths(g, weight, expected, dist, pred);
+        }
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< int > weight_dist(0, 100);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, DoubleGraph >
+        ERGen;
+    DoubleGraph dg(ERGen(gen, n, p), ERGen(), n);
+    // Integral weights, so that distances are exact
+    BGL_FORALL_EDGES(e, dg, DoubleGraph)
+    {
+        put(boost::edge_weight, dg, e, weight_dist(gen));
+    }
+    check_graph(dg, get(boost::edge_weight, dg), 0);
+
+    // A bucket width far below the weights must not allocate a bucket per
+    // multiple of it
+    std::vector< double > expected(n), dist(n);
+    std::vector< std::size_t > pred(n);
+    boost::dijkstra_shortest_paths(dg, 0, boost::distance_map(&expected[0]));
+    boost::delta_stepping_shortest_paths(dg, 0,
+        boost::distance_map(&dist[0])
+            .predecessor_map(&pred[0])
+            .bucket_width(1e-300)
+            .num_threads(2));
+    check_paths(dg, get(boost::edge_weight, dg), expected, dist, pred);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand,
+        UndirectedGraph >
+        UERGen;
+    UndirectedGraph ug(UERGen(gen, n, p), UERGen(), n);
+    BGL_FORALL_EDGES(e, ug, UndirectedGraph)
+    {
+        put(boost::edge_weight, ug, e, weight_dist(gen));
+    }
+    check_graph(ug, get(boost::edge_weight, ug), n / 2);
+
+    typedef boost::rmat_iterator< boost::minstd_rand, CSRGraph > RMATGen;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+        RMATGen(gen, n, m, 0.57, 0.19, 0.19, 0.05), RMATGen());
+    std::vector< unsigned > weights;
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+        weights.push_back(weight_dist(gen));
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    check_graph(csr, get(boost::edge_bundle, csr), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    check_random_graphs(16, 40, 1);
+    check_random_graphs(256, 2048, 2);
+    check_random_graphs(1024, 16384, 3);
+    if (argc > 1)
+    {
+        std::size_t n = boost::lexical_cast< std::size_t >(argv[1]);
+        std::size_t m
+            = (argc > 2 ? boost::lexical_cast< std::size_t >(argv[2]) : 8 * n);
+        int seed = (argc > 3 ? boost::lexical_cast< int >(argv[3]) : 1);
+        check_random_graphs(n, m, seed);
+    }
+
+    // Negative weights are rejected
+    DoubleGraph g(2);
+    add_edge(0, 1, -1.0, g);
+    std::vector< double > dist(2);
+    bool threw = false;
+    try
+    {
+        boost::delta_stepping_shortest_paths(g, 0,
+            boost::distance_map(&dist[0]));
+    }
+    catch (const boost::negative_edge&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    return boost::report_errors();
+}
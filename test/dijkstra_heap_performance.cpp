@@ -13,6 +13,9 @@
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/dijkstra_shortest_paths_no_color_map.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/pending/relaxed_heap.hpp>
+#include <boost/pending/indirect_cmp.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/random/linear_congruential.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/random/uniform_real.hpp>
@@ -23,6 +26,7 @@
 #include <iterator>
 #include <utility>
 #include <boost/random/uniform_int.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/erdos_renyi_generator.hpp>
 #include <boost/type_traits/is_base_and_derived.hpp>
@@ -31,6 +35,76 @@
 
 using namespace boost;
 
+// relaxed_heap cannot be copied, so it is plugged into
+// dijkstra_shortest_paths through the queue generator hook by pointer
+struct relaxed_heapS
+{
+};
+
+template < typename Vertex, typename IndexMap, typename DistanceMap,
+    typename Compare >
+class shared_relaxed_heap
+{
+    typedef indirect_cmp< DistanceMap, Compare > IndirectCmp;
+    typedef relaxed_heap< Vertex, IndirectCmp, IndexMap > Heap;
+
+public:
+    shared_relaxed_heap(std::size_t n, DistanceMap distance, IndexMap index,
+        const Compare& compare)
+    : m_heap(new Heap(n, IndirectCmp(distance, compare), index))
+    {
+    }
+
+    void push(const Vertex& v) { m_heap->push(v); }
+    void update(const Vertex& v) { m_heap->update(v); }
+    Vertex& top() { return m_heap->top(); }
+    void pop() { m_heap->pop(); }
+    bool empty() const { return m_heap->empty(); }
+
+private:
+    boost::shared_ptr< Heap > m_heap;
+};
+
+namespace boost
+{
+template < class Graph, class IndexMap, class DistanceMap, class WeightMap,
+    class Compare >
+struct dijkstra_queue_generator< relaxed_heapS, Graph, IndexMap, DistanceMap,
+    WeightMap, Compare >
+{
+    typedef shared_relaxed_heap<
+        typename graph_traits< Graph >::vertex_descriptor, IndexMap,
+        DistanceMap, Compare >
+        type;
+    static type build(const Graph& g, const IndexMap& index,
+        DistanceMap distance, WeightMap, const Compare& compare, relaxed_heapS,
+        boost::scoped_array< std::size_t >&)
+    {
+        return type(num_vertices(g), distance, index, compare);
+    }
+};
+}
+
+// Run Dijkstra's algorithm with integer weights and the queue selected by
+// queue_selector, and compare the distances with the expected ones
+template < typename Graph, typename QueueSelector >
+boost::timer::cpu_times time_queue(const Graph& g, const char* name,
+    QueueSelector queue_selector, std::vector< unsigned >& distances,
+    const std::vector< unsigned >* expected)
+{
+    std::cout << "Running Dijkstra's (integer weights) with " << name
+              << "...";
+    std::cout.flush();
+    boost::timer::cpu_timer t;
+    dijkstra_shortest_paths(g, vertex(0, g),
+        distance_map(&distances[0]).priority_queue_selector(queue_selector));
+    t.stop();
+    std::cout << boost::timer::format(t.elapsed()) << " seconds.\n";
+    if (expected)
+        BOOST_TEST(distances == *expected);
+    return t.elapsed();
+}
+
 #ifdef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
 
 struct show_events_visitor : dijkstra_visitor<>
@@ -85,6 +159,8 @@ int main(int argc, char* argv[])
     unsigned n = (argc > 1 ? lexical_cast< unsigned >(argv[1]) : 10000u);
     unsigned m = (argc > 2 ? lexical_cast< unsigned >(argv[2]) : 10 * n);
     int seed = (argc > 3 ? lexical_cast< int >(argv[3]) : 1);
+    unsigned max_weight
+        = (argc > 4 ? lexical_cast< unsigned >(argv[4]) : 100u);
 
     // Build random graph
     typedef adjacency_list< vecS, vecS, directedS, no_property,
@@ -156,6 +232,36 @@ int main(int argc, char* argv[])
     // Verify that the results are equivalent
     BOOST_TEST(binary_heap_distances == no_color_map_distances);
 
+    // Compare the priority queues on a graph with small integer weights
+    typedef adjacency_list< vecS, vecS, directedS, no_property,
+        property< edge_weight_t, unsigned > >
+        IntGraph;
+    IntGraph ig(erdos_renyi_iterator< minstd_rand, IntGraph >(gen, n, p),
+        erdos_renyi_iterator< minstd_rand, IntGraph >(), n);
+    boost::random::uniform_int_distribution< unsigned > rand_weight(
+        1, max_weight);
+    graph_traits< IntGraph >::edge_iterator iei, iei_end;
+    for (boost::tie(iei, iei_end) = edges(ig); iei != iei_end; ++iei)
+        put(edge_weight, ig, *iei, rand_weight(gen));
+    std::cout << "Integer weights in [1, " << max_weight << "], "
+              << num_edges(ig) << " edges.\n";
+
+    std::vector< unsigned > d_ary_distances(n), distances(n);
+    boost::timer::cpu_times d_ary_time = time_queue(
+        ig, "d-ary heap (d=4)", d_ary_heapS(), d_ary_distances, 0);
+    boost::timer::cpu_times relaxed_time = time_queue(
+        ig, "relaxed heap", relaxed_heapS(), distances, &d_ary_distances);
+    boost::timer::cpu_times radix_time = time_queue(
+        ig, "radix heap", radix_heapS(), distances, &d_ary_distances);
+    boost::timer::cpu_times bucket_time = time_queue(ig, "bucket queue",
+        bucket_queueS(max_weight), distances, &d_ary_distances);
+    std::cout << "Speedup over d-ary heap: relaxed heap = "
+              << (double(d_ary_time.user) / relaxed_time.user)
+              << ", radix heap = "
+              << (double(d_ary_time.user) / radix_time.user)
+              << ", bucket queue = "
+              << (double(d_ary_time.user) / bucket_time.user) << ".\n";
+
 #ifdef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
     run_test(g, "d-ary heap (d=2)", dijkstra_d_heap_2, binary_heap_distances);
     run_test(g, "d-ary heap (d=3)", dijkstra_d_heap_3, binary_heap_distances);
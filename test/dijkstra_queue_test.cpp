@@ -0,0 +1,184 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check that dijkstra_shortest_paths computes the same distances with the
+// radix heap and the bucket queue as with the default d-ary heap, and check
+// these queues directly against a sorted sequence of monotone operations.
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, unsigned >
+    CSRGraph;
+
+template < typename Graph, typename WeightMap >
+void check_graph(const Graph& g, WeightMap weight, unsigned max_weight)
+{
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    std::size_t n = num_vertices(g);
+    std::vector< Distance > expected(n), dist(n);
+    std::vector< std::size_t > pred(n);
+    boost::dijkstra_shortest_paths(
+        g, 0, boost::weight_map(weight).distance_map(&expected[0]));
+
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(weight)
+            .distance_map(&dist[0])
+            .predecessor_map(&pred[0])
+            .priority_queue_selector(boost::radix_heapS()));
+    BOOST_TEST(dist == expected);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        BOOST_TEST(pred[v] == v
+            || (dist[v] != (std::numeric_limits< Distance >::max)()
+                && dist[pred[v]] <= dist[v]));
+    }
+
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(weight)
+            .distance_map(&dist[0])
+            .priority_queue_selector(boost::bucket_queueS()));
+    BOOST_TEST(dist == expected);
+
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(weight)
+            .distance_map(&dist[0])
+            .priority_queue_selector(boost::bucket_queueS(max_weight)));
+    BOOST_TEST(dist == expected);
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, unsigned max_weight,
+    int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< unsigned > weight_dist(
+        0, max_weight);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, p), ERGen(), n);
+    BGL_FORALL_EDGES(e, g, Graph)
+    {
+        put(boost::edge_weight, g, e, int(weight_dist(gen)));
+    }
+    check_graph(g, get(boost::edge_weight, g), max_weight);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, CSRGraph >
+        CSRERGen;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+        CSRERGen(gen, n, p), CSRERGen());
+    std::vector< unsigned > weights;
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+        weights.push_back(weight_dist(gen));
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    check_graph(csr, get(boost::edge_bundle, csr), max_weight);
+}
+
+// Pop all values and check that they come out in order of their keys,
+// after random pushes and decreases that keep the keys within max_span of
+// the last minimum
+template < typename Queue >
+void check_queue_operations(Queue& Q, std::vector< unsigned >& keys,
+    unsigned max_span, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< unsigned > span_dist(
+        0, max_span);
+    std::size_t n = keys.size();
+    std::vector< bool > pushed(n, false), popped(n, false);
+    unsigned last = 0;
+    std::size_t next = 0;
+    while (next < n || !Q.empty())
+    {
+        // Push or decrease a few values
+        for (int i = 0; i < 3 && next < n; ++i)
+        {
+            std::size_t v = boost::random::uniform_int_distribution<
+                std::size_t >(0, next)(gen);
+            if (!pushed[v])
+            {
+                v = next++;
+                keys[v] = last + span_dist(gen);
+                pushed[v] = true;
+                Q.push(v);
+            }
+            else if (!popped[v] && keys[v] > last)
+            {
+                keys[v] = last
+                    + boost::random::uniform_int_distribution< unsigned >(
+                        0, keys[v] - last - 1)(gen);
+                Q.update(v);
+            }
+        }
+        if (Q.empty())
+            continue;
+        std::size_t u = Q.top();
+        Q.pop();
+        BOOST_TEST(!popped[u]);
+        BOOST_TEST(keys[u] >= last);
+        // Nothing still in the queue has a smaller key
+        for (std::size_t v = 0; v < next; ++v)
+        {
+            if (!popped[v] && v != u)
+                BOOST_TEST(keys[v] >= keys[u]);
+        }
+        popped[u] = true;
+        last = keys[u];
+    }
+    BOOST_TEST(std::find(popped.begin(), popped.end(), false) == popped.end());
+}
+
+void check_queues(std::size_t n, unsigned max_span, int seed)
+{
+    std::vector< unsigned > keys(n);
+    std::vector< std::size_t > index_in_heap(n, std::size_t(-1));
+    typedef boost::iterator_property_map< unsigned*,
+        boost::identity_property_map >
+        KeyMap;
+    typedef boost::iterator_property_map< std::size_t*,
+        boost::identity_property_map >
+        IndexInHeapMap;
+    KeyMap key_map(&keys[0]);
+    IndexInHeapMap index_map(&index_in_heap[0]);
+
+    boost::radix_heap_indirect< std::size_t, IndexInHeapMap, KeyMap > radix(
+        key_map, index_map);
+    check_queue_operations(radix, keys, max_span, seed);
+
+    boost::bucket_queue_indirect< std::size_t, IndexInHeapMap, KeyMap > bucket(
+        key_map, index_map, max_span);
+    check_queue_operations(bucket, keys, max_span, seed);
+}
+
+int main()
+{
+    check_random_graphs(16, 40, 10, 1);
+    check_random_graphs(1024, 8192, 100, 2);
+    check_random_graphs(1024, 8192, 0, 3);
+    check_random_graphs(2048, 16384, 100000, 4);
+
+    check_queues(200, 1, 5);
+    check_queues(200, 17, 6);
+    check_queues(500, 1000, 7);
+
+    return boost::report_errors();
+}
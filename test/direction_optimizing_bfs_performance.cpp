@@ -0,0 +1,124 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the running time of breadth_first_search and
+// direction_optimizing_breadth_first_search on RMAT graphs.
+//
+// Usage: direction_optimizing_bfs_performance [scale [edge factor [seed]]]
+// builds a graph with 2^scale vertices and edge factor * 2^scale edges
+// (default 16 and 16) and runs both searches from the same random sources.
+
+#include <boost/graph/direction_optimizing_breadth_first_search.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+template < typename Graph >
+void run_test(const Graph& g, const char* name,
+    const std::vector< std::size_t >& sources)
+{
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    const std::size_t n = num_vertices(g);
+    const std::size_t unreached = (std::numeric_limits< std::size_t >::max)();
+    std::vector< std::size_t > bfs_distances(n), dobfs_distances(n);
+    std::vector< Vertex > predecessors(n);
+    boost::timer::cpu_times bfs_time, dobfs_time;
+    bfs_time.clear();
+    dobfs_time.clear();
+
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        Vertex s = vertex(sources[i], g);
+        std::fill(bfs_distances.begin(), bfs_distances.end(), unreached);
+        std::fill(dobfs_distances.begin(), dobfs_distances.end(), unreached);
+        bfs_distances[sources[i]] = 0;
+
+        boost::timer::cpu_timer t;
+        breadth_first_search(g, s,
+            visitor(make_bfs_visitor(record_distances(
+                make_iterator_property_map(
+                    bfs_distances.begin(), get(vertex_index, g)),
+                on_tree_edge()))));
+        t.stop();
+        bfs_time.wall += t.elapsed().wall;
+        bfs_time.user += t.elapsed().user;
+
+        t.start();
+        direction_optimizing_breadth_first_search(g, s,
+            make_iterator_property_map(
+                dobfs_distances.begin(), get(vertex_index, g)),
+            make_iterator_property_map(
+                predecessors.begin(), get(vertex_index, g)));
+        t.stop();
+        dobfs_time.wall += t.elapsed().wall;
+        dobfs_time.user += t.elapsed().user;
+
+        BOOST_TEST(bfs_distances == dobfs_distances);
+    }
+
+    std::cout << name << ":\n"
+              << "  breadth_first_search:                      "
+              << boost::timer::format(bfs_time)
+              << "  direction_optimizing_breadth_first_search: "
+              << boost::timer::format(dobfs_time) << "  Speedup = "
+              << (double(bfs_time.wall) / double(dobfs_time.wall)) << ".\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned scale = (argc > 1 ? lexical_cast< unsigned >(argv[1]) : 16u);
+    unsigned edge_factor
+        = (argc > 2 ? lexical_cast< unsigned >(argv[2]) : 16u);
+    int seed = (argc > 3 ? lexical_cast< int >(argv[3]) : 1);
+    std::size_t n = std::size_t(1) << scale;
+    std::size_t m = edge_factor * n;
+
+    typedef compressed_sparse_row_graph< bidirectionalS > CSRGraph;
+    typedef adjacency_list< vecS, vecS, bidirectionalS > AdjListGraph;
+
+    std::cout << "Generating graph...";
+    std::cout.flush();
+    minstd_rand gen(seed);
+    // Graph 500 parameters
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+        rmat_iterator< minstd_rand, CSRGraph >(gen, n, m, 0.57, 0.19, 0.19,
+            0.05),
+        rmat_iterator< minstd_rand, CSRGraph >());
+    // Make the edges symmetric, as for the Graph 500 benchmark
+    for (std::size_t i = 0, e = edge_list.size(); i < e; ++i)
+        edge_list.push_back(
+            std::make_pair(edge_list[i].second, edge_list[i].first));
+    CSRGraph csr(
+        edges_are_unsorted_multi_pass, edge_list.begin(), edge_list.end(), n);
+    AdjListGraph adj(edge_list.begin(), edge_list.end(), n);
+    std::cout << n << " vertices, " << num_edges(csr) << " edges.\n";
+
+    // Search from vertices that have edges
+    std::vector< std::size_t > sources;
+    random::uniform_int_distribution< std::size_t > vertex_dist(0, n - 1);
+    while (sources.size() < 16)
+    {
+        std::size_t s = vertex_dist(gen);
+        if (out_degree(s, csr) != 0)
+            sources.push_back(s);
+    }
+
+    run_test(csr, "compressed_sparse_row_graph<bidirectionalS>", sources);
+    run_test(adj, "adjacency_list<vecS, vecS, bidirectionalS>", sources);
+    return boost::report_errors();
+}
@@ -0,0 +1,135 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Test that direction_optimizing_breadth_first_search computes the same
+// distances as breadth_first_search and a valid breadth-first tree, for
+// several graph types and for settings of the switching heuristics that
+// force purely top-down, purely bottom-up and mixed traversals.
+
+#include <boost/graph/direction_optimizing_breadth_first_search.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS > CSRGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS,
+    boost::bidirectionalS >
+    BidirGraph;
+typedef boost::adjacency_list< boost::listS, boost::listS,
+    boost::undirectedS, boost::property< boost::vertex_index_t, int > >
+    UndirectedListGraph;
+
+const std::size_t unreached = (std::numeric_limits< std::size_t >::max)();
+
+template < typename Graph >
+void check_search(const Graph& g,
+    typename boost::graph_traits< Graph >::vertex_descriptor s, double alpha,
+    double beta)
+{
+    typedef typename boost::graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename boost::property_map< Graph,
+        boost::vertex_index_t >::const_type IndexMap;
+    IndexMap index = get(boost::vertex_index, g);
+    std::size_t n = num_vertices(g);
+
+    std::vector< std::size_t > expected(n, unreached);
+    expected[get(index, s)] = 0;
+    boost::breadth_first_search(g, s,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(expected.begin(), index),
+            boost::on_tree_edge()))));
+
+    std::vector< std::size_t > dist(n, unreached);
+    std::vector< Vertex > pred(n);
+    boost::direction_optimizing_breadth_first_search(g, s,
+        boost::make_iterator_property_map(dist.begin(), index),
+        boost::make_iterator_property_map(pred.begin(), index), index, alpha,
+        beta);
+    BOOST_TEST(dist == expected);
+
+    typename boost::graph_traits< Graph >::vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+    {
+        std::size_t v = get(index, *vi);
+        if (dist[v] == unreached || *vi == s)
+            continue;
+        Vertex p = pred[v];
+        BOOST_TEST_EQ(dist[get(index, p)] + 1, dist[v]);
+        BOOST_TEST(edge(p, *vi, g).second);
+    }
+    BOOST_TEST(pred[get(index, s)] == s);
+}
+
+template < typename Graph >
+void check_all_heuristics(
+    const Graph& g, typename boost::graph_traits< Graph >::vertex_descriptor s)
+{
+    // Default heuristics
+    check_search(g, s, 15.0, 18.0);
+    // Always top-down
+    check_search(g, s, 1e-9, 18.0);
+    // Bottom-up as long as the frontier does not shrink
+    check_search(g, s, 1e9, 1e9);
+    // Bottom-up until the end of the search
+    check_search(g, s, 1e9, 1e-9);
+}
+
+int main()
+{
+    boost::minstd_rand gen(42);
+
+    for (std::size_t n = 8; n <= 4096; n *= 8)
+    {
+        typedef boost::rmat_iterator< boost::minstd_rand, CSRGraph > RMATGen;
+        std::vector< std::pair< std::size_t, std::size_t > > rmat_edges(
+            RMATGen(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05), RMATGen());
+        CSRGraph csr(boost::edges_are_unsorted_multi_pass, rmat_edges.begin(),
+            rmat_edges.end(), n);
+        check_all_heuristics(csr, 0);
+        check_all_heuristics(csr, vertex(n - 1, csr));
+
+        typedef boost::erdos_renyi_iterator< boost::minstd_rand, BidirGraph >
+            ERGen;
+        BidirGraph bg(ERGen(gen, n, 2.0 / n), ERGen(), n);
+        check_all_heuristics(bg, 0);
+    }
+
+    // A graph with several components, vertices without indices as
+    // descriptors and undirected edges
+    UndirectedListGraph ug;
+    std::vector< boost::graph_traits< UndirectedListGraph >::vertex_descriptor >
+        v;
+    for (int i = 0; i < 20; ++i)
+        v.push_back(add_vertex(i, ug));
+    for (int i = 0; i < 9; ++i)
+        add_edge(v[i], v[i + 1], ug);
+    for (int i = 10; i < 19; ++i)
+        add_edge(v[i], v[(i * 7) % 10 + 10], ug);
+    check_all_heuristics(ug, v[0]);
+    check_all_heuristics(ug, v[12]);
+
+    // Named parameter interface
+    typedef boost::rmat_iterator< boost::minstd_rand, CSRGraph > RMATGen;
+    std::vector< std::pair< std::size_t, std::size_t > > rmat_edges(
+        RMATGen(gen, 128, 512, 0.57, 0.19, 0.19, 0.05), RMATGen());
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, rmat_edges.begin(),
+        rmat_edges.end(), 128);
+    std::vector< std::size_t > dist(128, unreached);
+    boost::direction_optimizing_breadth_first_search(
+        csr, 0, boost::distance_map(&dist[0]));
+    BOOST_TEST_EQ(dist[0], 0u);
+    boost::direction_optimizing_breadth_first_search(
+        csr, 0, boost::vertex_index_map(get(boost::vertex_index, csr)));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check dense and sparse distance tables, computed with Dijkstra's
+// algorithm and with the bucket method on a contraction hierarchy, against
+// dijkstra_shortest_paths from each source, for one and several threads.
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/distance_table.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    DirectedGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UndirectedGraph;
+
+template < typename Distance >
+void check_dense(const std::vector< std::vector< Distance > >& expected,
+    const std::vector< std::vector< Distance > >& table)
+{
+    BOOST_TEST_EQ(table.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        for (std::size_t j = 0; j < expected[i].size(); ++j)
+            BOOST_TEST_EQ(table[i][j], expected[i][j]);
+    }
+}
+
+template < typename Distance >
+void check_sparse(const std::vector< std::vector< Distance > >& expected,
+    const std::vector< std::vector< std::pair< std::size_t, Distance > > >&
+        table)
+{
+    BOOST_TEST_EQ(table.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        std::size_t k = 0;
+        for (std::size_t j = 0; j < expected[i].size(); ++j)
+        {
+            if (expected[i][j] == (std::numeric_limits< Distance >::max)())
+                continue;
+            BOOST_TEST(k < table[i].size());
+            if (k == table[i].size())
+                break;
+            BOOST_TEST_EQ(table[i][k].first, j);
+            BOOST_TEST_EQ(table[i][k].second, expected[i][j]);
+            ++k;
+        }
+        BOOST_TEST_EQ(k, table[i].size());
+    }
+}
+
+template < typename Graph >
+void check_graph(const Graph& g, std::size_t num_sources,
+    std::size_t num_targets, int seed)
+{
+    typedef typename boost::property_map< Graph,
+        boost::edge_weight_t >::const_type WeightMap;
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    typedef std::vector< std::vector< Distance > > DenseTable;
+    typedef std::vector< std::vector< std::pair< std::size_t, Distance > > >
+        SparseTable;
+
+    std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    // Sources and targets may repeat
+    std::vector< std::size_t > sources, targets;
+    for (std::size_t i = 0; i < num_sources; ++i)
+        sources.push_back(vertex_dist(gen));
+    for (std::size_t j = 0; j < num_targets; ++j)
+        targets.push_back(vertex_dist(gen));
+
+    DenseTable expected(num_sources, std::vector< Distance >(num_targets));
+    std::vector< Distance > distance(n);
+    for (std::size_t i = 0; i < num_sources; ++i)
+    {
+        boost::dijkstra_shortest_paths(
+            g, sources[i], boost::distance_map(&distance[0]));
+        for (std::size_t j = 0; j < num_targets; ++j)
+            expected[i][j] = distance[targets[j]];
+    }
+
+    boost::contraction_hierarchy< Distance > ch(g);
+    for (std::size_t num_threads = 1; num_threads <= 4; num_threads += 3)
+    {
+        DenseTable dense(num_sources, std::vector< Distance >(num_targets));
+        boost::dijkstra_distance_table(g, sources.begin(), sources.end(),
+            targets.begin(), targets.end(), dense, num_threads);
+        check_dense(expected, dense);
+
+        SparseTable sparse(num_sources);
+        boost::dijkstra_sparse_distance_table(g, sources.begin(),
+            sources.end(), targets.begin(), targets.end(), sparse,
+            get(boost::edge_weight, g), get(boost::vertex_index, g),
+            num_threads);
+        check_sparse(expected, sparse);
+
+        DenseTable ch_dense(num_sources, std::vector< Distance >(num_targets));
+        boost::contraction_hierarchy_distance_table(ch, sources.begin(),
+            sources.end(), targets.begin(), targets.end(), ch_dense,
+            num_threads);
+        check_dense(expected, ch_dense);
+
+        SparseTable ch_sparse(num_sources);
+        boost::contraction_hierarchy_sparse_distance_table(ch,
+            sources.begin(), sources.end(), targets.begin(), targets.end(),
+            ch_sparse, num_threads);
+        check_sparse(expected, ch_sparse);
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< int > weight_dist(0, 100);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, DirectedGraph >
+        ERGen;
+    DirectedGraph dg(ERGen(gen, n, p), ERGen(), n);
+    BGL_FORALL_EDGES(e, dg, DirectedGraph)
+    {
+        put(boost::edge_weight, dg, e, weight_dist(gen));
+    }
+    check_graph(dg, 20, 30, seed);
+    check_graph(dg, 5, n, seed);
+    check_graph(dg, 40, 2, seed);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand,
+        UndirectedGraph >
+        UERGen;
+    UndirectedGraph ug(UERGen(gen, n, p), UERGen(), n);
+    BGL_FORALL_EDGES(e, ug, UndirectedGraph)
+    {
+        put(boost::edge_weight, ug, e, weight_dist(gen));
+    }
+    check_graph(ug, 20, 30, seed);
+}
+
+int main()
+{
+    check_random_graphs(16, 40, 1);
+    check_random_graphs(256, 1024, 2);
+    check_random_graphs(512, 600, 3);
+
+    // No sources or no targets
+    DirectedGraph g(3);
+    add_edge(0, 1, 1, g);
+    std::vector< std::size_t > none, all;
+    all.push_back(0);
+    all.push_back(1);
+    all.push_back(2);
+    std::vector< std::vector< int > > table(3);
+    boost::dijkstra_distance_table(
+        g, all.begin(), all.end(), none.begin(), none.end(), table);
+    boost::dijkstra_distance_table(
+        g, none.begin(), none.end(), all.begin(), all.end(), table);
+    boost::contraction_hierarchy< int > ch(g);
+    boost::contraction_hierarchy_distance_table(
+        ch, all.begin(), all.end(), none.begin(), none.end(), table);
+    boost::contraction_hierarchy_distance_table(
+        ch, none.begin(), none.end(), all.begin(), all.end(), table);
+
+    // Negative weights are rejected
+    add_edge(1, 2, -1, g);
+    bool threw = false;
+    try
+    {
+        boost::dijkstra_distance_table(
+            g, all.begin(), all.end(), all.begin(), all.end(), table);
+    }
+    catch (const boost::negative_edge&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,165 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check the blocked floyd_warshall_all_pairs_shortest_paths on a
+// row_major_distance_matrix against the original on a matrix of vectors,
+// for sizes around the tile size, 1 to 4 threads, integer and floating
+// point weights, negative weights and cycles, and other operators.
+
+#include <boost/graph/parallel_floyd_warshall_shortest.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <functional>
+#include <limits>
+#include <vector>
+
+template < typename T, typename Directed >
+struct weighted_graph
+{
+    typedef boost::adjacency_list< boost::vecS, boost::vecS, Directed,
+        boost::no_property, boost::property< boost::edge_weight_t, T > >
+        type;
+};
+
+// Addition with its own value for infinity
+struct plus_up_to
+{
+    explicit plus_up_to(int inf) : inf(inf) {}
+
+    int operator()(int a, int b) const
+    {
+        return a == inf || b == inf ? inf : a + b;
+    }
+
+    int inf;
+};
+
+template < typename Graph >
+void check_graph(const Graph& g)
+{
+    typedef typename boost::property_traits< typename boost::property_map<
+        Graph, boost::edge_weight_t >::const_type >::value_type T;
+    const std::size_t n = num_vertices(g);
+    std::vector< std::vector< T > > expected(n, std::vector< T >(n));
+    bool expected_ok = boost::floyd_warshall_all_pairs_shortest_paths(
+        g, expected);
+
+    for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads)
+    {
+        std::vector< T > storage(n * n);
+        boost::row_major_distance_matrix< T > d(storage, n);
+        const T inf = (std::numeric_limits< T >::max)();
+        bool ok = boost::floyd_warshall_all_pairs_shortest_paths(g, d,
+            get(boost::edge_weight, g), std::less< T >(),
+            boost::closed_plus< T >(inf), inf, T(), num_threads);
+        BOOST_TEST_EQ(ok, expected_ok);
+        if (!ok)
+            continue;
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                BOOST_TEST_EQ(d[i][j], expected[i][j]);
+    }
+
+    // The named parameter version goes to the blocked algorithm too
+    std::vector< T > storage(n * n);
+    boost::row_major_distance_matrix< T > d(storage.data(), n);
+    BOOST_TEST_EQ(
+        boost::floyd_warshall_all_pairs_shortest_paths(
+            g, d, boost::distance_zero(T())),
+        expected_ok);
+    if (expected_ok)
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                BOOST_TEST_EQ(d[i][j], expected[i][j]);
+}
+
+template < typename Graph >
+void check_random_graph(std::size_t n, std::size_t m, int low, int seed)
+{
+    typedef typename boost::property_traits< typename boost::property_map<
+        Graph, boost::edge_weight_t >::const_type >::value_type T;
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, m, true), ERGen(), n);
+    boost::random::uniform_int_distribution< int > weight(low, 100);
+    typename boost::graph_traits< Graph >::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        put(boost::edge_weight, g, *e, T(weight(gen)) / T(4));
+    check_graph(g);
+}
+
+int main()
+{
+    typedef weighted_graph< int, boost::directedS >::type Digraph;
+    typedef weighted_graph< double, boost::directedS >::type RealDigraph;
+    typedef weighted_graph< unsigned, boost::undirectedS >::type Graph;
+
+    check_graph(Digraph());
+    check_graph(Digraph(1));
+    const std::size_t sizes[] = { 5, 63, 64, 65, 150 };
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        std::size_t n = sizes[i];
+        check_random_graph< Digraph >(n, 4 * n, 0, int(i) + 1);
+        check_random_graph< RealDigraph >(n, 4 * n, 0, int(i) + 1);
+        check_random_graph< Graph >(n, 2 * n, 0, int(i) + 1);
+        // Some negative weights, with negative cycles for the larger
+        // graphs
+        check_random_graph< Digraph >(n, 2 * n, -5, int(i) + 1);
+    }
+
+    // A negative cycle
+    Digraph cycle(3);
+    add_edge(0, 1, 2, cycle);
+    add_edge(1, 2, -4, cycle);
+    add_edge(2, 0, 1, cycle);
+    std::vector< int > storage(9);
+    boost::row_major_distance_matrix< int > d(storage, 3);
+    BOOST_TEST(!boost::floyd_warshall_all_pairs_shortest_paths(cycle, d));
+
+    // A finite inf for floating point weights: inf plus a negative weight
+    // is still inf
+    RealDigraph h(3);
+    add_edge(0, 1, -5.0, h);
+    const double real_inf = 1e9;
+    std::vector< std::vector< double > > expected(
+        3, std::vector< double >(3));
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(h, expected,
+        get(boost::edge_weight, h), std::less< double >(),
+        boost::closed_plus< double >(real_inf), real_inf, 0.0));
+    BOOST_TEST_EQ(expected[0][2], real_inf);
+    for (std::size_t num_threads = 1; num_threads <= 2; ++num_threads)
+    {
+        std::vector< double > reals(9);
+        boost::row_major_distance_matrix< double > r(reals, 3);
+        BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(h, r,
+            get(boost::edge_weight, h), std::less< double >(),
+            boost::closed_plus< double >(real_inf), real_inf, 0.0,
+            num_threads));
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                BOOST_TEST_EQ(r[i][j], expected[i][j]);
+    }
+
+    // Other operators use the same tiles
+    Digraph g(130);
+    for (std::size_t i = 0; i + 1 < 130; ++i)
+        add_edge(i, i + 1, 1, g);
+    const int inf = 1000000;
+    std::vector< int > paths(130 * 130);
+    boost::row_major_distance_matrix< int > p(paths, 130);
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, p,
+        get(boost::edge_weight, g), std::less< int >(), plus_up_to(inf), inf,
+        0, 3));
+    BOOST_TEST_EQ(p[0][129], 129);
+    BOOST_TEST_EQ(p[5][7], 2);
+    BOOST_TEST_EQ(p[7][5], inf);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check incremental_boykov_kolmogorov_max_flow on a segmentation-like grid
+// whose capacities change from frame to frame. After each frame the flow
+// must match boykov_kolmogorov_max_flow run from scratch on a second copy of
+// the network, and the color map must describe a cut of that capacity.
+
+#include <boost/graph/boykov_kolmogorov_max_flow.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+
+using namespace boost;
+
+typedef adjacency_list_traits< vecS, vecS, directedS > Traits;
+typedef adjacency_list< vecS, vecS, directedS, no_property,
+    property< edge_capacity_t, long,
+        property< edge_residual_capacity_t, long,
+            property< edge_reverse_t, Traits::edge_descriptor > > > >
+    Graph;
+typedef graph_traits< Graph >::vertex_descriptor Vertex;
+typedef graph_traits< Graph >::edge_descriptor Edge;
+
+struct arc
+{
+    Vertex u, v;
+    long cap, rev_cap;
+};
+
+void add_arcs(Graph& g, const std::vector< arc >& arcs, std::vector< Edge >& e)
+{
+    for (std::size_t k = 0; k < arcs.size(); ++k)
+    {
+        Edge uv = add_edge(arcs[k].u, arcs[k].v, g).first;
+        Edge vu = add_edge(arcs[k].v, arcs[k].u, g).first;
+        put(edge_capacity, g, uv, arcs[k].cap);
+        put(edge_capacity, g, vu, arcs[k].rev_cap);
+        put(edge_reverse, g, uv, vu);
+        put(edge_reverse, g, vu, uv);
+        e.push_back(uv);
+    }
+}
+
+long cut_capacity(const Graph& g, const std::vector< default_color_type >& c)
+{
+    long cut = 0;
+    graph_traits< Graph >::edge_iterator ei, e_end;
+    for (boost::tie(ei, e_end) = edges(g); ei != e_end; ++ei)
+        if (c[source(*ei, g)] == black_color
+            && c[target(*ei, g)] != black_color)
+            cut += get(edge_capacity, g, *ei);
+    return cut;
+}
+
+int main()
+{
+    // A width x width grid: most pixels have edges to both terminals, some
+    // to the source only and some to none, the latter two forcing the
+    // incremental solver to start over when a flow has to be cut back.
+    const std::size_t width = 16, n = width * width;
+    const Vertex s = n, t = n + 1;
+    minstd_rand gen(7);
+    random::uniform_int_distribution< long > terminal_cap(0, 100);
+    random::uniform_int_distribution< long > neighbor_cap(0, 50);
+
+    std::vector< arc > arcs;
+    std::vector< std::size_t > terminal_arcs, neighbor_arcs;
+    for (Vertex v = 0; v < n; ++v)
+    {
+        if (v % 7 == 3)
+            continue;
+        terminal_arcs.push_back(arcs.size());
+        arc from_s = { s, v, terminal_cap(gen), 0 };
+        arcs.push_back(from_s);
+        if (v % 11 == 5)
+            continue;
+        terminal_arcs.push_back(arcs.size());
+        arc to_t = { v, t, terminal_cap(gen), 0 };
+        arcs.push_back(to_t);
+    }
+    for (Vertex v = 0; v < n; ++v)
+    {
+        if (v % width + 1 < width)
+        {
+            neighbor_arcs.push_back(arcs.size());
+            arc right = { v, v + 1, neighbor_cap(gen), neighbor_cap(gen) };
+            arcs.push_back(right);
+        }
+        if (v + width < n)
+        {
+            neighbor_arcs.push_back(arcs.size());
+            arc down = { v, v + width, neighbor_cap(gen), neighbor_cap(gen) };
+            arcs.push_back(down);
+        }
+    }
+
+    Graph g(n + 2), h(n + 2);
+    std::vector< Edge > g_edges, h_edges;
+    add_arcs(g, arcs, g_edges);
+    add_arcs(h, arcs, h_edges);
+
+    std::vector< Edge > pred(n + 2);
+    std::vector< default_color_type > color(n + 2);
+    std::vector< long > dist(n + 2);
+    typedef property_map< Graph, vertex_index_t >::const_type IndexMap;
+    typedef iterator_property_map< std::vector< Edge >::iterator, IndexMap >
+        PredMap;
+    typedef iterator_property_map<
+        std::vector< default_color_type >::iterator, IndexMap >
+        ColorMap;
+    typedef iterator_property_map< std::vector< long >::iterator, IndexMap >
+        DistMap;
+    typedef property_map< Graph, edge_capacity_t >::type CapMap;
+    typedef property_map< Graph, edge_residual_capacity_t >::type ResMap;
+    typedef property_map< Graph, edge_reverse_t >::type RevMap;
+    IndexMap idx = get(vertex_index, g);
+    incremental_boykov_kolmogorov_max_flow< Graph, CapMap, ResMap, RevMap,
+        PredMap, ColorMap, DistMap, IndexMap >
+        flow(g, get(edge_capacity, g), get(edge_residual_capacity, g),
+            get(edge_reverse, g), make_iterator_property_map(pred.begin(), idx),
+            make_iterator_property_map(color.begin(), idx),
+            make_iterator_property_map(dist.begin(), idx), idx, s, t);
+
+    // a change before the first solve
+    flow.add_capacity(g_edges[terminal_arcs[0]], 5);
+    put(edge_capacity, h, h_edges[terminal_arcs[0]],
+        arcs[terminal_arcs[0]].cap + 5);
+
+    random::uniform_int_distribution< std::size_t > pick_terminal(
+        0, terminal_arcs.size() - 1);
+    random::uniform_int_distribution< std::size_t > pick_neighbor(
+        0, neighbor_arcs.size() - 1);
+    random::uniform_int_distribution< Vertex > pick_vertex(0, n - 1);
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        long f = flow.max_flow();
+        long expected = boykov_kolmogorov_max_flow(h, get(edge_capacity, h),
+            get(edge_residual_capacity, h), get(edge_reverse, h),
+            get(vertex_index, h), s, t);
+        BOOST_TEST_EQ(f, expected);
+        BOOST_TEST_EQ(cut_capacity(g, color), f);
+        // solving again without changes is free and gives the same flow
+        BOOST_TEST_EQ(flow.max_flow(), f);
+
+        // a few terminal capacities and, every other frame, a few neighbor
+        // capacities change
+        for (int k = 0; k < 8; ++k)
+        {
+            std::size_t a = terminal_arcs[pick_terminal(gen)];
+            long cap = terminal_cap(gen);
+            flow.add_capacity(
+                g_edges[a], cap - get(edge_capacity, g, g_edges[a]));
+            put(edge_capacity, h, h_edges[a], cap);
+        }
+        for (int k = 0; frame % 2 == 1 && k < 3; ++k)
+        {
+            std::size_t a = neighbor_arcs[pick_neighbor(gen)];
+            long cap = neighbor_cap(gen);
+            flow.add_capacity(
+                g_edges[a], cap - get(edge_capacity, g, g_edges[a]));
+            put(edge_capacity, h, h_edges[a], cap);
+        }
+        Vertex v = pick_vertex(gen);
+        if (v % 7 != 3 && v % 11 != 5)
+        {
+            // both terminal edges at once, shrinking one and growing the
+            // other
+            Edge from_s = get(edge_reverse, g, edge(v, s, g).first);
+            long source_delta = -get(edge_capacity, g, from_s) / 2;
+            long sink_delta = 10;
+            flow.add_terminal_capacities(v, source_delta, sink_delta);
+            Edge h_from_s = get(edge_reverse, h, edge(v, s, h).first);
+            Edge h_to_t = edge(v, t, h).first;
+            put(edge_capacity, h, h_from_s,
+                get(edge_capacity, h, h_from_s) + source_delta);
+            put(edge_capacity, h, h_to_t,
+                get(edge_capacity, h, h_to_t) + sink_delta);
+        }
+    }
+
+    return boost::report_errors();
+}
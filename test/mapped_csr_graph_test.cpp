@@ -0,0 +1,316 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Test that a compressed sparse row graph written in the CSR graph file
+// layout and mapped back as a mapped_csr_graph has the same structure, and
+// that algorithms give the same results on both.
+
+#include <boost/graph/mapped_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, double >
+    CSRGraphT;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    boost::no_property, double >
+    BidirCSRGraphT;
+
+typedef boost::mapped_csr_graph< boost::directedS, double > MappedGraphT;
+typedef boost::mapped_csr_graph< boost::bidirectionalS, double >
+    BidirMappedGraphT;
+typedef boost::mapped_csr_graph<> UnweightedMappedGraphT;
+
+typedef std::pair< std::size_t, std::size_t > edge_t;
+
+template < typename G1, typename G2 >
+void check_same_graph(const G1& g1, const G2& g2)
+{
+    BOOST_TEST_EQ(num_vertices(g1), num_vertices(g2));
+    BOOST_TEST_EQ(num_edges(g1), num_edges(g2));
+    for (std::size_t v = 0; v < num_vertices(g1); ++v)
+    {
+        BOOST_TEST_EQ(out_degree(v, g1), out_degree(v, g2));
+        std::vector< std::size_t > a1(adjacent_vertices(v, g1).first,
+            adjacent_vertices(v, g1).second);
+        std::vector< std::size_t > a2(adjacent_vertices(v, g2).first,
+            adjacent_vertices(v, g2).second);
+        BOOST_TEST(a1 == a2);
+    }
+    typename boost::graph_traits< G1 >::edge_iterator e1, e1_end;
+    typename boost::graph_traits< G2 >::edge_iterator e2, e2_end;
+    boost::tie(e1, e1_end) = edges(g1);
+    boost::tie(e2, e2_end) = edges(g2);
+    for (; e1 != e1_end && e2 != e2_end; ++e1, ++e2)
+    {
+        BOOST_TEST_EQ(source(*e1, g1), source(*e2, g2));
+        BOOST_TEST_EQ(target(*e1, g1), target(*e2, g2));
+        BOOST_TEST_EQ(g1[*e1], g2[*e2]);
+        BOOST_TEST(
+            edge_from_index(get(boost::edge_index, g2, *e2), g2) == *e2);
+    }
+    BOOST_TEST(e1 == e1_end && e2 == e2_end);
+}
+
+void check_same_in_edges(const BidirCSRGraphT& g1, const BidirMappedGraphT& g2)
+{
+    for (std::size_t v = 0; v < num_vertices(g1); ++v)
+    {
+        BOOST_TEST_EQ(in_degree(v, g1), in_degree(v, g2));
+        BidirCSRGraphT::in_edge_iterator i1 = in_edges(v, g1).first;
+        BidirMappedGraphT::in_edge_iterator i2, i2_end;
+        for (boost::tie(i2, i2_end) = in_edges(v, g2); i2 != i2_end;
+             ++i1, ++i2)
+        {
+            BOOST_TEST_EQ(source(*i1, g1), source(*i2, g2));
+            BOOST_TEST_EQ(target(*i2, g2), v);
+            BOOST_TEST_EQ(g1[*i1], g2[*i2]);
+        }
+    }
+}
+
+template < typename G1, typename G2 >
+void check_same_algorithm_results(const G1& g1, const G2& g2)
+{
+    std::size_t n = num_vertices(g1);
+    if (n == 0)
+        return;
+
+    std::vector< std::size_t > dist1(n, 0), dist2(n, 0);
+    breadth_first_search(g1, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                dist1.begin(), get(boost::vertex_index, g1)),
+            boost::on_tree_edge()))));
+    breadth_first_search(g2, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                dist2.begin(), get(boost::vertex_index, g2)),
+            boost::on_tree_edge()))));
+    BOOST_TEST(dist1 == dist2);
+
+    std::vector< double > d1(n), d2(n);
+    dijkstra_shortest_paths(g1, 0,
+        boost::weight_map(get(boost::edge_bundle, g1))
+            .distance_map(boost::make_iterator_property_map(
+                d1.begin(), get(boost::vertex_index, g1))));
+    dijkstra_shortest_paths(g2, 0,
+        boost::weight_map(get(boost::edge_bundle, g2))
+            .distance_map(boost::make_iterator_property_map(
+                d2.begin(), get(boost::vertex_index, g2))));
+    BOOST_TEST(d1 == d2);
+
+    std::vector< double > c1(n), c2(n);
+    brandes_betweenness_centrality(g1,
+        boost::make_iterator_property_map(
+            c1.begin(), get(boost::vertex_index, g1)));
+    brandes_betweenness_centrality(g2,
+        boost::make_iterator_property_map(
+            c2.begin(), get(boost::vertex_index, g2)));
+    BOOST_TEST(c1 == c2);
+}
+
+void test_graph(std::size_t numverts, std::size_t numedges, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, numverts == 0 ? 0 : numverts - 1);
+    boost::random::uniform_int_distribution< int > weight_dist(1, 100);
+    std::vector< edge_t > edge_list;
+    std::vector< double > weights;
+    for (std::size_t i = 0; i < numedges && numverts > 0; ++i)
+    {
+        edge_list.push_back(edge_t(vertex_dist(gen), vertex_dist(gen)));
+        weights.push_back(weight_dist(gen));
+    }
+
+    CSRGraphT g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), numverts);
+    BidirCSRGraphT gb(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), numverts);
+
+    std::string filename = "mapped_csr_graph_test.bin";
+    write_csr_graph_file(filename, g, get(boost::edge_bundle, g));
+    {
+        MappedGraphT mg(filename);
+        check_same_graph(g, mg);
+        check_same_algorithm_results(g, mg);
+
+        // Copies share the mapping
+        MappedGraphT mg2(mg);
+        check_same_graph(g, mg2);
+    }
+
+    // A file without in-edge arrays cannot be opened as bidirectional
+    bool threw = false;
+    try
+    {
+        BidirMappedGraphT mgb(filename);
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    write_csr_graph_file(filename, gb, get(boost::edge_bundle, gb));
+    {
+        BidirMappedGraphT mgb(filename);
+        mgb.validate();
+        check_same_graph(gb, mgb);
+        check_same_in_edges(gb, mgb);
+        check_same_algorithm_results(gb, mgb);
+
+        // The in-edge arrays are ignored when opened as directed
+        MappedGraphT mg(filename);
+        check_same_graph(g, mg);
+    }
+    std::remove(filename.c_str());
+
+    // Files without edge values, kept in memory rather than mapped
+    std::ostringstream out;
+    write_csr_graph_file(out, g);
+    std::string data = out.str();
+    std::vector< double > buffer(data.size() / sizeof(double) + 1);
+    std::memcpy(&buffer[0], data.data(), data.size());
+    UnweightedMappedGraphT ug(&buffer[0], data.size());
+    BOOST_TEST_EQ(num_edges(ug), num_edges(g));
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+    {
+        BOOST_TEST(std::equal(adjacent_vertices(v, g).first,
+            adjacent_vertices(v, g).second, adjacent_vertices(v, ug).first));
+    }
+
+    threw = false;
+    try
+    {
+        MappedGraphT mg(&buffer[0], data.size());
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+}
+
+// Whether mapping a copy of data with the std::size_t at byte offset pos
+// replaced by value is rejected, when opening or, if validate, by validate()
+bool rejects_corrupted(const std::string& data, boost::uint64_t pos,
+    std::size_t value, bool validate)
+{
+    std::vector< double > file(data.size() / sizeof(double) + 1);
+    std::memcpy(&file[0], data.data(), data.size());
+    std::memcpy(reinterpret_cast< char* >(&file[0]) + pos, &value,
+        sizeof(value));
+    try
+    {
+        MappedGraphT mg(&file[0], data.size());
+        if (validate)
+            mg.validate();
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        return true;
+    }
+    return false;
+}
+
+void test_bad_files()
+{
+    std::vector< double > buffer(64, 0.0);
+    const std::size_t size = buffer.size() * sizeof(double);
+    bool threw = false;
+    try
+    {
+        MappedGraphT mg(&buffer[0], size);
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    // Truncated file
+    std::vector< edge_t > edge_list(10, edge_t(0, 1));
+    std::vector< double > weights(10, 1.0);
+    CSRGraphT g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), 2);
+    std::ostringstream out;
+    write_csr_graph_file(out, g, get(boost::edge_bundle, g));
+    std::string data = out.str();
+    std::vector< double > file(data.size() / sizeof(double) + 1);
+    std::memcpy(&file[0], data.data(), data.size());
+    threw = false;
+    try
+    {
+        MappedGraphT mg(&file[0], data.size() - 128);
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+
+    // Corrupted arrays: a column entry that is not a vertex, and a row start
+    // beyond the next one are only found by validate(), a last row start
+    // that is not the number of edges when opening
+    boost::detail::csr_graph_file_header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    BOOST_TEST(!rejects_corrupted(data, header.column_offset, 1, true));
+    BOOST_TEST(!rejects_corrupted(
+        data, header.column_offset + 3 * sizeof(std::size_t), 7, false));
+    BOOST_TEST(rejects_corrupted(
+        data, header.column_offset + 3 * sizeof(std::size_t), 7, true));
+    BOOST_TEST(!rejects_corrupted(
+        data, header.rowstart_offset + sizeof(std::size_t), 11, false));
+    BOOST_TEST(rejects_corrupted(
+        data, header.rowstart_offset + sizeof(std::size_t), 11, true));
+    BOOST_TEST(rejects_corrupted(
+        data, header.rowstart_offset + 2 * sizeof(std::size_t), 9, false));
+
+    threw = false;
+    try
+    {
+        MappedGraphT mg("mapped_csr_graph_test_does_not_exist.bin");
+    }
+    catch (const boost::bad_csr_graph_file&)
+    {
+        threw = true;
+    }
+    BOOST_TEST(threw);
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< MappedGraphT >));
+    BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< MappedGraphT >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< MappedGraphT >));
+    BOOST_CONCEPT_ASSERT((boost::EdgeListGraphConcept< MappedGraphT >));
+    BOOST_CONCEPT_ASSERT(
+        (boost::BidirectionalGraphConcept< BidirMappedGraphT >));
+
+    test_graph(0, 0, 1);
+    test_graph(1, 5, 2);
+    test_graph(10, 3, 3);
+    test_graph(100, 1000, 4);
+    test_graph(1000, 20000, 5);
+    test_bad_files();
+    return boost::report_errors();
+}
@@ -0,0 +1,179 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check the parallel (power iteration), Gauss-Seidel and delta-push
+// PageRank engines against a dense power iteration, on random directed
+// graphs with dangling vertices and self-loops, on an undirected graph and
+// on a graph without an internal vertex index.
+
+#include <boost/graph/parallel_page_rank.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <map>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS >
+    Graph;
+typedef boost::adjacency_list< boost::listS, boost::listS, boost::directedS >
+    ListDigraph;
+typedef boost::graph_traits< ListDigraph >::vertex_descriptor ListVertex;
+
+// Power iteration on the dense Google matrix until it stops changing
+template < typename G >
+std::vector< double > reference_page_rank(const G& g, double damping)
+{
+    std::size_t n = num_vertices(g);
+    std::vector< double > rank(n, 1.0 / double(n)), next(n);
+    for (int iteration = 0; iteration < 1000; ++iteration)
+    {
+        double dangling = 0.0;
+        for (std::size_t u = 0; u < n; ++u)
+            if (out_degree(u, g) == 0)
+                dangling += rank[u];
+        for (std::size_t v = 0; v < n; ++v)
+            next[v] = (1.0 - damping + damping * dangling) / double(n);
+        for (std::size_t u = 0; u < n; ++u)
+        {
+            typename boost::graph_traits< G >::adjacency_iterator v, v_end;
+            for (boost::tie(v, v_end) = adjacent_vertices(u, g); v != v_end;
+                 ++v)
+                next[*v] += damping * rank[u] / double(out_degree(u, g));
+        }
+        rank.swap(next);
+    }
+    return rank;
+}
+
+void check_close(const std::vector< double >& expected,
+    const std::vector< double >& actual, double tolerance)
+{
+    BOOST_TEST_EQ(expected.size(), actual.size());
+    double error = 0.0, sum = 0.0;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        error += std::abs(expected[i] - actual[i]);
+        sum += actual[i];
+    }
+    BOOST_TEST(error <= tolerance);
+    BOOST_TEST(std::abs(sum - 1.0) <= tolerance);
+}
+
+template < typename G > void check_graph(const G& g)
+{
+    const double damping = 0.85, tolerance = 1e-10;
+    std::vector< double > expected = reference_page_rank(g, damping);
+    // The error after stopping is at most the last change times
+    // damping / (1 - damping)
+    const double error = 10 * tolerance;
+
+    for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads)
+    {
+        std::vector< double > rank(num_vertices(g), -1.0);
+        std::size_t iterations = boost::graph::parallel_page_rank(
+            g, &rank[0], damping, tolerance, 1000, num_threads);
+        BOOST_TEST(iterations < 1000);
+        check_close(expected, rank, error);
+    }
+
+    std::vector< double > rank(num_vertices(g), -1.0);
+    BOOST_TEST(boost::graph::gauss_seidel_page_rank(
+                   g, &rank[0], damping, tolerance, 1000)
+        < 1000);
+    check_close(expected, rank, error);
+
+    rank.assign(num_vertices(g), -1.0);
+    BOOST_TEST(
+        boost::graph::delta_page_rank(g, &rank[0], damping, tolerance, 1000)
+        < 1000);
+    check_close(expected, rank, error);
+
+    // Stopping after a single iteration
+    BOOST_TEST_EQ(boost::graph::parallel_page_rank(g, &rank[0], damping,
+                      tolerance, 1),
+        1u);
+}
+
+// The overloads taking a vertex index map, on a copy of g whose vertices
+// have no internal index
+void check_index_map(const Digraph& g)
+{
+    const double damping = 0.85, tolerance = 1e-10;
+    std::vector< double > expected = reference_page_rank(g, damping);
+    const double error = 10 * tolerance;
+
+    ListDigraph lg;
+    std::vector< ListVertex > orig_to_copy(num_vertices(g));
+    for (std::size_t i = 0; i < orig_to_copy.size(); ++i)
+        orig_to_copy[i] = add_vertex(lg);
+    boost::graph_traits< Digraph >::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        add_edge(orig_to_copy[source(*e, g)], orig_to_copy[target(*e, g)], lg);
+    std::map< ListVertex, std::size_t > index_of;
+    for (std::size_t i = 0; i < orig_to_copy.size(); ++i)
+        index_of[orig_to_copy[i]] = i;
+    boost::associative_property_map< std::map< ListVertex, std::size_t > >
+        index(index_of);
+
+    std::map< ListVertex, double > rank_of;
+    boost::associative_property_map< std::map< ListVertex, double > > rank(
+        rank_of);
+    std::vector< double > rank_by_index(num_vertices(g));
+    for (int engine = 0; engine < 3; ++engine)
+    {
+        std::size_t iterations;
+        if (engine == 0)
+            iterations = boost::graph::parallel_page_rank(
+                lg, rank, index, damping, tolerance, 1000, 2);
+        else if (engine == 1)
+            iterations = boost::graph::gauss_seidel_page_rank(
+                lg, rank, index, damping, tolerance, 1000);
+        else
+            iterations = boost::graph::delta_page_rank(
+                lg, rank, index, damping, tolerance, 1000);
+        BOOST_TEST(iterations < 1000);
+        for (std::size_t i = 0; i < orig_to_copy.size(); ++i)
+            rank_by_index[i] = rank_of[orig_to_copy[i]];
+        check_close(expected, rank_by_index, error);
+    }
+}
+
+int main()
+{
+    boost::minstd_rand gen(1);
+    for (std::size_t n = 5; n <= 625; n *= 5)
+    {
+        // About one vertex in e^2 has no out-edges, and there are
+        // self-loops
+        typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph >
+            ERGen;
+        Digraph dg(ERGen(gen, n, 2.0 / double(n), true), ERGen(), n);
+        check_graph(dg);
+        check_index_map(dg);
+
+        typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph >
+            UERGen;
+        Graph ug(UERGen(gen, n, 4.0 / double(n)), UERGen(), n);
+        check_graph(ug);
+    }
+
+    // Only dangling vertices
+    Digraph empty(10);
+    check_graph(empty);
+
+    // No vertices
+    Digraph none;
+    double* rank = 0;
+    BOOST_TEST_EQ(boost::graph::parallel_page_rank(none, rank), 0u);
+    BOOST_TEST_EQ(boost::graph::gauss_seidel_page_rank(none, rank), 0u);
+    BOOST_TEST_EQ(boost::graph::delta_page_rank(none, rank), 0u);
+    return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check parallel_bellman_ford_shortest_paths against
+// bellman_ford_shortest_paths on random graphs with negative weights, with
+// and without negative cycles, for 1 to 4 threads.
+
+#include <boost/graph/parallel_bellman_ford_shortest_paths.hpp>
+#include <boost/graph/bellman_ford_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, long > >
+    Digraph;
+typedef boost::graph_traits< Digraph >::edge_descriptor Edge;
+
+// Edges u -> v of weight w + p(u) - p(v), w in [low, 100], which leave no
+// negative cycle if low >= 0
+Digraph random_digraph(std::size_t n, std::size_t m, int low, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    boost::random::uniform_int_distribution< int > weight(low, 100),
+        shift(0, 50);
+    std::vector< long > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = shift(gen);
+    Digraph g(n);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        std::size_t u = vertex(gen), v = vertex(gen);
+        add_edge(u, v, weight(gen) + p[u] - p[v], g);
+    }
+    return g;
+}
+
+void check_digraph(const Digraph& g, std::size_t s)
+{
+    const std::size_t n = num_vertices(g);
+    const long inf = (std::numeric_limits< long >::max)();
+    std::vector< long > expected(n, inf);
+    expected[s] = 0;
+    bool expected_result = boost::bellman_ford_shortest_paths(g, n,
+        boost::weight_map(get(boost::edge_weight, g))
+            .distance_map(expected.data()));
+
+    for (std::size_t threads = 1; threads <= 4; ++threads)
+    {
+        std::vector< long > distance(n);
+        std::vector< std::size_t > pred(n);
+        std::vector< Edge > cycle;
+        bool result = boost::parallel_bellman_ford_shortest_paths(g, s,
+            pred.data(), distance.data(), get(boost::edge_weight, g),
+            get(boost::vertex_index, g), std::less< long >(),
+            boost::closed_plus< long >(), inf, 0L, std::back_inserter(cycle),
+            threads);
+        BOOST_TEST_EQ(result, expected_result);
+        if (!result)
+        {
+            // A closed walk of negative weight
+            BOOST_TEST(!cycle.empty());
+            long w = 0;
+            for (std::size_t k = 0; k < cycle.size(); ++k)
+            {
+                w += get(boost::edge_weight, g, cycle[k]);
+                BOOST_TEST_EQ(target(cycle[k], g),
+                    source(cycle[(k + 1) % cycle.size()], g));
+            }
+            BOOST_TEST(w < 0);
+            continue;
+        }
+        BOOST_TEST(cycle.empty());
+        BOOST_TEST(distance == expected);
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            if (v == s || distance[v] == inf)
+                BOOST_TEST_EQ(pred[v], v);
+            else
+                BOOST_TEST(boost::edge(pred[v], v, g).second);
+        }
+
+        std::vector< long > named(n);
+        BOOST_TEST(boost::parallel_bellman_ford_shortest_paths(g, s,
+            boost::distance_map(named.data()).num_threads(threads)));
+        BOOST_TEST(named == expected);
+    }
+}
+
+int main()
+{
+    check_digraph(Digraph(1), 0);
+    for (int seed = 1; seed <= 10; ++seed)
+    {
+        check_digraph(random_digraph(50, 200, 0, seed), 0);
+        check_digraph(random_digraph(50, 200, -3, seed), 0);
+        check_digraph(random_digraph(300, 600, -1, seed), 0);
+    }
+    check_digraph(random_digraph(2000, 10000, 0, 11), 7);
+
+    return boost::report_errors();
+}
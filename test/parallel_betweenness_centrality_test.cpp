@@ -0,0 +1,156 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check parallel_brandes_betweenness_centrality against the sequential
+// brandes_betweenness_centrality, for vertex and edge centralities, on
+// unweighted and weighted random graphs and for 1 to 4 threads.
+
+#include <boost/graph/parallel_betweenness_centrality.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <vector>
+
+typedef boost::property< boost::edge_weight_t, double,
+    boost::property< boost::edge_index_t, std::size_t > >
+    EdgeProperties;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, EdgeProperties >
+    Digraph;
+typedef boost::adjacency_list< boost::listS, boost::listS,
+    boost::undirectedS, boost::property< boost::vertex_index_t, int >,
+    EdgeProperties >
+    Graph;
+
+void check_close(const std::vector< double >& expected,
+    const std::vector< double >& actual)
+{
+    BOOST_TEST_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        BOOST_TEST(std::abs(expected[i] - actual[i])
+            <= 1e-9 * (1.0 + std::abs(expected[i])));
+    }
+}
+
+template < typename G > void check_graph(const G& g)
+{
+    typedef typename boost::property_map< G, boost::vertex_index_t >::const_type
+        VertexIndexMap;
+    typedef typename boost::property_map< G, boost::edge_index_t >::const_type
+        EdgeIndexMap;
+    typedef boost::iterator_property_map< std::vector< double >::iterator,
+        VertexIndexMap >
+        CentralityMap;
+    typedef boost::iterator_property_map< std::vector< double >::iterator,
+        EdgeIndexMap >
+        EdgeCentralityMap;
+
+    std::size_t n = num_vertices(g), m = num_edges(g);
+    VertexIndexMap vertex_index = get(boost::vertex_index, g);
+    EdgeIndexMap edge_index = get(boost::edge_index, g);
+
+    for (int weighted = 0; weighted < 2; ++weighted)
+    {
+        std::vector< double > centrality(n), edge_centrality(m);
+        if (weighted)
+            brandes_betweenness_centrality(g,
+                boost::centrality_map(
+                    CentralityMap(centrality.begin(), vertex_index))
+                    .edge_centrality_map(EdgeCentralityMap(
+                        edge_centrality.begin(), edge_index))
+                    .weight_map(get(boost::edge_weight, g)));
+        else
+            brandes_betweenness_centrality(g,
+                CentralityMap(centrality.begin(), vertex_index),
+                EdgeCentralityMap(edge_centrality.begin(), edge_index));
+
+        for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads)
+        {
+            std::vector< double > parallel_centrality(n, -1.0),
+                parallel_edge_centrality(m, -1.0);
+            CentralityMap c(parallel_centrality.begin(), vertex_index);
+            EdgeCentralityMap ec(parallel_edge_centrality.begin(), edge_index);
+            if (weighted)
+                boost::parallel_brandes_betweenness_centrality(g, c, ec,
+                    vertex_index, get(boost::edge_weight, g), num_threads);
+            else
+                boost::parallel_brandes_betweenness_centrality(
+                    g, c, ec, vertex_index, num_threads);
+            check_close(centrality, parallel_centrality);
+            check_close(edge_centrality, parallel_edge_centrality);
+
+            // Vertex centrality only, through named parameters
+            std::vector< double > named_centrality(n, -1.0);
+            CentralityMap nc(named_centrality.begin(), vertex_index);
+            if (weighted)
+                boost::parallel_brandes_betweenness_centrality(g,
+                    boost::centrality_map(nc)
+                        .weight_map(get(boost::edge_weight, g))
+                        .num_threads(num_threads));
+            else
+                boost::parallel_brandes_betweenness_centrality(g,
+                    boost::centrality_map(nc).num_threads(num_threads));
+            check_close(centrality, named_centrality);
+        }
+    }
+}
+
+template < typename G > void index_and_weigh(G& g, int seed)
+{
+    boost::minstd_rand gen(seed);
+    // Small integral weights give many shortest paths of equal length
+    boost::random::uniform_int_distribution< int > weight_dist(1, 4);
+    std::size_t i = 0;
+    BGL_FORALL_VERTICES_T(v, g, G)
+    {
+        put(boost::vertex_index, g, v, int(i++));
+    }
+    i = 0;
+    BGL_FORALL_EDGES_T(e, g, G)
+    {
+        put(boost::edge_index, g, e, i++);
+        put(boost::edge_weight, g, e, double(weight_dist(gen)));
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph dg(ERGen(gen, n, p), ERGen(), n);
+    std::size_t i = 0;
+    BGL_FORALL_EDGES(e, dg, Digraph)
+    {
+        put(boost::edge_index, dg, e, i++);
+        put(boost::edge_weight, dg, e, double(1 + i % 3));
+    }
+    check_graph(dg);
+
+    Graph ug(n);
+    std::vector< Graph::vertex_descriptor > vertex(
+        vertices(ug).first, vertices(ug).second);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > UERGen;
+    for (UERGen it(gen, n, p), end; it != end; ++it)
+        add_edge(vertex[it->first], vertex[it->second], ug);
+    index_and_weigh(ug, seed);
+    check_graph(ug);
+}
+
+int main()
+{
+    check_random_graphs(2, 1, 1);
+    check_random_graphs(20, 60, 2);
+    check_random_graphs(200, 800, 3);
+    check_random_graphs(300, 300, 4);
+    return boost::report_errors();
+}
@@ -0,0 +1,132 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Test that parallel_breadth_first_search computes the same distances as
+// breadth_first_search and a valid breadth-first tree for several numbers
+// of threads, and that it reports the supported visitor events.
+
+#include <boost/graph/parallel_breadth_first_search.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/rmat_graph_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS > CSRGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS >
+    UndirectedGraph;
+
+const std::size_t unreached = (std::numeric_limits< std::size_t >::max)();
+
+// Counts the discovered vertices and tree edges across all threads
+struct counting_visitor : public boost::parallel_bfs_visitor<>
+{
+    counting_visitor(std::atomic< std::size_t >* discovered,
+        std::atomic< std::size_t >* tree_edges)
+    : m_discovered(discovered), m_tree_edges(tree_edges)
+    {
+    }
+
+    template < class Vertex, class Graph >
+    void discover_vertex(Vertex, const Graph&)
+    {
+        ++*m_discovered;
+    }
+
+    template < class Edge, class Graph > void tree_edge(Edge, const Graph&)
+    {
+        ++*m_tree_edges;
+    }
+
+    std::atomic< std::size_t >* m_discovered;
+    std::atomic< std::size_t >* m_tree_edges;
+};
+
+template < typename Graph >
+void check_search(const Graph& g, std::size_t s, std::size_t num_threads)
+{
+    typedef typename boost::graph_traits< Graph >::vertex_descriptor Vertex;
+    std::size_t n = num_vertices(g);
+
+    std::vector< std::size_t > expected(n, unreached);
+    expected[s] = 0;
+    boost::breadth_first_search(g, vertex(s, g),
+        boost::visitor(boost::make_bfs_visitor(
+            boost::record_distances(&expected[0], boost::on_tree_edge()))));
+    std::size_t num_reached
+        = n - std::count(expected.begin(), expected.end(), unreached);
+
+    std::vector< std::size_t > dist(n, unreached);
+    std::vector< Vertex > pred(n);
+    boost::parallel_breadth_first_search(
+        g, vertex(s, g), &dist[0], &pred[0], num_threads);
+    BOOST_TEST(dist == expected);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (dist[v] == unreached || v == s)
+            continue;
+        BOOST_TEST_EQ(dist[pred[v]] + 1, dist[v]);
+        BOOST_TEST(edge(pred[v], vertex(v, g), g).second);
+    }
+    BOOST_TEST_EQ(pred[s], vertex(s, g));
+
+    // Visitor built from event visitors
+    std::vector< std::size_t > vis_dist(n, unreached);
+    vis_dist[s] = 0;
+    boost::parallel_breadth_first_search(g, vertex(s, g),
+        boost::dummy_property_map(), boost::dummy_property_map(),
+        get(boost::vertex_index, g),
+        boost::make_parallel_bfs_visitor(
+            boost::record_distances(&vis_dist[0], boost::on_tree_edge())),
+        num_threads);
+    BOOST_TEST(vis_dist == expected);
+
+    // User-defined visitor
+    std::atomic< std::size_t > discovered(0), tree_edges(0);
+    boost::parallel_breadth_first_search(g, vertex(s, g),
+        boost::dummy_property_map(), boost::dummy_property_map(),
+        get(boost::vertex_index, g),
+        counting_visitor(&discovered, &tree_edges), num_threads);
+    BOOST_TEST_EQ(discovered.load(), num_reached);
+    BOOST_TEST_EQ(tree_edges.load(), num_reached - 1);
+}
+
+int main()
+{
+    boost::minstd_rand gen(7);
+    const std::size_t thread_counts[] = { 1, 2, 3, 4, 8 };
+
+    for (std::size_t n = 8; n <= 8192; n *= 8)
+    {
+        typedef boost::rmat_iterator< boost::minstd_rand, CSRGraph > RMATGen;
+        std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+            RMATGen(gen, n, 8 * n, 0.57, 0.19, 0.19, 0.05), RMATGen());
+        CSRGraph csr(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+            edge_list.end(), n);
+        UndirectedGraph ug(edge_list.begin(), edge_list.end(), n);
+
+        for (std::size_t i = 0;
+             i < sizeof(thread_counts) / sizeof(std::size_t); ++i)
+        {
+            check_search(csr, 0, thread_counts[i]);
+            check_search(csr, n - 1, thread_counts[i]);
+            check_search(ug, n / 2, thread_counts[i]);
+        }
+    }
+
+    // Isolated source
+    CSRGraph single(boost::edges_are_unsorted_multi_pass,
+        static_cast< std::pair< int, int >* >(0),
+        static_cast< std::pair< int, int >* >(0), 3);
+    check_search(single, 1, 4);
+
+    return boost::report_errors();
+}
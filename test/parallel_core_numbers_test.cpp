@@ -0,0 +1,154 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check bucket_core_numbers and parallel_core_numbers against core_numbers
+// on random directed and undirected graphs with hubs, and
+// incremental_core_numbers against a recomputation after every edge added
+// or removed.
+
+#include <boost/graph/parallel_core_numbers.hpp>
+#include <boost/graph/incremental_core_numbers.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS >
+    Graph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+typedef boost::adjacency_list< boost::setS, boost::vecS, boost::undirectedS >
+    SimpleGraph;
+typedef boost::compressed_sparse_row_graph< boost::directedS > CSRGraph;
+
+template < typename G > void check_graph(G& g)
+{
+    std::size_t n = num_vertices(g);
+    std::vector< int > expected(n);
+    int expected_max = boost::core_numbers(g, expected.data());
+
+    std::vector< int > core(n, -1);
+    BOOST_TEST_EQ(boost::bucket_core_numbers(g, core.data()), expected_max);
+    BOOST_TEST(core == expected);
+
+    for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads)
+    {
+        core.assign(n, -1);
+        BOOST_TEST_EQ(boost::parallel_core_numbers(g, core.data(), num_threads),
+            expected_max);
+        BOOST_TEST(core == expected);
+    }
+}
+
+// Random graphs with a few hubs adjacent to most vertices
+template < typename G > void add_hubs(G& g, boost::minstd_rand& gen)
+{
+    std::size_t n = num_vertices(g);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    for (std::size_t hub = 0; hub < 3; ++hub)
+        for (std::size_t i = 0; i < n; ++i)
+            if (i != hub && vertex(gen) < n / 2)
+                add_edge(hub, i, g);
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, m), ERGen(), n);
+    add_hubs(g, gen);
+    check_graph(g);
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > DERGen;
+    Digraph d(DERGen(gen, n, m), DERGen(), n);
+    add_hubs(d, gen);
+    check_graph(d);
+
+    std::vector< std::pair< std::size_t, std::size_t > > arcs;
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(d); e != e_end; ++e)
+        arcs.push_back(std::make_pair(source(*e, d), target(*e, d)));
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, arcs.begin(),
+        arcs.end(), n);
+    check_graph(csr);
+}
+
+void check_updates(std::size_t n, std::size_t steps, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    SimpleGraph g(n);
+    boost::incremental_core_numbers< SimpleGraph > cores(g);
+    std::vector< int > expected(n);
+    std::size_t changes = 0;
+    for (std::size_t step = 0; step < steps; ++step)
+    {
+        std::size_t u = vertex(gen), v = vertex(gen);
+        if (u == v)
+            continue;
+        // Grow the graph for the first half, then thin it out
+        bool add = step < steps / 2 ? vertex(gen) < 3 * n / 4
+                                    : vertex(gen) < n / 4;
+        if (add && !edge(u, v, g).second)
+        {
+            add_edge(u, v, g);
+            changes += cores.edge_added(u, v);
+        }
+        else if (!add && edge(u, v, g).second)
+        {
+            remove_edge(u, v, g);
+            changes += cores.edge_removed(u, v);
+        }
+        else
+            continue;
+        boost::core_numbers(g, expected.data());
+        for (std::size_t w = 0; w < n; ++w)
+            BOOST_TEST_EQ(cores.core_number(w), std::size_t(expected[w]));
+    }
+    BOOST_TEST(changes > 0);
+}
+
+int main()
+{
+    check_random_graphs(10, 20, 1);
+    check_random_graphs(100, 500, 2);
+    check_random_graphs(1000, 8000, 3);
+
+    Graph empty;
+    check_graph(empty);
+    Graph isolated(5);
+    check_graph(isolated);
+
+    check_updates(20, 2000, 4);
+    check_updates(200, 10000, 5);
+
+    // A clique grown edge by edge from a path, with vertices added on the
+    // way, then an edge taken out
+    SimpleGraph clique(2);
+    add_edge(0, 1, clique);
+    boost::incremental_core_numbers< SimpleGraph > cores(clique);
+    BOOST_TEST_EQ(cores.core_number(0), 1u);
+    for (std::size_t v = 2; v < 6; ++v)
+    {
+        add_vertex(clique);
+        for (std::size_t u = 0; u < v; ++u)
+        {
+            add_edge(u, v, clique);
+            cores.edge_added(u, v);
+        }
+    }
+    BOOST_TEST_EQ(cores.core_number(0), 5u);
+    BOOST_TEST_EQ(cores.core_number(5), 5u);
+    remove_edge(0, 1, clique);
+    BOOST_TEST_EQ(cores.edge_removed(0, 1), 6u);
+    BOOST_TEST_EQ(cores.core_number(2), 4u);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,159 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check the rows streamed by parallel_johnson_all_pairs_shortest_paths
+// against johnson_all_pairs_shortest_paths on random graphs with and
+// without negative weights, for 1 to 4 threads.
+
+#include <boost/graph/parallel_johnson_all_pairs_shortest.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Digraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    Graph;
+
+// Stores each row, and counts the calls
+template < typename DT > struct store_rows
+{
+    store_rows(std::vector< std::vector< DT > >& rows,
+        std::atomic< std::size_t >& calls)
+    : rows(&rows), calls(&calls)
+    {
+    }
+
+    void operator()(std::size_t u, const std::vector< DT >& row) const
+    {
+        (*rows)[u] = row;
+        ++*calls;
+    }
+
+    std::vector< std::vector< DT > >* rows;
+    std::atomic< std::size_t >* calls;
+};
+
+template < typename G > void check_rows(const G& g)
+{
+    typedef typename boost::property_traits< typename boost::property_map<
+        G, boost::edge_weight_t >::const_type >::value_type DT;
+    const std::size_t n = num_vertices(g);
+    std::vector< std::vector< DT > > expected(n, std::vector< DT >(n));
+    BOOST_TEST(boost::johnson_all_pairs_shortest_paths(g, expected));
+
+    for (std::size_t threads = 1; threads <= 4; ++threads)
+    {
+        std::vector< std::vector< DT > > rows(n);
+        std::atomic< std::size_t > calls(0);
+        BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(
+            g, store_rows< DT >(rows, calls), threads));
+        BOOST_TEST_EQ(calls.load(), n);
+        BOOST_TEST(rows == expected);
+    }
+}
+
+// Weights w + p(u) - p(v) with w >= 0 are often negative but leave no
+// negative cycle
+void check_random_digraph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph g(ERGen(gen, n, m, true), ERGen(), n);
+    boost::random::uniform_int_distribution< int > weight(0, 20), shift(0, 10);
+    std::vector< int > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = shift(gen);
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        put(boost::edge_weight, g, *e,
+            weight(gen) + p[source(*e, g)] - p[target(*e, g)]);
+    check_rows(g);
+}
+
+void check_random_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, m), ERGen(), n);
+    boost::random::uniform_int_distribution< int > weight(0, 100);
+    Graph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        put(boost::edge_weight, g, *e, weight(gen) / 4.0);
+    check_rows(g);
+}
+
+struct eccentricity
+{
+    explicit eccentricity(std::vector< int >& result) : result(&result) {}
+
+    void operator()(std::size_t u, const std::vector< int >& row) const
+    {
+        int e = 0;
+        for (std::size_t v = 0; v < row.size(); ++v)
+            e = (std::max)(e, row[v]);
+        (*result)[u] = e;
+    }
+
+    std::vector< int >* result;
+};
+
+struct failing_row
+{
+    void operator()(std::size_t, const std::vector< int >&) const
+    {
+        throw std::runtime_error("row");
+    }
+};
+
+int main()
+{
+    check_rows(Digraph());
+    check_rows(Digraph(1));
+    check_random_digraph(10, 30, 1);
+    check_random_digraph(100, 400, 2);
+    check_random_digraph(300, 600, 3);
+    check_random_graph(10, 20, 4);
+    check_random_graph(200, 600, 5);
+
+    // A reduction on the fly: the eccentricities of a path
+    Digraph path(5);
+    for (std::size_t v = 0; v + 1 < 5; ++v)
+    {
+        add_edge(v, v + 1, 2, path);
+        add_edge(v + 1, v, -1, path);
+    }
+    std::vector< int > ecc(5, -1);
+    BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(
+        path, eccentricity(ecc), 2));
+    BOOST_TEST_EQ(ecc[0], 8);
+    BOOST_TEST_EQ(ecc[2], 4);
+    BOOST_TEST_EQ(ecc[4], 0);
+
+    // No row is passed when there is a negative cycle
+    add_edge(4, 0, -9, path);
+    std::vector< std::vector< int > > rows(5);
+    std::atomic< std::size_t > calls(0);
+    BOOST_TEST(!boost::parallel_johnson_all_pairs_shortest_paths(
+        path, store_rows< int >(rows, calls), 2));
+    BOOST_TEST_EQ(calls.load(), 0u);
+
+    // Exceptions from the function reach the caller
+    Digraph g(20);
+    BOOST_TEST_THROWS(
+        boost::parallel_johnson_all_pairs_shortest_paths(g, failing_row(), 3),
+        std::runtime_error);
+
+    return boost::report_errors();
+}
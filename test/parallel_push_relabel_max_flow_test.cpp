@@ -0,0 +1,135 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check parallel_push_relabel_max_flow against push_relabel_max_flow, for 1
+// to 4 threads, on the prgen graphs of stoer_wagner_test (whose edges are
+// made undirected, so that the smallest flow from vertex 0 is the weight
+// of their minimum cut) and on random graphs.
+//
+// The test takes the path of the test directory as its argument.
+
+#include <boost/graph/parallel_push_relabel_max_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/read_dimacs.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+typedef boost::adjacency_list_traits< boost::vecS, boost::vecS,
+    boost::directedS >
+    Traits;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property,
+    boost::property< boost::edge_capacity_t, long,
+        boost::property< boost::edge_residual_capacity_t, long,
+            boost::property< boost::edge_reverse_t,
+                Traits::edge_descriptor > > > >
+    Graph;
+typedef boost::graph_traits< Graph >::edge_descriptor Edge;
+
+// The flow from s to t for 1 to 4 threads, checked against
+// push_relabel_max_flow and for conservation
+long check_flow(Graph& g, std::size_t s, std::size_t t)
+{
+    long expected = boost::push_relabel_max_flow(g, s, t);
+    for (std::size_t threads = 1; threads <= 4; ++threads)
+    {
+        long flow = boost::parallel_push_relabel_max_flow(
+            g, s, t, boost::num_threads(threads));
+        BOOST_TEST_EQ(flow, expected);
+
+        std::vector< long > balance(num_vertices(g), 0);
+        Graph::edge_iterator e, e_end;
+        for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        {
+            long residual = get(boost::edge_residual_capacity, g, *e);
+            BOOST_TEST(residual >= 0);
+            long pushed = get(boost::edge_capacity, g, *e) - residual;
+            balance[source(*e, g)] -= pushed;
+            balance[target(*e, g)] += pushed;
+        }
+        for (std::size_t v = 0; v < num_vertices(g); ++v)
+            if (v != s && v != t)
+                BOOST_TEST_EQ(balance[v], 0);
+    }
+    return expected;
+}
+
+void add_arc(Graph& g, std::size_t u, std::size_t v, long capacity)
+{
+    Edge a = add_edge(u, v, g).first, r = add_edge(v, u, g).first;
+    put(boost::edge_capacity, g, a, capacity);
+    put(boost::edge_capacity, g, r, 0);
+    put(boost::edge_reverse, g, a, r);
+    put(boost::edge_reverse, g, r, a);
+}
+
+void check_prgen(const std::string& file, long min_cut)
+{
+    std::ifstream in(file.c_str());
+    BOOST_TEST(in.good());
+    Graph cut;
+    boost::read_dimacs_min_cut(
+        cut, get(boost::edge_capacity, cut), get(boost::edge_reverse, cut), in);
+    // An arc each way for each edge, since push_relabel_max_flow needs the
+    // reverse edges to have no capacity
+    Graph g(num_vertices(cut));
+    Graph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(cut); e != e_end; ++e)
+    {
+        long capacity = get(boost::edge_capacity, cut, *e);
+        if (capacity > 0)
+        {
+            add_arc(g, source(*e, cut), target(*e, cut), capacity);
+            add_arc(g, target(*e, cut), source(*e, cut), capacity);
+        }
+    }
+
+    long smallest = -1;
+    for (std::size_t t = 1; t < num_vertices(g); ++t)
+    {
+        long flow = check_flow(g, 0, t);
+        if (smallest < 0 || flow < smallest)
+            smallest = flow;
+    }
+    BOOST_TEST_EQ(smallest, min_cut);
+}
+
+void check_random_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    boost::random::uniform_int_distribution< long > capacity(0, 100);
+    Graph g(n);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        std::size_t u = vertex(gen), v = vertex(gen);
+        add_arc(g, u, v, capacity(gen));
+    }
+    check_flow(g, 0, n - 1);
+}
+
+int main(int argc, char* argv[])
+{
+    if (BOOST_TEST(argc == 2))
+    {
+        std::string test_dir = argv[1];
+        check_prgen(test_dir + "/prgen_input_graphs/prgen_20_70_2.net", 3407);
+        check_prgen(
+            test_dir + "/prgen_input_graphs/prgen_50_40_2.net", 10056);
+        check_prgen(
+            test_dir + "/prgen_input_graphs/prgen_50_70_2.net", 21755);
+    }
+    for (int seed = 1; seed <= 20; ++seed)
+        check_random_graph(30, 120, seed);
+    check_random_graph(2000, 8000, 21);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check personalized_page_rank against a dense power iteration with
+// restarts at the seeds, on random directed and undirected graphs, and
+// check that a query on a large graph only touches a few vertices.
+
+#include <boost/graph/personalized_page_rank.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+typedef boost::adjacency_list< boost::listS, boost::listS,
+    boost::undirectedS, boost::property< boost::vertex_index_t, int > >
+    Graph;
+
+typedef std::vector< std::pair< std::size_t, double > > Seeds;
+
+// Power iteration with restarts at the seeds, also from dangling vertices
+std::vector< double > reference_page_rank(
+    const Digraph& g, const Seeds& seeds, double damping)
+{
+    std::size_t n = num_vertices(g);
+    std::vector< double > restart(n, 0.0), rank(n, 0.0), next(n);
+    double total = 0.0;
+    for (std::size_t i = 0; i < seeds.size(); ++i)
+        total += seeds[i].second;
+    for (std::size_t i = 0; i < seeds.size(); ++i)
+        restart[seeds[i].first] += seeds[i].second / total;
+    rank = restart;
+    for (int iteration = 0; iteration < 1000; ++iteration)
+    {
+        double dangling = 0.0;
+        for (std::size_t u = 0; u < n; ++u)
+            if (out_degree(u, g) == 0)
+                dangling += rank[u];
+        for (std::size_t v = 0; v < n; ++v)
+            next[v] = (1.0 - damping + damping * dangling) * restart[v];
+        for (std::size_t u = 0; u < n; ++u)
+        {
+            Digraph::adjacency_iterator v, v_end;
+            for (boost::tie(v, v_end) = adjacent_vertices(u, g); v != v_end;
+                 ++v)
+                next[*v] += damping * rank[u] / double(out_degree(u, g));
+        }
+        rank.swap(next);
+    }
+    return rank;
+}
+
+void check_digraph(const Digraph& g, const Seeds& seeds)
+{
+    const double damping = 0.85, epsilon = 1e-10;
+    std::vector< double > expected = reference_page_rank(g, seeds, damping);
+
+    Seeds result;
+    boost::graph::personalized_page_rank(g, seeds.begin(), seeds.end(),
+        std::back_inserter(result), damping, epsilon);
+    std::vector< double > rank(num_vertices(g), 0.0);
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        BOOST_TEST(result[i].second > 0.0);
+        rank[result[i].first] += result[i].second;
+    }
+
+    // The estimates are below the ranks by at most the residuals left,
+    // each of which is at most epsilon times the out-degree
+    double error = 0.0;
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+    {
+        BOOST_TEST(rank[v] <= expected[v] + 1e-12);
+        error += expected[v] - rank[v];
+    }
+    BOOST_TEST(error >= -1e-12);
+    BOOST_TEST(error <= epsilon * double(num_edges(g) + num_vertices(g)));
+}
+
+void check_random_digraphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph g(ERGen(gen, n, m, true), ERGen(), n);
+
+    Seeds seeds;
+    seeds.push_back(std::make_pair(std::size_t(0), 1.0));
+    check_digraph(g, seeds);
+    seeds.push_back(std::make_pair(n / 2, 3.0));
+    seeds.push_back(std::make_pair(n - 1, 0.5));
+    check_digraph(g, seeds);
+}
+
+int main()
+{
+    check_random_digraphs(10, 15, 1);
+    check_random_digraphs(100, 300, 2);
+    check_random_digraphs(300, 600, 3);
+
+    // A long cycle in an undirected graph with listS vertices: the rank
+    // decays geometrically, so only the vertices near the seed are touched
+    const std::size_t n = 100000;
+    Graph cycle;
+    std::vector< Graph::vertex_descriptor > vertex;
+    for (std::size_t i = 0; i < n; ++i)
+        vertex.push_back(add_vertex(int(i), cycle));
+    for (std::size_t i = 0; i < n; ++i)
+        add_edge(vertex[i], vertex[(i + 1) % n], cycle);
+
+    std::vector< std::pair< Graph::vertex_descriptor, double > > result;
+    boost::graph::personalized_page_rank(
+        cycle, vertex[0], std::back_inserter(result), 0.85, 1e-4);
+    BOOST_TEST(!result.empty());
+    BOOST_TEST(result.size() < 200);
+    double total = 0.0, seed_rank = 0.0;
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        total += result[i].second;
+        if (result[i].first == vertex[0])
+            seed_rank = result[i].second;
+    }
+    BOOST_TEST(total <= 1.0 + 1e-12);
+    BOOST_TEST(total >= 1.0 - 1e-4 * 2 * 200);
+    // The walk restarts at the seed with probability 0.15 at each step
+    BOOST_TEST(seed_rank >= 0.15);
+
+    // No seed weight
+    Seeds none;
+    Digraph g(3);
+    std::vector< std::pair< std::size_t, double > > empty;
+    boost::graph::personalized_page_rank(
+        g, none.begin(), none.end(), std::back_inserter(empty));
+    BOOST_TEST(empty.empty());
+    return boost::report_errors();
+}
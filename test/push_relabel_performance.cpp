@@ -0,0 +1,125 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the time of push_relabel_max_flow with that of
+// array_push_relabel_max_flow, highest-label and FIFO, and of
+// parallel_push_relabel_max_flow on a maximum flow problem in DIMACS format.
+//
+// Usage: push_relabel_performance [file]
+// reads the problem from file with read_dimacs_max_flow.  Without a file,
+// it generates a random level graph like those of the DIMACS challenge
+// generator RLG: 64 levels of 1024 vertices, each with edges to 3 random
+// vertices of the next level and to one of its own, with the source
+// linked to the first level and the last level to the sink.
+
+#include <boost/graph/array_push_relabel_max_flow.hpp>
+#include <boost/graph/parallel_push_relabel_max_flow.hpp>
+#include <boost/graph/push_relabel_max_flow.hpp>
+#include <boost/graph/read_dimacs.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace boost;
+
+typedef adjacency_list_traits< vecS, vecS, directedS > Traits;
+typedef adjacency_list< vecS, vecS, directedS, no_property,
+    property< edge_capacity_t, long,
+        property< edge_residual_capacity_t, long,
+            property< edge_reverse_t, Traits::edge_descriptor > > > >
+    Graph;
+
+void write_level_graph(std::ostream& out)
+{
+    const std::size_t levels = 64, width = 1024;
+    const std::size_t n = levels * width + 2;
+    minstd_rand gen(1);
+    random::uniform_int_distribution< std::size_t > column(0, width - 1);
+    random::uniform_int_distribution< long > capacity(1, 10000);
+    std::ostringstream arcs;
+    std::size_t m = 0;
+    for (std::size_t l = 0; l < levels; ++l)
+        for (std::size_t c = 0; c < width; ++c)
+        {
+            // Vertices are numbered from 1, the source and sink last
+            std::size_t u = l * width + c + 1;
+            if (l == 0)
+                arcs << "a " << n - 1 << ' ' << u << ' ' << capacity(gen)
+                     << '\n';
+            if (l + 1 == levels)
+                arcs << "a " << u << ' ' << n << ' ' << capacity(gen) << '\n';
+            else
+                for (int k = 0; k < 3; ++k)
+                    arcs << "a " << u << ' '
+                         << (l + 1) * width + column(gen) + 1 << ' '
+                         << capacity(gen) << '\n';
+            arcs << "a " << u << ' ' << l * width + column(gen) + 1 << ' '
+                 << capacity(gen) << '\n';
+            m += (l + 1 < levels ? 4 : 2) + (l == 0);
+        }
+    out << "p max " << n << ' ' << m << '\n'
+        << "n " << n - 1 << " s\n"
+        << "n " << n << " t\n"
+        << arcs.str();
+}
+
+int main(int argc, char* argv[])
+{
+    Graph g;
+    Traits::vertex_descriptor s, t;
+    if (argc > 1)
+    {
+        std::ifstream in(argv[1]);
+        read_dimacs_max_flow(
+            g, get(edge_capacity, g), get(edge_reverse, g), s, t, in);
+    }
+    else
+    {
+        std::stringstream in;
+        write_level_graph(in);
+        read_dimacs_max_flow(
+            g, get(edge_capacity, g), get(edge_reverse, g), s, t, in);
+    }
+    std::cout << num_vertices(g) << " vertices, " << num_edges(g) / 2
+              << " edges.\n";
+
+    boost::timer::cpu_timer timer;
+    long flow = push_relabel_max_flow(g, s, t);
+    boost::timer::cpu_times list_time = timer.elapsed();
+
+    timer.start();
+    long highest_label_flow = array_push_relabel_max_flow(g, s, t);
+    boost::timer::cpu_times highest_label_time = timer.elapsed();
+
+    timer.start();
+    long fifo_flow = array_push_relabel_max_flow(
+        g, s, t, push_relabel_options(push_relabel_options::fifo));
+    boost::timer::cpu_times fifo_time = timer.elapsed();
+
+    timer.start();
+    long parallel_flow = parallel_push_relabel_max_flow(g, s, t);
+    boost::timer::cpu_times parallel_time = timer.elapsed();
+
+    std::cout << "flow " << flow << '\n'
+              << "push_relabel_max_flow:             "
+              << boost::timer::format(list_time)
+              << "array_push_relabel_max_flow:       "
+              << boost::timer::format(highest_label_time)
+              << "array_push_relabel_max_flow, FIFO: "
+              << boost::timer::format(fifo_time)
+              << "parallel_push_relabel_max_flow:    "
+              << boost::timer::format(parallel_time);
+    BOOST_TEST_EQ(highest_label_flow, flow);
+    BOOST_TEST_EQ(fifo_flow, flow);
+    BOOST_TEST_EQ(parallel_flow, flow);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check queue_bellman_ford_shortest_paths against
+// bellman_ford_shortest_paths on random graphs with negative weights, with
+// and without negative cycles, and check the negative cycles it returns.
+
+#include <boost/graph/queue_bellman_ford_shortest_paths.hpp>
+#include <boost/graph/bellman_ford_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, long > >
+    Digraph;
+typedef boost::graph_traits< Digraph >::edge_descriptor Edge;
+
+// Edges u -> v of weight w + p(u) - p(v), w in [low, 100], which leave no
+// negative cycle if low >= 0
+Digraph random_digraph(std::size_t n, std::size_t m, int low, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    boost::random::uniform_int_distribution< int > weight(low, 100),
+        shift(0, 50);
+    std::vector< long > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = shift(gen);
+    Digraph g(n);
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        std::size_t u = vertex(gen), v = vertex(gen);
+        add_edge(u, v, weight(gen) + p[u] - p[v], g);
+    }
+    return g;
+}
+
+void check_cycle(const Digraph& g, const std::vector< Edge >& cycle)
+{
+    BOOST_TEST(!cycle.empty());
+    long w = 0;
+    for (std::size_t k = 0; k < cycle.size(); ++k)
+    {
+        w += get(boost::edge_weight, g, cycle[k]);
+        BOOST_TEST_EQ(target(cycle[k], g),
+            source(cycle[(k + 1) % cycle.size()], g));
+    }
+    BOOST_TEST(w < 0);
+}
+
+void check_digraph(const Digraph& g, std::size_t s)
+{
+    const std::size_t n = num_vertices(g);
+    const long inf = (std::numeric_limits< long >::max)();
+    std::vector< long > expected(n, inf);
+    expected[s] = 0;
+    bool expected_result = boost::bellman_ford_shortest_paths(g, n,
+        boost::weight_map(get(boost::edge_weight, g))
+            .distance_map(expected.data()));
+
+    std::vector< long > distance(n);
+    std::vector< std::size_t > pred(n);
+    std::vector< Edge > cycle;
+    bool result = boost::queue_bellman_ford_shortest_paths(g, s,
+        pred.data(), distance.data(), get(boost::edge_weight, g),
+        get(boost::vertex_index, g), std::less< long >(),
+        boost::closed_plus< long >(), inf, 0L, std::back_inserter(cycle));
+    BOOST_TEST_EQ(result, expected_result);
+    if (!result)
+    {
+        check_cycle(g, cycle);
+        return;
+    }
+    BOOST_TEST(cycle.empty());
+    BOOST_TEST(distance == expected);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (v == s || distance[v] == inf)
+            BOOST_TEST_EQ(pred[v], v);
+        else
+            BOOST_TEST(boost::edge(pred[v], v, g).second);
+    }
+
+    // Named parameters
+    std::vector< long > named(n);
+    BOOST_TEST(boost::queue_bellman_ford_shortest_paths(
+        g, s, boost::distance_map(named.data())));
+    BOOST_TEST(named == expected);
+}
+
+int main()
+{
+    for (int seed = 1; seed <= 20; ++seed)
+    {
+        check_digraph(random_digraph(50, 200, 0, seed), 0);
+        check_digraph(random_digraph(50, 200, -3, seed), 0);
+        check_digraph(random_digraph(300, 600, -1, seed), 0);
+    }
+    check_digraph(random_digraph(1000, 5000, 0, 21), 7);
+
+    // All vertices as sources finds every negative cycle; it is returned
+    // as soon as it closes, with its edges in order
+    Digraph g(5);
+    add_edge(0, 1, 1, g);
+    add_edge(1, 2, -2, g);
+    add_edge(2, 3, 1, g);
+    add_edge(3, 1, -1, g);
+    add_edge(3, 4, 5, g);
+    std::vector< long > distance(5, 0);
+    std::vector< Edge > cycle;
+    BOOST_TEST(!boost::queue_bellman_ford_shortest_paths_no_init(g,
+        boost::dummy_property_map(), distance.data(),
+        get(boost::edge_weight, g), get(boost::vertex_index, g),
+        std::less< long >(), boost::closed_plus< long >(),
+        (std::numeric_limits< long >::max)(), std::back_inserter(cycle)));
+    BOOST_TEST_EQ(cycle.size(), 3u);
+    check_cycle(g, cycle);
+
+    // A negative self-loop, which is not reachable from 4
+    add_edge(0, 0, -1, g);
+    cycle.clear();
+    BOOST_TEST(!boost::queue_bellman_ford_shortest_paths(g, 0,
+        boost::dummy_property_map(), distance.data(),
+        get(boost::edge_weight, g), get(boost::vertex_index, g),
+        std::less< long >(), boost::closed_plus< long >(),
+        (std::numeric_limits< long >::max)(), 0L, std::back_inserter(cycle)));
+    BOOST_TEST_EQ(cycle.size(), 1u);
+    BOOST_TEST(boost::queue_bellman_ford_shortest_paths(
+        g, 4, boost::distance_map(distance.data())));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,107 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the time to build and query transitive_closure (looking the
+// edges up), bitset_transitive_closure and reachability_index on random
+// directed acyclic graphs whose edges mostly go to nearby vertices, like
+// dependency graphs.
+//
+// Usage: reachability_index_performance [vertices [out-degree [queries]]]
+// builds a graph with the given number of vertices (default 4000), each
+// with edges to out-degree (default 3) of the next 200 vertices, and runs
+// that many random queries (default 1000000) on each structure.
+
+#include <boost/graph/reachability_index.hpp>
+#include <boost/graph/bitset_transitive_closure.hpp>
+#include <boost/graph/transitive_closure.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace boost;
+
+int main(int argc, char* argv[])
+{
+    std::size_t n
+        = (argc > 1 ? lexical_cast< std::size_t >(argv[1]) : 4000u);
+    std::size_t degree
+        = (argc > 2 ? lexical_cast< std::size_t >(argv[2]) : 3u);
+    std::size_t num_queries
+        = (argc > 3 ? lexical_cast< std::size_t >(argv[3]) : 1000000u);
+
+    minstd_rand gen(1);
+    random::uniform_int_distribution< std::size_t > offset(1, 200);
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t i = 0; i < degree; ++i)
+        {
+            std::size_t v = u + offset(gen);
+            if (v < n)
+                edge_list.push_back(std::make_pair(u, v));
+        }
+    typedef compressed_sparse_row_graph< directedS > CSRGraph;
+    CSRGraph g(
+        edges_are_unsorted_multi_pass, edge_list.begin(), edge_list.end(), n);
+    std::cout << n << " vertices, " << num_edges(g) << " edges.\n";
+
+    random::uniform_int_distribution< std::size_t > vertex_dist(0, n - 1);
+    std::vector< std::pair< std::size_t, std::size_t > > queries;
+    for (std::size_t i = 0; i < num_queries; ++i)
+        queries.push_back(std::make_pair(vertex_dist(gen), vertex_dist(gen)));
+    std::vector< char > tc_answers(num_queries), bitset_answers(num_queries),
+        index_answers(num_queries);
+
+    typedef adjacency_list< setS, vecS, directedS > ClosureGraph;
+    ClosureGraph source(edge_list.begin(), edge_list.end(), n), tc;
+    boost::timer::cpu_timer t;
+    transitive_closure(source, tc);
+    boost::timer::cpu_times tc_build = t.elapsed();
+    t.start();
+    for (std::size_t i = 0; i < num_queries; ++i)
+        tc_answers[i] = edge(queries[i].first, queries[i].second, tc).second;
+    boost::timer::cpu_times tc_query = t.elapsed();
+
+    t.start();
+    bitset_transitive_closure< CSRGraph > bitsets(g);
+    boost::timer::cpu_times bitset_build = t.elapsed();
+    t.start();
+    for (std::size_t i = 0; i < num_queries; ++i)
+        bitset_answers[i]
+            = bitsets.reachable(queries[i].first, queries[i].second);
+    boost::timer::cpu_times bitset_query = t.elapsed();
+
+    t.start();
+    reachability_index<> index(g);
+    boost::timer::cpu_times index_build = t.elapsed();
+    reachability_index_query<> query(index);
+    t.start();
+    for (std::size_t i = 0; i < num_queries; ++i)
+        index_answers[i] = query.reachable(queries[i].first, queries[i].second);
+    boost::timer::cpu_times index_query = t.elapsed();
+
+    BOOST_TEST(bitset_answers == tc_answers);
+    BOOST_TEST(index_answers == tc_answers);
+
+    std::cout << "transitive_closure (" << num_edges(tc) << " edges):\n"
+              << "  build: " << boost::timer::format(tc_build)
+              << "  queries: " << boost::timer::format(tc_query)
+              << "bitset_transitive_closure (" << bitsets.memory_usage()
+              << " bytes of sets):\n"
+              << "  build: " << boost::timer::format(bitset_build)
+              << "  queries: " << boost::timer::format(bitset_query)
+              << "reachability_index (" << index.num_intervals()
+              << " intervals):\n"
+              << "  build: " << boost::timer::format(index_build)
+              << "  queries: " << boost::timer::format(index_query);
+    return boost::report_errors();
+}
@@ -0,0 +1,131 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check reachability_index against transitive_closure on random directed
+// graphs with and without cycles, built with 1 to 4 threads and after a
+// round trip through a text archive.
+
+#include <boost/graph/reachability_index.hpp>
+#include <boost/graph/transitive_closure.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+
+typedef std::vector< std::vector< char > > Matrix;
+
+Matrix closure_matrix(const Digraph& g)
+{
+    const std::size_t n = num_vertices(g);
+    Matrix expected(n, std::vector< char >(n, 0));
+    if (n == 0)
+        return expected;
+    Digraph tc;
+    boost::transitive_closure(g, tc);
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(tc); e != e_end; ++e)
+        expected[source(*e, tc)][target(*e, tc)] = 1;
+    return expected;
+}
+
+template < typename Vertex >
+void check_index(
+    const boost::reachability_index< Vertex >& index, const Matrix& expected)
+{
+    const std::size_t n = expected.size();
+    BOOST_TEST_EQ(index.num_vertices(), n);
+    boost::reachability_index_query< Vertex > query(index);
+    for (std::size_t u = 0; u < n; ++u)
+        for (std::size_t v = 0; v < n; ++v)
+            BOOST_TEST_EQ(
+                query.reachable(Vertex(u), Vertex(v)), expected[u][v] != 0);
+}
+
+void check_graph(const Digraph& g)
+{
+    Matrix expected = closure_matrix(g);
+
+    boost::reachability_index<> index(g, 1);
+    check_index(index, expected);
+    for (std::size_t num_threads = 2; num_threads <= 4; ++num_threads)
+    {
+        boost::reachability_index< boost::uint32_t > parallel_index(
+            g, get(boost::vertex_index, g), num_threads + 1, num_threads);
+        BOOST_TEST_EQ(parallel_index.num_intervals(), num_threads + 1);
+        check_index(parallel_index, expected);
+    }
+
+    // Without labels, every query that the topological order does not
+    // settle searches the condensation
+    boost::reachability_index<> unlabeled(
+        g, get(boost::vertex_index, g), 0, 1);
+    check_index(unlabeled, expected);
+
+    std::stringstream stream;
+    {
+        boost::archive::text_oarchive oa(stream);
+        oa << static_cast< const boost::reachability_index<>& >(index);
+    }
+    boost::reachability_index<> loaded;
+    {
+        boost::archive::text_iarchive ia(stream);
+        ia >> loaded;
+    }
+    BOOST_TEST_EQ(loaded.num_components(), index.num_components());
+    BOOST_TEST_EQ(loaded.num_intervals(), index.num_intervals());
+    check_index(loaded, expected);
+}
+
+void check_random_digraph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Digraph > ERGen;
+    Digraph g(ERGen(gen, n, m, true), ERGen(), n);
+    check_graph(g);
+
+    // The same edges all going forward: a DAG
+    Digraph dag(n);
+    Digraph::edge_iterator e, e_end;
+    for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+        add_edge((std::min)(source(*e, g), target(*e, g)),
+            (std::max)(source(*e, g), target(*e, g)), dag);
+    check_graph(dag);
+}
+
+int main()
+{
+    check_graph(Digraph());
+    check_graph(Digraph(3));
+    check_random_digraph(10, 12, 1);
+    check_random_digraph(100, 150, 2);
+    check_random_digraph(300, 400, 3);
+    check_random_digraph(300, 1200, 4);
+
+    // A compressed sparse row graph with a self-loop
+    typedef boost::compressed_sparse_row_graph< boost::directedS > CSRGraph;
+    std::pair< std::size_t, std::size_t > edges[]
+        = { std::make_pair(0, 1), std::make_pair(1, 1), std::make_pair(1, 2) };
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, edges, edges + 3, 4);
+    boost::reachability_index<> index(csr);
+    boost::reachability_index_query<> query(index);
+    BOOST_TEST(query.reachable(1, 1));
+    BOOST_TEST(!query.reachable(0, 0));
+    BOOST_TEST(query.reachable(0, 2));
+    BOOST_TEST(!query.reachable(2, 0));
+    BOOST_TEST(!query.reachable(0, 3));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,258 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check repeated breadth_first_visit, dijkstra_shortest_paths_no_init and
+// astar_search_no_init queries on one search_workspace against the
+// searches with freshly initialized maps, including queries stopped early
+// by a visitor.
+
+#include <boost/graph/search_workspace.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/astar_search.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/visitors.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, unsigned >
+    CSRGraph;
+
+struct found_target
+{
+};
+
+// Stops a search when the target is examined
+template < typename Vertex >
+struct stop_at_target : boost::default_astar_visitor
+{
+    explicit stop_at_target(Vertex t) : m_target(t) {}
+
+    template < typename Graph > void examine_vertex(Vertex u, const Graph&)
+    {
+        if (u == m_target)
+            throw found_target();
+    }
+
+    Vertex m_target;
+};
+
+template < typename Graph, typename WeightMap >
+void check_dijkstra(const Graph& g, WeightMap weight, int seed)
+{
+    typedef typename boost::property_traits< WeightMap >::value_type Distance;
+    typedef boost::search_workspace< Graph, Distance > Workspace;
+    std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< Distance > expected(n);
+    Workspace workspace(g);
+    for (int query = 0; query < 20; ++query)
+    {
+        std::size_t s = vertex_dist(gen), t = vertex_dist(gen);
+        boost::dijkstra_shortest_paths(
+            g, s, boost::weight_map(weight).distance_map(&expected[0]));
+
+        // A query stopped at t leaves labels and queue entries behind
+        try
+        {
+            boost::dijkstra_shortest_paths_no_init(g, s, workspace, weight,
+                stop_at_target< std::size_t >(t));
+        }
+        catch (const found_target&)
+        {
+        }
+        BOOST_TEST_EQ(get(workspace.distance_map(), t), expected[t]);
+
+        boost::dijkstra_shortest_paths_no_init(
+            g, s, workspace, weight, boost::default_dijkstra_visitor());
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            bool reached
+                = expected[v] != (std::numeric_limits< Distance >::max)();
+            BOOST_TEST_EQ(workspace.touched(v), reached);
+            BOOST_TEST_EQ(get(workspace.distance_map(), v), expected[v]);
+            std::size_t p = get(workspace.predecessor_map(), v);
+            if (v == s || !reached)
+                BOOST_TEST_EQ(p, v);
+            else
+                BOOST_TEST(p != v && expected[p] <= expected[v]);
+        }
+    }
+
+    // Several sources
+    std::size_t sources[2] = { 0, n - 1 };
+    std::vector< Distance > expected_multi(n);
+    boost::dijkstra_shortest_paths(g, sources[0],
+        boost::weight_map(weight).distance_map(&expected_multi[0]));
+    boost::dijkstra_shortest_paths(
+        g, sources[1], boost::weight_map(weight).distance_map(&expected[0]));
+    for (std::size_t v = 0; v < n; ++v)
+        expected_multi[v] = (std::min)(expected_multi[v], expected[v]);
+    boost::dijkstra_shortest_paths_no_init(g, sources, sources + 2,
+        workspace, weight, boost::default_dijkstra_visitor());
+    for (std::size_t v = 0; v < n; ++v)
+        BOOST_TEST_EQ(get(workspace.distance_map(), v), expected_multi[v]);
+}
+
+void check_bfs(const Graph& g, int seed)
+{
+    typedef boost::search_workspace< Graph, std::size_t > Workspace;
+    std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< std::size_t > expected(n);
+    Workspace workspace(g);
+    for (int query = 0; query < 20; ++query)
+    {
+        std::size_t s = vertex_dist(gen);
+        std::fill(expected.begin(), expected.end(), std::size_t(-1));
+        expected[s] = 0;
+        boost::breadth_first_search(g, s,
+            boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+                &expected[0], boost::on_tree_edge()))));
+
+        boost::breadth_first_visit(g, s, workspace,
+            boost::make_bfs_visitor(boost::record_predecessors(
+                workspace.predecessor_map(), boost::on_tree_edge())));
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            BOOST_TEST_EQ(
+                workspace.touched(v), expected[v] != std::size_t(-1));
+            if (!workspace.touched(v))
+                continue;
+            BOOST_TEST(get(workspace.color_map(), v) == boost::black_color);
+            std::size_t depth = 0;
+            for (std::size_t u = v; u != s;
+                 u = get(workspace.predecessor_map(), u))
+                ++depth;
+            BOOST_TEST_EQ(depth, expected[v]);
+        }
+    }
+}
+
+// Euclidean distance to a fixed point of a grid
+struct grid_distance : boost::astar_heuristic< Graph, double >
+{
+    grid_distance(std::size_t width, std::size_t to)
+    : m_width(width), m_to(to)
+    {
+    }
+    double operator()(std::size_t v) const
+    {
+        double dx = double(v % m_width) - double(m_to % m_width);
+        double dy = double(v / m_width) - double(m_to / m_width);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+    std::size_t m_width, m_to;
+};
+
+void check_astar(std::size_t width, int seed)
+{
+    typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+        boost::no_property, boost::property< boost::edge_weight_t, double > >
+        GridGraph;
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_real_distribution< double > stretch(1.0, 3.0);
+    std::size_t n = width * width;
+    GridGraph g(n);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (v % width + 1 < width)
+        {
+            add_edge(v, v + 1, stretch(gen), g);
+            add_edge(v + 1, v, stretch(gen), g);
+        }
+        if (v + width < n)
+        {
+            add_edge(v, v + width, stretch(gen), g);
+            add_edge(v + width, v, stretch(gen), g);
+        }
+    }
+
+    boost::search_workspace< GridGraph, double > workspace(g);
+    boost::random::uniform_int_distribution< std::size_t > vertex_dist(
+        0, n - 1);
+    std::vector< double > expected(n);
+    for (int query = 0; query < 20; ++query)
+    {
+        std::size_t s = vertex_dist(gen), t = vertex_dist(gen);
+        boost::dijkstra_shortest_paths(g, s, boost::distance_map(&expected[0]));
+        try
+        {
+            boost::astar_search_no_init(g, s, grid_distance(width, t),
+                stop_at_target< std::size_t >(t), workspace,
+                get(boost::edge_weight, g));
+        }
+        catch (const found_target&)
+        {
+        }
+        double dist = get(workspace.distance_map(), t);
+        BOOST_TEST(std::abs(dist - expected[t]) <= 1e-9 * expected[t]);
+        // The path recorded in the predecessor map has the same length
+        double length = 0;
+        for (std::size_t v = t; v != s;)
+        {
+            std::size_t u = get(workspace.predecessor_map(), v);
+            BOOST_TEST(u != v);
+            if (u == v)
+                break;
+            length += get(boost::edge_weight, g, edge(u, v, g).first);
+            v = u;
+        }
+        BOOST_TEST(std::abs(length - dist) <= 1e-9 * dist);
+    }
+}
+
+void check_random_graphs(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< int > weight_dist(0, 100);
+    double p = double(m) / (double(n) * double(n));
+
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, p), ERGen(), n);
+    BGL_FORALL_EDGES(e, g, Graph)
+    {
+        put(boost::edge_weight, g, e, weight_dist(gen));
+    }
+    check_dijkstra(g, get(boost::edge_weight, g), seed);
+    check_bfs(g, seed);
+
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list(
+        ERGen(gen, n, p), ERGen());
+    std::vector< unsigned > weights;
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+        weights.push_back(weight_dist(gen));
+    CSRGraph csr(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    check_dijkstra(csr, get(boost::edge_bundle, csr), seed);
+}
+
+int main()
+{
+    check_random_graphs(16, 40, 1);
+    check_random_graphs(256, 1024, 2);
+    check_random_graphs(1024, 1024, 3);
+    check_astar(20, 4);
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+// Copyright 2026
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Check count_triangles and list_triangles against num_triangles_on_vertex,
+// and the multithreaded all_clustering_coefficients against the original,
+// on random graphs with hubs, for 1 to 4 threads.
+
+#include <boost/graph/triangle_counting.hpp>
+#include <boost/graph/clustering_coefficient.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+typedef boost::adjacency_list< boost::setS, boost::vecS, boost::undirectedS >
+    Graph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS >
+    Digraph;
+
+struct record_triangles
+{
+    record_triangles(std::vector< std::vector< std::size_t > >& triangles)
+    : triangles(&triangles)
+    {
+    }
+
+    void operator()(std::size_t u, std::size_t v, std::size_t w) const
+    {
+        std::vector< std::size_t > t;
+        t.push_back(u);
+        t.push_back(v);
+        t.push_back(w);
+        std::sort(t.begin(), t.end());
+        triangles->push_back(t);
+    }
+
+    std::vector< std::vector< std::size_t > >* triangles;
+};
+
+void check_graph(const Graph& g)
+{
+    std::size_t n = num_vertices(g);
+    std::vector< std::size_t > expected(n);
+    std::size_t expected_total = 0;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        expected[v] = boost::num_triangles_on_vertex(g, v);
+        expected_total += expected[v];
+    }
+    expected_total /= 3;
+
+    std::vector< double > expected_cc(n);
+    double expected_mean
+        = boost::all_clustering_coefficients(g, expected_cc.data());
+
+    for (std::size_t num_threads = 1; num_threads <= 4; ++num_threads)
+    {
+        std::vector< std::size_t > count(n, std::size_t(-1));
+        BOOST_TEST_EQ(boost::count_triangles(g, count.data(), num_threads),
+            expected_total);
+        BOOST_TEST(count == expected);
+
+        std::vector< double > cc(n, -1.0);
+        double mean
+            = boost::all_clustering_coefficients(g, cc.data(), num_threads);
+        BOOST_TEST(cc == expected_cc);
+        // The original divides by zero without vertices
+        if (n == 0)
+            BOOST_TEST_EQ(mean, 0.0);
+        else
+            BOOST_TEST_EQ(mean, expected_mean);
+    }
+
+    // Each triangle is listed once
+    std::vector< std::vector< std::size_t > > triangles;
+    boost::list_triangles(g, record_triangles(triangles));
+    BOOST_TEST_EQ(triangles.size(), expected_total);
+    std::set< std::vector< std::size_t > > distinct(
+        triangles.begin(), triangles.end());
+    BOOST_TEST_EQ(distinct.size(), triangles.size());
+    std::vector< std::size_t > listed(n, 0);
+    for (std::size_t i = 0; i < triangles.size(); ++i)
+    {
+        BOOST_TEST(edge(triangles[i][0], triangles[i][1], g).second);
+        BOOST_TEST(edge(triangles[i][1], triangles[i][2], g).second);
+        BOOST_TEST(edge(triangles[i][0], triangles[i][2], g).second);
+        for (std::size_t j = 0; j < 3; ++j)
+            ++listed[triangles[i][j]];
+    }
+    BOOST_TEST(listed == expected);
+}
+
+void check_random_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    typedef boost::erdos_renyi_iterator< boost::minstd_rand, Graph > ERGen;
+    Graph g(ERGen(gen, n, m), ERGen(), n);
+
+    // A few hubs adjacent to most vertices
+    boost::random::uniform_int_distribution< std::size_t > vertex(0, n - 1);
+    for (std::size_t hub = 0; hub < 3 && hub < n; ++hub)
+        for (std::size_t i = 0; i < n; ++i)
+            if (i != hub && vertex(gen) < 3 * n / 4)
+                add_edge(hub, i, g);
+    check_graph(g);
+}
+
+int main()
+{
+    check_graph(Graph());
+    check_graph(Graph(1));
+    check_random_graph(5, 6, 2);
+    check_random_graph(100, 400, 3);
+    check_random_graph(500, 5000, 4);
+
+    // Directions, self-loops and parallel edges are ignored
+    Digraph d(4);
+    add_edge(0, 1, d);
+    add_edge(1, 0, d);
+    add_edge(1, 2, d);
+    add_edge(2, 0, d);
+    add_edge(2, 0, d);
+    add_edge(2, 2, d);
+    add_edge(3, 0, d);
+    std::vector< int > count(4);
+    BOOST_TEST_EQ(boost::count_triangles(d, &count[0]), 1u);
+    BOOST_TEST_EQ(count[0], 1);
+    BOOST_TEST_EQ(count[1], 1);
+    BOOST_TEST_EQ(count[2], 1);
+    BOOST_TEST_EQ(count[3], 0);
+
+    return boost::report_errors();
+}